@@ -30,6 +30,7 @@
 #include "ngraph/op/convert.hpp"
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/replace_slice.hpp"
+#include "ngraph/op/scatter_add.hpp"
 #include "ngraph/op/slice.hpp"
 #include "ngraph/strides.hpp"
 
@@ -155,6 +156,7 @@ void autodiff::Adjoints::add_delta(const std::shared_ptr<Node>& x,
                                    const std::shared_ptr<Node>& delta,
                                    size_t output_index)
 {
+    m_row_delta_map.erase(x.get());
     auto adjoint_it = m_adjoint_map.find(x.get());
     if (m_adjoint_map.end() == adjoint_it)
     {
@@ -185,6 +187,7 @@ void autodiff::Adjoints::add_delta_to_slice(const std::shared_ptr<Node>& x,
             "Autodiff internal error: Mismatch on backprop and op in add_delta_to_slice.");
     }
 
+    m_row_delta_map.erase(x.get());
     auto adjoint_it = m_adjoint_map.find(x.get());
     if (m_adjoint_map.end() == adjoint_it)
     {
@@ -205,6 +208,46 @@ void autodiff::Adjoints::add_delta_to_slice(const std::shared_ptr<Node>& x,
     }
 }
 
+void autodiff::Adjoints::add_delta_to_rows(const std::shared_ptr<Node>& x,
+                                           const std::shared_ptr<Node>& indices,
+                                           const std::shared_ptr<Node>& delta)
+{
+    auto adjoint_it = m_adjoint_map.find(x.get());
+    if (m_adjoint_map.end() == adjoint_it)
+    {
+        // A Broadcast of a Constant, unlike make_zero, so that passes see a zero base
+        AxisSet axes;
+        for (size_t i = 0; i < x->get_shape().size(); i++)
+        {
+            axes.insert(i);
+        }
+        auto zero = std::make_shared<op::Broadcast>(
+            op::Constant::create(x->get_element_type(), Shape{}, {0}), x->get_shape(), axes);
+        NodeVector zeros{std::make_shared<op::ScatterAdd>(zero, indices, delta)};
+        m_adjoint_map.insert({x.get(), zeros});
+        m_row_delta_map[x.get()].push_back(RowDelta{indices, delta});
+    }
+    else
+    {
+        // Scatter into the adjoint so far rather than adding a dense copy of the rows
+        auto& deltas = adjoint_it->second;
+        deltas.at(0) = std::make_shared<op::ScatterAdd>(deltas.at(0), indices, delta);
+        auto row_delta_it = m_row_delta_map.find(x.get());
+        if (m_row_delta_map.end() != row_delta_it)
+        {
+            row_delta_it->second.push_back(RowDelta{indices, delta});
+        }
+    }
+}
+
+const std::vector<autodiff::Adjoints::RowDelta>&
+    autodiff::Adjoints::get_row_deltas(const std::shared_ptr<Node>& x) const
+{
+    static const std::vector<RowDelta> no_row_deltas;
+    auto row_delta_it = m_row_delta_map.find(x.get());
+    return m_row_delta_map.end() == row_delta_it ? no_row_deltas : row_delta_it->second;
+}
+
 std::shared_ptr<Node> autodiff::Adjoints::backprop_node(const std::shared_ptr<Node>& x)
 {
     auto deltas = get(x);
@@ -19,6 +19,7 @@
 #include <map>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "ngraph/coordinate.hpp"
 #include "ngraph/node_vector.hpp"
@@ -76,10 +77,32 @@ namespace ngraph
                                     const Coordinate& upper_bounds,
                                     const Strides& strides);
 
+            /// \brief Add a backprop contribution to some rows of x's adjoint
+            ///
+            /// \param x The adjoint node
+            /// \param indices Integer indices of the rows of x to add to
+            /// \param delta A backprop contribution of shape indices.shape + x.shape[1:]
+            void add_delta_to_rows(const std::shared_ptr<Node>& x,
+                                   const std::shared_ptr<Node>& indices,
+                                   const std::shared_ptr<Node>& delta);
+
+            /// \brief A row-sparse contribution, delta is added to the rows at indices
+            struct RowDelta
+            {
+                std::shared_ptr<Node> indices;
+                std::shared_ptr<Node> delta;
+            };
+
+            /// \brief The contributions to x's adjoint when they were all added with
+            ///     add_delta_to_rows, empty otherwise. get(x) holds the same adjoint as a
+            ///     ScatterAdd into zeros, an optimizer can apply these to x's rows instead.
+            const std::vector<RowDelta>& get_row_deltas(const std::shared_ptr<Node>& x) const;
+
             std::shared_ptr<Node> backprop_node(const std::shared_ptr<Node>& x);
 
         protected:
             std::map<Node*, NodeVector> m_adjoint_map;
+            std::map<Node*, std::vector<RowDelta>> m_row_delta_map;
         };
     }
 }
@@ -14,10 +14,13 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <iomanip>
 #include <iostream>
+#include <sstream>
 
 #include <clang/Basic/DiagnosticOptions.h>
 #include <clang/Basic/TargetInfo.h>
+#include <clang/Basic/Version.h>
 #include <clang/CodeGen/CodeGenAction.h>
 #include <clang/CodeGen/ObjectFilePCHContainerOperations.h>
 #include <clang/Driver/DriverDiagnostic.h>
@@ -33,14 +36,22 @@
 #include <clang/Lex/Preprocessor.h>
 #include <clang/Lex/PreprocessorOptions.h>
 #include <llvm/ADT/Statistic.h>
+#include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/Bitcode/BitcodeWriter.h>
+#include <llvm/Config/llvm-config.h>
 #include <llvm/ExecutionEngine/MCJIT.h> // forces JIT to link in
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Metadata.h>
 #include <llvm/IR/Module.h>
 #include <llvm/LinkAllPasses.h>
 #include <llvm/Option/Arg.h>
 #include <llvm/Option/ArgList.h>
 #include <llvm/Option/OptTable.h>
 #include <llvm/Support/ErrorHandling.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Host.h>
 #include <llvm/Support/ManagedStatic.h>
+#include <llvm/Support/MemoryBuffer.h>
 #include <llvm/Support/Signals.h>
 #include <llvm/Support/TargetSelect.h>
 #include <llvm/Support/Timer.h>
@@ -111,12 +122,26 @@ std::unique_ptr<llvm::Module> codegen::Module::take_module()
 codegen::Compiler::Compiler()
     : m_compiler_core{}
 {
+    if (const char* cache_directory = std::getenv("NGRAPH_CODEGEN_CACHE_DIR"))
+    {
+        set_cache_directory(cache_directory);
+    }
 }
 
 codegen::Compiler::~Compiler()
 {
     m_compiler_action = nullptr;
     m_compiler_core = nullptr;
+    m_cache_context = nullptr;
+}
+
+void codegen::Compiler::set_cache_directory(const std::string& directory)
+{
+    m_cache_directory = directory;
+    if (!m_cache_directory.empty() && !file_util::exists(m_cache_directory))
+    {
+        file_util::make_directory(m_cache_directory);
+    }
 }
 
 void codegen::Compiler::set_precompiled_header_source(const std::string& source)
@@ -142,10 +167,164 @@ std::unique_ptr<codegen::Module> codegen::Compiler::compile(const std::string& s
         }
         compiler_info.compiler->set_precompiled_header_source(m_precompiled_header_source);
     }
+
+    string cache_key;
+    string cache_file;
+    if (!m_cache_directory.empty())
+    {
+        cache_key = get_cache_key(source, *compiler_info.compiler);
+        cache_file = file_util::path_join(m_cache_directory, get_cache_file_name(cache_key));
+        if (file_util::exists(cache_file))
+        {
+            if (auto cached = load_cached_module(cache_file, cache_key))
+            {
+                m_cache_hits++;
+                return cached;
+            }
+        }
+        m_cache_misses++;
+    }
+
     auto rc = compiler_info.compiler->compile(m_compiler_action, source);
+    if (rc && !cache_file.empty())
+    {
+        unique_ptr<llvm::Module> module = rc->take_module();
+        store_cached_module(*module, cache_file, cache_key);
+        rc.reset(new codegen::Module(move(module)));
+    }
     return rc;
 }
 
+// 64-bit FNV-1a, stable across processes unlike std::hash
+static uint64_t hash_combine_fnv(uint64_t hash, const string& part)
+{
+    for (char ch : part)
+    {
+        hash = (hash ^ static_cast<uint8_t>(ch)) * 1099511628211ULL;
+    }
+    // Separate the parts so that moving text between them changes the hash
+    return (hash ^ 0xff) * 1099511628211ULL;
+}
+
+static const uint64_t s_fnv_offset_basis = 14695981039346656037ULL;
+
+// The generated code only sees the headers built into this library (see
+// load_headers_from_resource), so their contents stand in for the headers it includes
+static const string& get_builtin_headers_hash()
+{
+    static const string hash = [] {
+        uint64_t h = s_fnv_offset_basis;
+        for (const pair<string, string>& header_info : builtin_headers)
+        {
+            h = hash_combine_fnv(h, header_info.first);
+            h = hash_combine_fnv(h, header_info.second);
+        }
+        return to_string(h);
+    }();
+    return hash;
+}
+
+string codegen::Compiler::get_cache_key(const std::string& source,
+                                        const CompilerCore& compiler) const
+{
+    // Everything that changes the generated module must be part of the key: the nGraph and
+    // compiler versions, the headers, the search paths and the options. The host CPU is
+    // included because modules are compiled for the native target.
+    vector<string> parts{NGRAPH_VERSION,
+                         clang::getClangFullVersion(),
+                         LLVM_VERSION_STRING,
+                         llvm::sys::getProcessTriple(),
+                         llvm::sys::getHostCPUName().str(),
+                         std::getenv("NGRAPH_COMPILER_DEBUGINFO_ENABLE") ? "debuginfo" : "",
+                         get_builtin_headers_hash(),
+                         m_precompiled_header_source};
+    const vector<string>& search_paths = compiler.get_header_search_paths();
+    parts.insert(parts.end(), search_paths.begin(), search_paths.end());
+    parts.push_back(source);
+
+    // Length prefixes keep the key unambiguous, so equal keys mean equal inputs
+    stringstream key;
+    for (const string& part : parts)
+    {
+        key << part.size() << ':' << part;
+    }
+    return key.str();
+}
+
+string codegen::Compiler::get_cache_file_name(const string& key)
+{
+    stringstream ss;
+    ss << std::hex << std::setw(16) << std::setfill('0')
+       << hash_combine_fnv(s_fnv_offset_basis, key) << ".bc";
+    return ss.str();
+}
+
+// Named metadata carrying the full key of a cache entry. The file name is only a 64-bit hash
+// of the key, so it is compared on load to reject collisions.
+static const char* s_cache_key_metadata = "ngraph.codegen.cache_key";
+
+unique_ptr<codegen::Module> codegen::Compiler::load_cached_module(const string& path,
+                                                                   const string& key)
+{
+    auto buffer = llvm::MemoryBuffer::getFile(path);
+    if (!buffer)
+    {
+        return nullptr;
+    }
+    if (!m_cache_context)
+    {
+        m_cache_context.reset(new llvm::LLVMContext());
+    }
+    auto module = llvm::parseBitcodeFile((*buffer)->getMemBufferRef(), *m_cache_context);
+    if (!module)
+    {
+        llvm::consumeError(module.takeError());
+        NGRAPH_WARN << "Ignoring unreadable codegen cache entry " << path;
+        return nullptr;
+    }
+    llvm::NamedMDNode* key_node = (*module)->getNamedMetadata(s_cache_key_metadata);
+    llvm::MDString* stored_key = nullptr;
+    if (key_node && key_node->getNumOperands() == 1 &&
+        key_node->getOperand(0)->getNumOperands() == 1)
+    {
+        stored_key = llvm::dyn_cast<llvm::MDString>(key_node->getOperand(0)->getOperand(0));
+    }
+    if (!stored_key || stored_key->getString() != key)
+    {
+        NGRAPH_WARN << "Ignoring codegen cache entry " << path << " built from another source";
+        return nullptr;
+    }
+    (*module)->eraseNamedMetadata(key_node);
+    return unique_ptr<codegen::Module>(new codegen::Module(move(*module)));
+}
+
+void codegen::Compiler::store_cached_module(llvm::Module& module,
+                                            const string& path,
+                                            const string& key)
+{
+    // Write to a unique file and rename it into place so that concurrent processes never see
+    // a partial entry
+    int fd;
+    llvm::SmallString<128> tmp_path;
+    if (llvm::sys::fs::createUniqueFile(path + "-%%%%%%.tmp", fd, tmp_path))
+    {
+        NGRAPH_WARN << "Unable to write codegen cache entry " << path;
+        return;
+    }
+    llvm::LLVMContext& context = module.getContext();
+    llvm::NamedMDNode* key_node = module.getOrInsertNamedMetadata(s_cache_key_metadata);
+    key_node->addOperand(llvm::MDNode::get(context, llvm::MDString::get(context, key)));
+    {
+        llvm::raw_fd_ostream out(fd, true);
+        llvm::WriteBitcodeToFile(&module, out);
+    }
+    module.eraseNamedMetadata(key_node);
+    if (llvm::sys::fs::rename(tmp_path, path))
+    {
+        llvm::sys::fs::remove(tmp_path);
+    }
+}
+
 static std::string GetExecutablePath(const char* Argv0)
 {
     // This just needs to be some symbol in the binary; C++ doesn't
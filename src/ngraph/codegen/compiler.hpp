@@ -39,6 +39,7 @@ namespace clang
 namespace llvm
 {
     class Module;
+    class LLVMContext;
 }
 
 class ngraph::codegen::Module
@@ -61,11 +62,36 @@ public:
     void add_header_search_path(const std::string& path);
     std::unique_ptr<ngraph::codegen::Module> compile(const std::string& source);
     std::unique_ptr<clang::CodeGenAction>& get_compiler_action() { return m_compiler_action; }
+    /// \brief Store compiled modules as bitcode in directory and reuse them when the same
+    ///     source is compiled again with the same configuration, even by another process.
+    ///     Entries are named by a hash of their inputs and carry the inputs themselves, an
+    ///     entry whose inputs differ is recompiled and replaced. Only the clang step is cached,
+    ///     the backend passes still run on every compile.
+    ///     Defaults to the NGRAPH_CODEGEN_CACHE_DIR environment variable. An empty directory
+    ///     disables the cache.
+    void set_cache_directory(const std::string& directory);
+    const std::string& get_cache_directory() const { return m_cache_directory; }
+    /// \brief Number of compiles served from / missing in the cache directory
+    size_t get_cache_hits() const { return m_cache_hits; }
+    size_t get_cache_misses() const { return m_cache_misses; }
 private:
+    std::string get_cache_key(const std::string& source, const CompilerCore& compiler) const;
+    static std::string get_cache_file_name(const std::string& key);
+    std::unique_ptr<ngraph::codegen::Module> load_cached_module(const std::string& path,
+                                                                const std::string& key);
+    void store_cached_module(llvm::Module& module,
+                             const std::string& path,
+                             const std::string& key);
+
     std::unique_ptr<clang::CodeGenAction> m_compiler_action;
     std::shared_ptr<CompilerCore> m_compiler_core;
     std::string m_precompiled_header_source;
     std::vector<std::string> m_header_search_paths;
+    std::string m_cache_directory;
+    // Owns modules loaded from the cache, compiled modules belong to m_compiler_action
+    std::unique_ptr<llvm::LLVMContext> m_cache_context;
+    size_t m_cache_hits = 0;
+    size_t m_cache_misses = 0;
 };
 
 class ngraph::codegen::CompilerCore
@@ -79,6 +105,10 @@ public:
     void set_precompiled_header_source(const std::string& source);
     const std::string& get_precompiled_header_source() const;
     void add_header_search_path(const std::string& path);
+    const std::vector<std::string>& get_header_search_paths() const
+    {
+        return m_extra_search_path_list;
+    }
 
     std::unique_ptr<ngraph::codegen::Module>
         compile(std::unique_ptr<clang::CodeGenAction>& compiler_action, const std::string& source);
@@ -16,6 +16,7 @@
 
 #include <cstdio>
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include <vector>
 
@@ -487,3 +488,178 @@ bool CoordinateTransform::Iterator::operator==(const Iterator& it)
 
     return true;
 }
+
+// Marks a position along an axis that has no source coordinate.
+static const std::ptrdiff_t s_no_source = std::numeric_limits<std::ptrdiff_t>::min();
+
+CoordinateTransform::IndexIterator::IndexIterator(const CoordinateTransform& transform)
+    : m_target_shape(transform.m_target_shape)
+    , m_axis_offsets(transform.m_n_axes)
+{
+    std::vector<size_t> source_row_strides = row_major_strides(transform.m_source_shape);
+
+    for (size_t target_axis = 0; target_axis < transform.m_n_axes; target_axis++)
+    {
+        // Same arithmetic as has_source_coordinate and to_source_coordinate, done once per
+        // position along the axis rather than once per element.
+        size_t source_axis = transform.m_source_axis_order[target_axis];
+        std::ptrdiff_t stride = transform.m_source_strides[source_axis];
+        std::ptrdiff_t start = transform.m_source_start_corner[source_axis];
+        std::ptrdiff_t padding_below = transform.m_target_padding_below[target_axis];
+        std::ptrdiff_t dilation = transform.m_target_dilation_strides[target_axis];
+        std::ptrdiff_t source_size = transform.m_source_shape[source_axis];
+        std::ptrdiff_t row_stride = source_row_strides[source_axis];
+
+        std::vector<std::ptrdiff_t>& offsets = m_axis_offsets[target_axis];
+        offsets.resize(m_target_shape[target_axis]);
+        for (size_t target_pos = 0; target_pos < offsets.size(); target_pos++)
+        {
+            std::ptrdiff_t pos_depadded =
+                static_cast<std::ptrdiff_t>(target_pos) * stride + start - padding_below;
+
+            if (pos_depadded < 0 || source_size == 0 ||
+                pos_depadded >= (source_size - 1) * dilation + 1 || pos_depadded % dilation != 0)
+            {
+                offsets[target_pos] = s_no_source;
+            }
+            else
+            {
+                offsets[target_pos] = (pos_depadded / dilation) * row_stride;
+            }
+        }
+    }
+
+    m_index = 0;
+    start();
+}
+
+CoordinateTransform::IndexIterator::IndexIterator(const Shape& target_shape,
+                                                  const std::vector<std::ptrdiff_t>& source_strides,
+                                                  std::ptrdiff_t source_offset)
+    : m_target_shape(target_shape)
+    , m_axis_offsets(target_shape.size())
+{
+    if (source_strides.size() != target_shape.size())
+    {
+        throw std::domain_error(
+            "Source strides do not have the same number of axes as the target space shape");
+    }
+
+    for (size_t axis = 0; axis < target_shape.size(); axis++)
+    {
+        std::vector<std::ptrdiff_t>& offsets = m_axis_offsets[axis];
+        offsets.resize(target_shape[axis]);
+        for (size_t pos = 0; pos < offsets.size(); pos++)
+        {
+            offsets[pos] = static_cast<std::ptrdiff_t>(pos) * source_strides[axis];
+        }
+    }
+
+    m_index = source_offset;
+    start();
+}
+
+static std::vector<std::ptrdiff_t> projected_strides(const Shape& target_shape,
+                                                     const AxisSet& deleted_axes)
+{
+    Shape projected_shape;
+    for (size_t axis = 0; axis < target_shape.size(); axis++)
+    {
+        if (deleted_axes.count(axis) == 0)
+        {
+            projected_shape.push_back(target_shape[axis]);
+        }
+    }
+
+    std::vector<size_t> projected_row_strides = row_major_strides(projected_shape);
+
+    std::vector<std::ptrdiff_t> strides;
+    size_t projected_axis = 0;
+    for (size_t axis = 0; axis < target_shape.size(); axis++)
+    {
+        if (deleted_axes.count(axis) == 0)
+        {
+            strides.push_back(projected_row_strides[projected_axis++]);
+        }
+        else
+        {
+            strides.push_back(0);
+        }
+    }
+    return strides;
+}
+
+CoordinateTransform::IndexIterator::IndexIterator(const Shape& target_shape,
+                                                  const AxisSet& deleted_axes)
+    : IndexIterator(target_shape, projected_strides(target_shape, deleted_axes))
+{
+}
+
+// Positions the iterator on the target origin. m_index holds the base source offset on entry.
+void CoordinateTransform::IndexIterator::start()
+{
+    m_coordinate = Coordinate(m_target_shape.size(), 0);
+    m_missing_axes = 0;
+
+    for (const std::vector<std::ptrdiff_t>& offsets : m_axis_offsets)
+    {
+        if (offsets.empty())
+        {
+            // The target space is empty; there is nothing to walk.
+            return;
+        }
+        if (offsets[0] == s_no_source)
+        {
+            m_missing_axes++;
+        }
+        else
+        {
+            m_index += offsets[0];
+        }
+    }
+}
+
+void CoordinateTransform::IndexIterator::operator++()
+{
+    for (size_t axis = m_target_shape.size(); axis-- > 0;)
+    {
+        const std::vector<std::ptrdiff_t>& offsets = m_axis_offsets[axis];
+        size_t& pos = m_coordinate[axis];
+
+        if (offsets.empty())
+        {
+            return;
+        }
+
+        // Take this axis' current contribution out of the running index...
+        if (offsets[pos] == s_no_source)
+        {
+            m_missing_axes--;
+        }
+        else
+        {
+            m_index -= offsets[pos];
+        }
+
+        bool carry = ++pos == m_target_shape[axis];
+        if (carry)
+        {
+            pos = 0;
+        }
+
+        // ...and put the new position's contribution back in.
+        if (offsets[pos] == s_no_source)
+        {
+            m_missing_axes++;
+        }
+        else
+        {
+            m_index += offsets[pos];
+        }
+
+        if (!carry)
+        {
+            return;
+        }
+    }
+}
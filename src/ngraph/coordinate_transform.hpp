@@ -16,6 +16,10 @@
 
 #pragma once
 
+#include <cstddef>
+#include <vector>
+
+#include "ngraph/axis_set.hpp"
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/coordinate.hpp"
 #include "ngraph/coordinate_diff.hpp"
@@ -92,6 +96,48 @@ namespace ngraph
             bool m_empty;
         };
 
+        /// \brief Walks a target space in row-major order and yields the linear index of the
+        ///        source element for each target point, without materializing coordinates.
+        ///
+        /// The offset that every position along every target axis contributes to the source
+        /// index is computed once up front, so advancing only adjusts the running index for the
+        /// axes that changed. Positions that fall into padding or dilation gaps are marked in
+        /// the same tables, so has_source() needs no per-element arithmetic. Like Iterator, the
+        /// walk wraps around to the first point after the last one; callers bound it by
+        /// shape_size of the target shape.
+        class IndexIterator
+        {
+        public:
+            /// \brief Walks the target space of `transform`.
+            IndexIterator(const CoordinateTransform& transform);
+
+            /// \brief Walks `target_shape`, where the source index of a target coordinate c is
+            ///        `source_offset + sum(c[i] * source_strides[i])`. Strides may be zero or
+            ///        negative.
+            IndexIterator(const Shape& target_shape,
+                          const std::vector<std::ptrdiff_t>& source_strides,
+                          std::ptrdiff_t source_offset = 0);
+
+            /// \brief Walks `target_shape`, yielding indices into the row-major tensor whose
+            ///        shape is `target_shape` with `deleted_axes` removed. This is the mapping
+            ///        used by broadcasts (walking the output) and reductions (walking the input).
+            IndexIterator(const Shape& target_shape, const AxisSet& deleted_axes);
+
+            void operator++();
+            /// \brief The source index of the current point. Only meaningful if has_source().
+            size_t operator*() const { return static_cast<size_t>(m_index); }
+            /// \brief False if the current point lies in padding or a dilation gap.
+            bool has_source() const { return m_missing_axes == 0; }
+        private:
+            void start();
+
+            Shape m_target_shape;
+            std::vector<std::vector<std::ptrdiff_t>> m_axis_offsets;
+            Coordinate m_coordinate;
+            std::ptrdiff_t m_index;
+            size_t m_missing_axes;
+        };
+
         Iterator begin() noexcept { return Iterator(m_target_shape); }
         Iterator end() noexcept { return m_end_iterator; }
         size_t index_source(const Coordinate& c) const;
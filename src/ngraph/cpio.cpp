@@ -20,6 +20,16 @@
 using namespace ngraph;
 using namespace std;
 
+// Name of the records inserted to align the data of the record that follows
+static const string s_padding_name = ".pad";
+
+// Size of a record's header and even-padded name, i.e. the bytes preceding its data
+static size_t record_overhead(const string& name)
+{
+    size_t namesize = name.size() + 1;
+    return 26 + namesize + (namesize % 2);
+}
+
 static uint16_t read_u16(istream& stream, bool big_endian = false)
 {
     uint8_t ch[2];
@@ -135,6 +145,7 @@ void cpio::Header::write(ostream& stream, const string& name, uint32_t size)
 
 cpio::Writer::Writer()
     : m_stream(nullptr)
+    , m_position(0)
 {
 }
 
@@ -162,12 +173,14 @@ cpio::Writer::~Writer()
 void cpio::Writer::open(ostream& out)
 {
     m_stream = &out;
+    m_position = 0;
 }
 
 void cpio::Writer::open(const string& filename)
 {
     m_stream = &m_my_stream;
     m_my_stream.open(filename, ios_base::binary | ios_base::out);
+    m_position = 0;
 }
 
 void cpio::Writer::write(const string& record_name, const void* data, uint32_t size_in_bytes)
@@ -181,6 +194,7 @@ void cpio::Writer::write(const string& record_name, const void* data, uint32_t s
             char ch = 0;
             m_stream->write(&ch, 1);
         }
+        m_position += record_overhead(record_name) + size_in_bytes + (size_in_bytes % 2);
     }
     else
     {
@@ -188,6 +202,27 @@ void cpio::Writer::write(const string& record_name, const void* data, uint32_t s
     }
 }
 
+void cpio::Writer::write(const string& record_name,
+                         const void* data,
+                         uint32_t size_in_bytes,
+                         size_t alignment)
+{
+    if (alignment % 2)
+    {
+        throw runtime_error("cpio record alignment must be even");
+    }
+    size_t data_offset = m_position + record_overhead(record_name);
+    if (data_offset % alignment != 0)
+    {
+        // Records are even sized so the padding is even and adds no pad byte of its own
+        data_offset += record_overhead(s_padding_name);
+        size_t padding = (alignment - data_offset % alignment) % alignment;
+        vector<char> zeros(padding, 0);
+        write(s_padding_name, zeros.data(), static_cast<uint32_t>(padding));
+    }
+    write(record_name, data, size_in_bytes);
+}
+
 cpio::Reader::Reader()
     : m_stream(nullptr)
 {
@@ -254,7 +289,11 @@ const vector<cpio::FileInfo>& cpio::Reader::get_file_info()
             }
 
             size_t offset = m_stream->tellg();
-            m_file_info.emplace_back(file_name, header.filesize, offset);
+            if (file_name != s_padding_name)
+            {
+                m_file_index.insert({file_name, m_file_info.size()});
+                m_file_info.emplace_back(file_name, header.filesize, offset);
+            }
 
             m_stream->seekg((header.filesize % 2) + header.filesize, ios_base::cur);
         }
@@ -263,20 +302,23 @@ const vector<cpio::FileInfo>& cpio::Reader::get_file_info()
     return m_file_info;
 }
 
+const cpio::FileInfo* cpio::Reader::find(const string& file_name)
+{
+    const vector<FileInfo>& file_info = get_file_info();
+    auto it = m_file_index.find(file_name);
+    return it == m_file_index.end() ? nullptr : &file_info[it->second];
+}
+
 void cpio::Reader::read(const string& file_name, void* data, size_t size_in_bytes)
 {
-    for (const FileInfo& info : get_file_info())
+    if (const FileInfo* info = find(file_name))
     {
-        if (info.get_name() == file_name)
+        if (size_in_bytes != info->get_size())
         {
-            if (size_in_bytes != info.get_size())
-            {
-                throw runtime_error("Buffer size does not match file size");
-            }
-            m_stream->seekg(info.get_offset(), ios_base::beg);
-            m_stream->read(reinterpret_cast<char*>(data), size_in_bytes);
-            break;
+            throw runtime_error("Buffer size does not match file size");
         }
+        m_stream->seekg(info->get_offset(), ios_base::beg);
+        m_stream->read(reinterpret_cast<char*>(data), size_in_bytes);
     }
 }
 
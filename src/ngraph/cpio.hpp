@@ -19,6 +19,7 @@
 #include <fstream>
 #include <iostream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 // The CPIO file format can be found at
@@ -90,9 +91,18 @@ public:
     void open(const std::string& filename);
     void write(const std::string& file_name, const void* data, uint32_t size_in_bytes);
 
+    /// \brief Write a record whose data starts at a multiple of `alignment` bytes from the
+    ///     start of the archive. A padding record, which Reader skips, is inserted if needed.
+    /// \param alignment Required alignment of the data, must be even
+    void write(const std::string& file_name,
+               const void* data,
+               uint32_t size_in_bytes,
+               size_t alignment);
+
 private:
     std::ostream* m_stream;
     std::ofstream m_my_stream;
+    size_t m_position;
 };
 
 class ngraph::cpio::Reader
@@ -107,10 +117,15 @@ public:
     void open(const std::string& filename);
     void close();
     const std::vector<FileInfo>& get_file_info();
+
+    /// \brief Look up a record by name without scanning the archive
+    /// \returns The record's FileInfo or nullptr if there is no record named file_name
+    const FileInfo* find(const std::string& file_name);
     void read(const std::string& file_name, void* data, size_t size_in_bytes);
 
 private:
     std::istream* m_stream;
     std::ifstream m_my_stream;
     std::vector<cpio::FileInfo> m_file_info;
+    std::unordered_map<std::string, size_t> m_file_index;
 };
@@ -21,6 +21,7 @@
 #include <dirent.h>
 #include <ftw.h>
 #include <sys/file.h>
+#include <sys/mman.h>
 #include <sys/time.h>
 #include <unistd.h>
 #endif
@@ -237,6 +238,42 @@ string file_util::read_file_to_string(const string& path)
     return ss.str();
 }
 
+shared_ptr<char> file_util::map_file_contents(const string& path, size_t& size)
+{
+#ifdef _WIN32
+    auto contents = make_shared<vector<char>>(read_file_contents(path));
+    size = contents->size();
+    return shared_ptr<char>(contents, contents->data());
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1)
+    {
+        throw runtime_error("error opening file '" + path + "'");
+    }
+    struct stat st;
+    if (fstat(fd, &st) == -1)
+    {
+        close(fd);
+        throw runtime_error("error reading size of file '" + path + "'");
+    }
+    size = static_cast<size_t>(st.st_size);
+    if (size == 0)
+    {
+        close(fd);
+        return shared_ptr<char>(new char[1], default_delete<char[]>());
+    }
+    void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+    {
+        throw runtime_error("error mapping file '" + path + "'");
+    }
+    size_t mapped_size = size;
+    return shared_ptr<char>(static_cast<char*>(data),
+                            [mapped_size](char* p) { munmap(p, mapped_size); });
+#endif
+}
+
 #ifndef _WIN32
 static void iterate_files_worker(const string& path,
                                  function<void(const string& file, bool is_dir)> func,
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <functional>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -77,6 +78,15 @@ namespace ngraph
         /// \return string of the file's contents
         std::string read_file_to_string(const std::string& path);
 
+        /// \brief Maps the contents of a file into memory. The mapping is private, so writes
+        ///     through it are never seen by the file or by other processes, while unmodified
+        ///     pages are shared with every other mapping of the file.
+        /// \param path The path of the file to map
+        /// \param size Receives the size of the file in bytes
+        /// \return pointer to the start of the file's contents. The file stays mapped until the
+        ///     last copy of the pointer, including aliasing copies, is released.
+        std::shared_ptr<char> map_file_contents(const std::string& path, size_t& size);
+
         /// \brief Iterate through files and optionally directories. Symbolic links are skipped.
         /// \param path The path to iterate over
         /// \param func A callback function called with each file or directory encountered
@@ -0,0 +1,56 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "exceptions.hpp"
+#include "gather.hpp"
+#include "ngraph/op/gather.hpp"
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+        namespace op
+        {
+            namespace set_1
+            {
+                NodeVector gather(const Node& node)
+                {
+                    NodeVector inputs{node.get_ng_inputs()};
+                    auto data = inputs.at(0);
+                    auto indices = inputs.at(1);
+                    auto data_rank = static_cast<int64_t>(data->get_shape().size());
+
+                    auto axis = node.get_attribute_value<int64_t>("axis", 0);
+                    if (axis < 0)
+                    {
+                        axis = data_rank + axis;
+                    }
+
+                    ASSERT_VALID_ARGUMENT(node, axis >= 0 && axis < data_rank)
+                        << "provided 'axis' value:" << axis
+                        << " is out of input tensor dimensions range.";
+
+                    return {std::make_shared<ngraph::op::Gather>(
+                        data, indices, static_cast<size_t>(axis))};
+                }
+
+            } // namespace set_1
+
+        } //namespace op
+
+    } // namespace onnx_import
+
+} // namespace ngraph
@@ -45,6 +45,7 @@
 #include "op/exp.hpp"
 #include "op/flatten.hpp"
 #include "op/floor.hpp"
+#include "op/gather.hpp"
 #include "op/gemm.hpp"
 #include "op/global_average_pool.hpp"
 #include "op/global_max_pool.hpp"
@@ -175,6 +176,7 @@ namespace ngraph
             REGISTER_OPERATOR("Exp", 1, exp);
             REGISTER_OPERATOR("Flatten", 1, flatten);
             REGISTER_OPERATOR("Floor", 1, floor);
+            REGISTER_OPERATOR("Gather", 1, gather);
             REGISTER_OPERATOR("Gemm", 1, gemm);
             REGISTER_OPERATOR("GlobalAveragePool", 1, global_average_pool);
             REGISTER_OPERATOR("GlobalMaxPool", 1, global_max_pool);
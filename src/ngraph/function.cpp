@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <functional>
 #include <list>
 #include <memory>
 
@@ -34,6 +35,7 @@ Function::Function(const ResultVector& results,
     : m_results(results)
     , m_parameters(parameters)
     , m_temporary_pool_size(0)
+    , m_cache_pool_size(0)
     , m_instance_id(m_next_instance_id.fetch_add(1))
     , m_name(name)
     , m_unique_name("Function_" + to_string(m_instance_id))
@@ -47,6 +49,7 @@ Function::Function(const NodeVector& results,
     : m_results(results.size())
     , m_parameters(parameters)
     , m_temporary_pool_size(0)
+    , m_cache_pool_size(0)
     , m_instance_id(m_next_instance_id.fetch_add(1))
     , m_name(name)
     , m_unique_name("Function_" + to_string(m_instance_id))
@@ -99,9 +102,192 @@ void Function::init()
                    true /*include control dependencies*/);
 }
 
-std::list<shared_ptr<Node>> Function::get_ordered_ops(bool include_control_deps) const
+// Gap between the ranks of neighbouring nodes in a freshly built order
+static const size_t ordered_ops_rank_spacing = 1 << 16;
+
+Function::OrderedOps Function::get_ordered_ops(bool include_control_deps) const
+{
+    lock_guard<mutex> lock(m_ordered_ops_mutex);
+    OrderedOpsCache& ordered_ops = m_ordered_ops[include_control_deps];
+    if (!ordered_ops.valid || ordered_ops.graph_version != Node::get_graph_version())
+    {
+        build_ordered_ops(ordered_ops, include_control_deps);
+    }
+    return OrderedOps(ordered_ops.nodes);
+}
+
+void Function::OrderedOpsCache::clear()
 {
-    return topological_sort(get_ops(include_control_deps), include_control_deps);
+    valid = false;
+    nodes.reset();
+    positions.clear();
+    control_dependencies.clear();
+}
+
+void Function::build_ordered_ops(OrderedOpsCache& ordered_ops, bool include_control_deps) const
+{
+    // Let go of the stale order before sorting
+    ordered_ops.clear();
+    ordered_ops.graph_version = Node::get_graph_version();
+    ordered_ops.nodes = make_shared<list<shared_ptr<Node>>>(
+        topological_sort(get_ops(include_control_deps), include_control_deps));
+    size_t rank = 0;
+    for (auto it = ordered_ops.nodes->begin(); it != ordered_ops.nodes->end(); it++)
+    {
+        rank += ordered_ops_rank_spacing;
+        ordered_ops.positions[it->get()] = OrderedOpsCache::Position(it, rank);
+        if (include_control_deps)
+        {
+            for (auto& cdep : (*it)->get_control_dependencies())
+            {
+                ordered_ops.control_dependencies.insert(cdep.get());
+            }
+        }
+    }
+    ordered_ops.valid = true;
+}
+
+bool Function::repair_ordered_ops(OrderedOpsCache& ordered_ops,
+                                  bool include_control_deps,
+                                  const shared_ptr<Node>& old,
+                                  const shared_ptr<Node>& repl,
+                                  const NodeVector& old_users) const
+{
+    auto& positions = ordered_ops.positions;
+    if (positions.count(old.get()) == 0)
+    {
+        // the replacement happened outside of this function
+        return true;
+    }
+    if (ordered_ops.nodes.use_count() > 1)
+    {
+        // Someone still holds the current order, so patch a copy of it
+        ordered_ops.nodes = make_shared<list<shared_ptr<Node>>>(*ordered_ops.nodes);
+        for (auto it = ordered_ops.nodes->begin(); it != ordered_ops.nodes->end(); it++)
+        {
+            positions.at(it->get()).first = it;
+        }
+    }
+    auto& nodes = *ordered_ops.nodes;
+
+    // New nodes go right in front of the first of old's users
+    Node* first_user = nullptr;
+    for (auto& user : old_users)
+    {
+        auto position = positions.find(user.get());
+        if (position != positions.end() &&
+            (first_user == nullptr ||
+             position->second.second < positions.at(first_user).second))
+        {
+            first_user = user.get();
+        }
+    }
+    if (first_user == nullptr)
+    {
+        return false;
+    }
+
+    auto get_dependencies = [include_control_deps](const shared_ptr<Node>& node) {
+        NodeVector dependencies = node->get_arguments();
+        if (include_control_deps)
+        {
+            auto& cdeps = node->get_control_dependencies();
+            dependencies.insert(dependencies.end(), cdeps.begin(), cdeps.end());
+        }
+        return dependencies;
+    };
+
+    // Nodes the replacement brought into the function, dependencies first
+    NodeVector created;
+    unordered_set<Node*> visited;
+    function<void(const shared_ptr<Node>&)> discover = [&](const shared_ptr<Node>& node) {
+        if (positions.count(node.get()) != 0 || !visited.insert(node.get()).second)
+        {
+            return;
+        }
+        for (auto& dependency : get_dependencies(node))
+        {
+            discover(dependency);
+        }
+        created.push_back(node);
+    };
+    discover(repl);
+
+    auto next = positions.at(first_user).first;
+    size_t first_rank = next == nodes.begin() ? 0 : positions.at(prev(next)->get()).second;
+    size_t step = (positions.at(first_user).second - first_rank) / (created.size() + 1);
+    for (size_t i = 0; i < created.size(); i++)
+    {
+        positions[created[i].get()] =
+            OrderedOpsCache::Position(nodes.insert(next, created[i]), first_rank + (i + 1) * step);
+        if (include_control_deps)
+        {
+            for (auto& cdep : created[i]->get_control_dependencies())
+            {
+                ordered_ops.control_dependencies.insert(cdep.get());
+            }
+        }
+    }
+    if (step == 0)
+    {
+        size_t rank = 0;
+        for (auto it = nodes.begin(); it != nodes.end(); it++)
+        {
+            rank += ordered_ops_rank_spacing;
+            positions[it->get()].second = rank;
+        }
+    }
+
+    // A new node may depend on a node that comes after old's first user
+    for (auto& node : created)
+    {
+        for (auto& dependency : get_dependencies(node))
+        {
+            if (positions.at(dependency.get()).second >= positions.at(node.get()).second)
+            {
+                return false;
+            }
+        }
+    }
+    if (positions.at(repl.get()).second >= positions.at(first_user).second)
+    {
+        return false;
+    }
+
+    // Drop old and whatever only it kept in the function
+    vector<Node*> stack{old.get()};
+    while (!stack.empty())
+    {
+        Node* node = stack.back();
+        stack.pop_back();
+        auto position = positions.find(node);
+        if (position == positions.end() || node->is_output() || node->is_parameter())
+        {
+            continue;
+        }
+        bool used = false;
+        for (auto& user : node->get_users())
+        {
+            used = used || positions.count(user.get()) != 0;
+        }
+        if (used)
+        {
+            continue;
+        }
+        if (include_control_deps && (ordered_ops.control_dependencies.count(node) != 0 ||
+                                     !node->get_control_dependencies().empty()))
+        {
+            // still reachable through, or keeping alive, a control dependency
+            return false;
+        }
+        nodes.erase(position->second.first);
+        positions.erase(position);
+        for (auto& arg : node->get_arguments())
+        {
+            stack.push_back(arg.get());
+        }
+    }
+    return true;
 }
 
 const std::string& Function::get_friendly_name() const
@@ -189,5 +375,27 @@ std::list<shared_ptr<Node>> Function::get_ops(bool include_control_deps) const
 
 void Function::replace_node(std::shared_ptr<Node> old, std::shared_ptr<Node> repl)
 {
+    lock_guard<mutex> lock(m_ordered_ops_mutex);
+    size_t graph_version = Node::get_graph_version();
+    NodeVector old_users = old->get_users();
+
     ngraph::replace_node(old, repl);
+
+    // Every reconnected input changes the graph version once; any other change means the
+    // graph was also edited elsewhere and the cached orders can't be repaired
+    bool repairable = Node::get_graph_version() == graph_version + old_users.size();
+    for (bool include_control_deps : {false, true})
+    {
+        auto& ordered_ops = m_ordered_ops[include_control_deps];
+        ordered_ops.valid = ordered_ops.valid && ordered_ops.graph_version == graph_version &&
+                            repairable &&
+                            repair_ordered_ops(
+                                ordered_ops, include_control_deps, old, repl, old_users);
+        ordered_ops.graph_version = Node::get_graph_version();
+        if (!ordered_ops.valid)
+        {
+            // Don't keep the replaced nodes alive until the next get_ordered_ops
+            ordered_ops.clear();
+        }
+    }
 }
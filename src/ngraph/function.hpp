@@ -20,7 +20,11 @@
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "ngraph/node.hpp"
@@ -33,6 +37,31 @@ namespace ngraph
     class Function
     {
     public:
+        /// A topological order of the ops of a Function. The order is shared with the
+        /// Function's cache and never changes, so it stays valid while the graph is edited;
+        /// edits only show up in orders obtained afterwards.
+        class OrderedOps
+        {
+        public:
+            using NodeList = std::list<std::shared_ptr<Node>>;
+            using const_iterator = NodeList::const_iterator;
+
+            OrderedOps(const std::shared_ptr<const NodeList>& nodes)
+                : m_nodes(nodes)
+            {
+            }
+
+            const_iterator begin() const { return m_nodes->begin(); }
+            const_iterator end() const { return m_nodes->end(); }
+            size_t size() const { return m_nodes->size(); }
+            bool empty() const { return m_nodes->empty(); }
+            const std::shared_ptr<Node>& front() const { return m_nodes->front(); }
+            const std::shared_ptr<Node>& back() const { return m_nodes->back(); }
+            operator const NodeList&() const { return *m_nodes; }
+        private:
+            std::shared_ptr<const NodeList> m_nodes;
+        };
+
         Function(const NodeVector& results,
                  const ParameterVector& parameters,
                  const std::string& name = "");
@@ -77,12 +106,21 @@ namespace ngraph
         //  an XLA or regular function
         void set_name(const std::string& name);
         std::list<std::shared_ptr<Node>> get_ops(bool include_control_deps = true) const;
-        std::list<std::shared_ptr<Node>> get_ordered_ops(bool include_control_deps = true) const;
+        /// Returns the ops in topological order. The order is cached and shared with the caller
+        /// until an edge changes. The graph version is process-wide (see
+        /// Node::get_graph_version), so an edit to any graph invalidates the order of every
+        /// Function. Only \sa replace_node patches the order in place; edits made with
+        /// ngraph::replace_node and the other graph_util helpers cause a re-sort on the next call.
+        OrderedOps get_ordered_ops(bool include_control_deps = true) const;
         friend std::ostream& operator<<(std::ostream&, const Function&);
         size_t get_instance_id() { return m_instance_id; }
         size_t get_temporary_pool_size();
         void set_temporary_pool_size(size_t);
-        // updates graph and m_results list
+        /// Size of the pool that keeps the outputs of cacheable ops between calls; see
+        /// pass::MemoryLayout
+        size_t get_cache_pool_size() const { return m_cache_pool_size; }
+        void set_cache_pool_size(size_t size) { m_cache_pool_size = size; }
+        // updates graph and m_results list, and keeps the cached topological order up to date
         void replace_node(std::shared_ptr<Node> old, std::shared_ptr<Node> repl);
 
         void validate_nodes_and_infer_types();
@@ -91,12 +129,40 @@ namespace ngraph
         ResultVector m_results;
         ParameterVector m_parameters;
         size_t m_temporary_pool_size;
+        size_t m_cache_pool_size;
 
     private:
         Function(const Function&) = delete;
         Function(const Function&&) = delete;
         Function& operator=(const Function&) = delete;
 
+        // A cached topological order. Ranks grow along the order with gaps, so nodes can be
+        // inserted without renumbering the whole order
+        struct OrderedOpsCache
+        {
+            using Position = std::pair<std::list<std::shared_ptr<Node>>::iterator, size_t>;
+
+            void clear();
+
+            bool valid = false;
+            size_t graph_version = 0;
+            // Shared with the OrderedOps handed out; copied before it is patched while shared
+            std::shared_ptr<std::list<std::shared_ptr<Node>>> nodes;
+            std::unordered_map<Node*, Position> positions;
+            // Nodes that some node in the order has as a control dependency
+            std::unordered_set<Node*> control_dependencies;
+        };
+        void build_ordered_ops(OrderedOpsCache& ordered_ops, bool include_control_deps) const;
+        bool repair_ordered_ops(OrderedOpsCache& ordered_ops,
+                                bool include_control_deps,
+                                const std::shared_ptr<Node>& old,
+                                const std::shared_ptr<Node>& repl,
+                                const NodeVector& old_users) const;
+
+        mutable std::mutex m_ordered_ops_mutex;
+        // Indexed by include_control_deps
+        mutable OrderedOpsCache m_ordered_ops[2];
+
         static std::atomic<size_t> m_next_instance_id;
         size_t m_instance_id;
         std::string m_name;
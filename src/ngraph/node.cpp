@@ -31,12 +31,19 @@ using namespace std;
 using namespace ngraph;
 
 atomic<size_t> Node::m_next_instance_id(0);
+atomic<size_t> Node::m_graph_version(0);
+
+// Per thread so that counting the nodes one piece of work allocated isn't skewed by other
+// threads building graphs at the same time
+static thread_local size_t s_thread_instance_count = 0;
 
 Node::Node(const std::string& node_type, const NodeVector& arguments, size_t output_size)
     : m_node_type(node_type)
     , m_instance_id(m_next_instance_id.fetch_add(1))
     , m_unique_name(description() + "_" + to_string(m_instance_id))
 {
+    s_thread_instance_count++;
+
     // Add this node as a user of each argument.
     size_t i = 0;
     for (auto arg : arguments)
@@ -49,6 +56,11 @@ Node::Node(const std::string& node_type, const NodeVector& arguments, size_t out
     set_output_size(output_size);
 }
 
+size_t Node::get_thread_instance_count()
+{
+    return s_thread_instance_count;
+}
+
 // While we are still doing validation and type inference in the constructor, this is true
 // The #define can be commented out to debug doing validation/inference after construction.
 // When that is working, these two functions will be removed.
@@ -198,6 +210,7 @@ const std::set<std::shared_ptr<Node>>& Node::get_control_dependencies() const
 void Node::add_control_dependency(std::shared_ptr<Node> node)
 {
     m_control_dependencies.insert(node);
+    graph_changed();
 }
 
 std::vector<std::shared_ptr<Function>> Node::get_functions() const
@@ -143,6 +143,8 @@ namespace ngraph
         virtual bool is_op() const { return false; }
         virtual bool is_commutative() { return false; }
         size_t get_instance_id() const { return m_instance_id; }
+        /// \return the number of nodes the calling thread has constructed so far
+        static size_t get_thread_instance_count();
         friend std::ostream& operator<<(std::ostream&, const Node&);
         virtual std::ostream& write_short_description(std::ostream&) const;
         virtual std::ostream& write_long_description(std::ostream&) const;
@@ -166,8 +168,16 @@ namespace ngraph
         void remove_control_dependency(std::shared_ptr<Node> node)
         {
             m_control_dependencies.erase(node);
+            graph_changed();
         }
 
+        /// Returns a counter that changes whenever an input of any node is reconnected or a
+        /// control dependency is added or removed, so analyses of a graph can be cached. Nodes
+        /// don't know which Function they belong to, so the counter is shared by all graphs.
+        static size_t get_graph_version() { return m_graph_version; }
+        /// Records a change to the edges between existing nodes
+        static void graph_changed() { m_graph_version++; }
+
         /// Returns the number of outputs on the for the node.
         size_t get_output_size() const;
 
@@ -262,6 +272,7 @@ namespace ngraph
         std::string m_name;
         const std::string m_unique_name;
         static std::atomic<size_t> m_next_instance_id;
+        static std::atomic<size_t> m_graph_version;
         std::deque<descriptor::Input> m_inputs;
         std::deque<descriptor::Output> m_outputs;
         std::unordered_map<Node*, autodiff::Adjoints> m_adjoint_map;
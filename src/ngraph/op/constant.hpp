@@ -105,6 +105,23 @@ namespace ngraph
                 constructor_validate_and_infer_types();
             }
 
+            /// \brief Constructs a tensor constant that uses existing data without copying it.
+            ///        The constant keeps the data alive, so `data` may alias a larger owner
+            ///        such as a memory-mapped model file.
+            ///
+            /// \param type The element type of the tensor constant.
+            /// \param shape The shape of the tensor constant.
+            /// \param data The constant data, at least shape_size(shape) elements of type.
+            Constant(const element::Type& type, const Shape& shape, std::shared_ptr<void> data)
+                : Node("Constant", {})
+                , m_element_type(type)
+                , m_shape(shape)
+                , m_data(data.get())
+                , m_shared_data(data)
+            {
+                constructor_validate_and_infer_types();
+            }
+
             virtual ~Constant() override;
 
             void validate_and_infer_types() override
@@ -264,6 +281,8 @@ namespace ngraph
             element::Type m_element_type;
             Shape m_shape{};
             void* m_data{nullptr};
+            // Set when m_data is borrowed rather than allocated by this constant
+            std::shared_ptr<void> m_shared_data;
             Constant(const Constant&) = delete;
             Constant operator=(const Constant&) = delete;
         };
@@ -44,10 +44,9 @@ namespace ngraph
 
             void validate_and_infer_types() override;
 
-            void generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas) override
-            {
-                throw ngraph_error("Not yet implemented");
-            }
+            /// The gradient of the weights is delta added to the looked up rows, see
+            /// autodiff::Adjoints::get_row_deltas; the indices have no gradient.
+            void generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas) override;
 
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
@@ -0,0 +1,75 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "quantized_dot.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+op::QuantizedDot::QuantizedDot(const shared_ptr<Node>& data,
+                               const shared_ptr<Node>& weights,
+                               const shared_ptr<Node>& scale,
+                               const element::Type& output_type)
+    : Op("QuantizedDot", check_single_output_args({data, weights, scale}))
+    , m_output_type(output_type)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::QuantizedDot::validate_and_infer_types()
+{
+    auto& data_et = get_input_element_type(0);
+    auto& weights_et = get_input_element_type(1);
+
+    NODE_VALIDATION_ASSERT(this, data_et == element::u8 || data_et == element::i8)
+        << "Data must be u8 or i8 (data element type: " << data_et << ").";
+
+    NODE_VALIDATION_ASSERT(this, weights_et == element::i8)
+        << "Weights must be i8 (weights element type: " << weights_et << ").";
+
+    NODE_VALIDATION_ASSERT(this, get_input_element_type(2) == element::f32)
+        << "Scale must be f32 (scale element type: " << get_input_element_type(2) << ").";
+
+    NODE_VALIDATION_ASSERT(this,
+                           m_output_type == element::i8 || m_output_type == element::u8 ||
+                               m_output_type == element::i32 || m_output_type == element::f32)
+        << "Output element type must be i8, u8, i32 or f32 (output element type: "
+        << m_output_type << ").";
+
+    auto& data_shape = get_input_shape(0);
+    auto& weights_shape = get_input_shape(1);
+
+    NODE_VALIDATION_ASSERT(this, data_shape.size() == 2)
+        << "Data must have rank 2 (data shape: " << data_shape << ").";
+
+    NODE_VALIDATION_ASSERT(this, weights_shape.size() == 2)
+        << "Weights must have rank 2 (weights shape: " << weights_shape << ").";
+
+    NODE_VALIDATION_ASSERT(this, data_shape[1] == weights_shape[0])
+        << "Reduction axes do not match (data shape: " << data_shape
+        << ", weights shape: " << weights_shape << ").";
+
+    NODE_VALIDATION_ASSERT(this, shape_size(get_input_shape(2)) == 1)
+        << "Scale must be a scalar (scale shape: " << get_input_shape(2) << ").";
+
+    set_output_type(0, m_output_type, Shape{data_shape[0], weights_shape[1]});
+}
+
+shared_ptr<Node> op::QuantizedDot::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<QuantizedDot>(new_args.at(0), new_args.at(1), new_args.at(2), m_output_type);
+}
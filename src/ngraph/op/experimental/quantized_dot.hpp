@@ -0,0 +1,55 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/op/op.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Matrix product of quantized data and weights, accumulated in i32.
+        ///
+        /// The accumulator is multiplied by `scale` and, for integer output types,
+        /// rounded to nearest even and saturated.
+        class QuantizedDot : public Op
+        {
+        public:
+            /// \brief Constructs a quantized dot product.
+            ///
+            /// \param data The u8 or i8 input, of shape [M, K].
+            /// \param weights The i8 weights, of shape [K, N].
+            /// \param scale The f32 scalar that maps the accumulator to the output.
+            /// \param output_type The output element type: i8, u8, i32 or f32.
+            QuantizedDot(const std::shared_ptr<Node>& data,
+                         const std::shared_ptr<Node>& weights,
+                         const std::shared_ptr<Node>& scale,
+                         const element::Type& output_type);
+
+            void validate_and_infer_types() override;
+
+            const element::Type& get_output_type() const { return m_output_type; }
+            std::shared_ptr<Node> get_data() { return get_argument(0); }
+            std::shared_ptr<Node> get_weights() { return get_argument(1); }
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+        protected:
+            element::Type m_output_type;
+        };
+    }
+}
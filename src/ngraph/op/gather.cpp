@@ -0,0 +1,138 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/gather.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/scatter_add.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+op::Gather::Gather(const shared_ptr<Node>& data, const shared_ptr<Node>& indices, size_t axis)
+    : Op("Gather", check_single_output_args({data, indices}))
+    , m_axis(axis)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::Gather::validate_and_infer_types()
+{
+    element::Type indices_et = get_input_element_type(1);
+
+    NODE_VALIDATION_ASSERT(this,
+                           indices_et.is_dynamic() || indices_et == element::i32 ||
+                               indices_et == element::i64)
+        << "Indices element type must be i32 or i64 (element type: " << indices_et << ").";
+
+    const PartialShape& data_shape = get_input_partial_shape(0);
+    const PartialShape& indices_shape = get_input_partial_shape(1);
+
+    NODE_VALIDATION_ASSERT(this,
+                           data_shape.rank().is_dynamic() ||
+                               m_axis < static_cast<size_t>(data_shape.rank()))
+        << "Gather axis " << m_axis << " is out of bounds for data shape " << data_shape << ".";
+
+    PartialShape result_shape;
+    if (data_shape.rank().is_static() && indices_shape.rank().is_static())
+    {
+        std::vector<Dimension> result_dims;
+        for (size_t i = 0; i < m_axis; i++)
+        {
+            result_dims.push_back(data_shape[i]);
+        }
+        for (size_t i = 0; i < static_cast<size_t>(indices_shape.rank()); i++)
+        {
+            result_dims.push_back(indices_shape[i]);
+        }
+        for (size_t i = m_axis + 1; i < static_cast<size_t>(data_shape.rank()); i++)
+        {
+            result_dims.push_back(data_shape[i]);
+        }
+        result_shape = PartialShape(result_dims);
+    }
+    else
+    {
+        result_shape = PartialShape::dynamic();
+    }
+
+    set_output_type(0, get_input_element_type(0), result_shape);
+}
+
+shared_ptr<Node> op::Gather::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<Gather>(new_args.at(0), new_args.at(1), m_axis);
+}
+
+void op::Gather::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas)
+{
+    auto delta = deltas.at(0);
+
+    auto data = get_argument(0);
+    auto indices = get_argument(1);
+
+    Shape data_shape = data->get_shape();
+    size_t indices_rank = indices->get_shape().size();
+
+    // ScatterAdd indexes the first axis, so move the gathered axis to the front of the
+    // data and the indices axes to the front of delta, then move it back afterwards
+    shared_ptr<Node> updates = delta;
+    Shape rows_shape{data_shape.at(m_axis)};
+    if (m_axis != 0)
+    {
+        AxisVector delta_order;
+        for (size_t i = 0; i < indices_rank; i++)
+        {
+            delta_order.push_back(m_axis + i);
+        }
+        for (size_t i = 0; i < delta->get_shape().size(); i++)
+        {
+            if (i < m_axis || i >= m_axis + indices_rank)
+            {
+                delta_order.push_back(i);
+            }
+        }
+        updates = make_shared<op::Reshape>(
+            delta, delta_order, apply_permutation(delta->get_shape(), delta_order));
+    }
+    for (size_t i = 0; i < data_shape.size(); i++)
+    {
+        if (i != m_axis)
+        {
+            rows_shape.push_back(data_shape[i]);
+        }
+    }
+
+    auto zero = make_zero(data->get_element_type(), rows_shape);
+    shared_ptr<Node> data_delta = make_shared<op::ScatterAdd>(zero, indices, updates);
+    if (m_axis != 0)
+    {
+        AxisVector data_order;
+        for (size_t i = 1; i <= m_axis; i++)
+        {
+            data_order.push_back(i);
+        }
+        data_order.push_back(0);
+        for (size_t i = m_axis + 1; i < data_shape.size(); i++)
+        {
+            data_order.push_back(i);
+        }
+        data_delta = make_shared<op::Reshape>(data_delta, data_order, data_shape);
+    }
+    adjoints.add_delta(data, data_delta);
+}
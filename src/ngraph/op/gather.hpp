@@ -0,0 +1,72 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/op/op.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Gathers slices of a tensor along one axis, at the positions given by indices.
+        ///
+        /// ## Inputs
+        ///
+        /// |           | Type                                         | Description                                                   |
+        /// | --------- | -------------------------------------------- | ------------------------------------------------------------- |
+        /// | `data`    | \f$E[d_0,\dots,d_a,\dots,d_n]~(n \geq 0)\f$  | The tensor to gather from.                                    |
+        /// | `indices` | \f$I[k_1,\dots,k_m]~(m \geq 0)\f$            | Positions along axis \f$a\f$ of `data`; `I` is `i32` or `i64`. |
+        ///
+        /// ## Attributes
+        ///
+        /// |        | Description                                  |
+        /// | ------ | -------------------------------------------- |
+        /// | `axis` | The axis \f$a\f$ of `data` that is indexed.  |
+        ///
+        /// ## Output
+        ///
+        /// | Type                                                          | Description                                                                                                        |
+        /// | ------------------------------------------------------------- | ------------------------------------------------------------------------------------------------------------------ |
+        /// | \f$E[d_0,\dots,d_{a-1},k_1,\dots,k_m,d_{a+1},\dots,d_n]\f$    | The slices \f$\texttt{data}[\dots,\texttt{indices}[k],\dots]\f$. Slices for indices outside \f$[0,d_a)\f$ are zero. |
+        class Gather : public Op
+        {
+        public:
+            /// \brief Constructs a gather operation.
+            ///
+            /// \param data The tensor to gather slices from.
+            /// \param indices The positions of the slices along `axis`.
+            /// \param axis The axis of `data` that `indices` refer to.
+            Gather(const std::shared_ptr<Node>& data,
+                   const std::shared_ptr<Node>& indices,
+                   size_t axis = 0);
+
+            size_t get_axis() const { return m_axis; }
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+        protected:
+            void validate_and_infer_types() override;
+            /// The gradient of `data` is a ScatterAdd of delta into zeros, so only the gathered
+            /// slices are touched; the indices have no gradient.
+            virtual void generate_adjoints(autodiff::Adjoints& adjoints,
+                                           const NodeVector& deltas) override;
+
+        private:
+            size_t m_axis;
+        };
+    }
+}
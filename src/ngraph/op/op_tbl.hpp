@@ -79,6 +79,7 @@ NGRAPH_OP(Equal, ngraph::op)
 NGRAPH_OP(Exp, ngraph::op)
 NGRAPH_OP(Floor, ngraph::op)
 NGRAPH_OP(FunctionCall, ngraph::op)
+NGRAPH_OP(Gather, ngraph::op)
 NGRAPH_OP(GenerateMask, ngraph::op)
 NGRAPH_OP(GetOutputElement, ngraph::op)
 NGRAPH_OP(Greater, ngraph::op)
@@ -114,6 +115,7 @@ NGRAPH_OP(Result, ngraph::op)
 NGRAPH_OP(Reverse, ngraph::op)
 NGRAPH_OP(ReverseSequence, ngraph::op)
 NGRAPH_OP(ScalarConstantLike, ngraph::op)
+NGRAPH_OP(ScatterAdd, ngraph::op)
 NGRAPH_OP(Select, ngraph::op)
 NGRAPH_OP(SelectAndScatter, ngraph::op)
 NGRAPH_OP(ShapeOf, ngraph::op)
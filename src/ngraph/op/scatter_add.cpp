@@ -0,0 +1,113 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/scatter_add.hpp"
+#include "ngraph/op/embedding_lookup.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+op::ScatterAdd::ScatterAdd(const shared_ptr<Node>& inputs,
+                           const shared_ptr<Node>& indices,
+                           const shared_ptr<Node>& updates)
+    : Op("ScatterAdd", check_single_output_args({inputs, indices, updates}))
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::ScatterAdd::validate_and_infer_types()
+{
+    element::Type indices_et = get_input_element_type(1);
+
+    NODE_VALIDATION_ASSERT(this,
+                           indices_et.is_dynamic() || indices_et == element::i32 ||
+                               indices_et == element::i64)
+        << "Indices element type must be i32 or i64 (element type: " << indices_et << ").";
+
+    element::Type result_et;
+
+    NODE_VALIDATION_ASSERT(
+        this, element::Type::merge(result_et, get_input_element_type(0), get_input_element_type(2)))
+        << "Inputs and updates element types are inconsistent.";
+
+    const PartialShape& inputs_shape = get_input_partial_shape(0);
+    const PartialShape& indices_shape = get_input_partial_shape(1);
+    const PartialShape& updates_shape = get_input_partial_shape(2);
+
+    NODE_VALIDATION_ASSERT(
+        this, inputs_shape.rank().is_dynamic() || static_cast<size_t>(inputs_shape.rank()) >= 1)
+        << "Inputs must have at least one axis to index.";
+
+    if (inputs_shape.rank().is_static() && indices_shape.rank().is_static())
+    {
+        size_t inputs_rank = static_cast<size_t>(inputs_shape.rank());
+        size_t indices_rank = static_cast<size_t>(indices_shape.rank());
+
+        std::vector<Dimension> expected_dims;
+        for (size_t i = 0; i < indices_rank; i++)
+        {
+            expected_dims.push_back(indices_shape[i]);
+        }
+        for (size_t i = 1; i < inputs_rank; i++)
+        {
+            expected_dims.push_back(inputs_shape[i]);
+        }
+
+        NODE_VALIDATION_ASSERT(this, updates_shape.compatible(PartialShape(expected_dims)))
+            << "Updates shape " << updates_shape << " is not the indices shape "
+            << indices_shape << " followed by the row shape of inputs " << inputs_shape << ".";
+    }
+
+    set_output_type(0, result_et, inputs_shape);
+}
+
+shared_ptr<Node> op::ScatterAdd::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<ScatterAdd>(new_args.at(0), new_args.at(1), new_args.at(2));
+}
+
+void op::ScatterAdd::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas)
+{
+    auto delta = deltas.at(0);
+
+    auto inputs = get_argument(0);
+    auto indices = get_argument(1);
+    auto updates = get_argument(2);
+
+    adjoints.add_delta(inputs, delta);
+
+    // The gradient for every update is the row of delta it was added to; look the rows
+    // up as a matrix and restore the shape of updates
+    Shape delta_shape = delta->get_shape();
+    Shape rows_shape{delta_shape.at(0),
+                     shape_size(Shape(delta_shape.begin() + 1, delta_shape.end()))};
+    shared_ptr<Node> rows = delta;
+    if (rows_shape != delta_shape)
+    {
+        rows = make_shared<op::Reshape>(delta, get_default_order(delta_shape), rows_shape);
+    }
+    shared_ptr<Node> updates_delta = make_shared<op::EmbeddingLookup>(indices, rows);
+    if (updates_delta->get_shape() != updates->get_shape())
+    {
+        updates_delta = make_shared<op::Reshape>(updates_delta,
+                                                 get_default_order(updates_delta->get_shape()),
+                                                 updates->get_shape());
+    }
+    adjoints.add_delta(updates, updates_delta);
+}
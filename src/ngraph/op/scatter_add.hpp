@@ -0,0 +1,65 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/op/op.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Adds rows of updates into a copy of a tensor, at the rows given by indices.
+        ///
+        /// This is the sparse form of a gradient with respect to an embedding table: only the
+        /// rows that were looked up are touched, so the work scales with the number of indices
+        /// rather than with the size of the table.
+        ///
+        /// ## Inputs
+        ///
+        /// |           | Type                                         | Description                                                   |
+        /// | --------- | -------------------------------------------- | ------------------------------------------------------------- |
+        /// | `inputs`  | \f$E[d_0,d_1,\dots,d_n]~(n \geq 0)\f$        | The tensor the rows are added into.                           |
+        /// | `indices` | \f$I[k_1,\dots,k_m]~(m \geq 0)\f$            | Rows of `inputs`; `I` is `i32` or `i64`.                      |
+        /// | `updates` | \f$E[k_1,\dots,k_m,d_1,\dots,d_n]\f$         | One row for every index.                                      |
+        ///
+        /// ## Output
+        ///
+        /// | Type                         | Description                                                                                                                                   |
+        /// | ---------------------------- | --------------------------------------------------------------------------------------------------------------------------------------------- |
+        /// | \f$E[d_0,d_1,\dots,d_n]\f$   | `inputs`, where every row \f$\texttt{indices}[k]\f$ has \f$\texttt{updates}[k]\f$ added to it. Repeated indices accumulate; indices outside \f$[0,d_0)\f$ are ignored. |
+        class ScatterAdd : public Op
+        {
+        public:
+            /// \brief Constructs a scatter-add operation.
+            ///
+            /// \param inputs The tensor to add rows into.
+            /// \param indices The rows of `inputs` to update.
+            /// \param updates The rows to add, one for every element of `indices`.
+            ScatterAdd(const std::shared_ptr<Node>& inputs,
+                       const std::shared_ptr<Node>& indices,
+                       const std::shared_ptr<Node>& updates);
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+        protected:
+            void validate_and_infer_types() override;
+            virtual void generate_adjoints(autodiff::Adjoints& adjoints,
+                                           const NodeVector& deltas) override;
+        };
+    }
+}
@@ -0,0 +1,116 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/and.hpp"
+#include "ngraph/op/convert.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/or.hpp"
+#include "ngraph/op/util/reducer.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+#define TI(x) type_index(typeid(x))
+
+// A Convert to `to` loses nothing for values of type `from`
+static bool is_widening(const element::Type& from, const element::Type& to)
+{
+    if (from == to)
+    {
+        return true;
+    }
+    return from.is_real() == to.is_real() && from.is_signed() == to.is_signed() &&
+           !from.is_quantized() && !to.is_quantized() && to.bitwidth() > from.bitwidth();
+}
+
+// Skips a widening Convert of an `element_type` value
+static shared_ptr<Node> skip_convert(const shared_ptr<Node>& node,
+                                     const element::Type& element_type)
+{
+    if (auto convert = dynamic_pointer_cast<op::Convert>(node))
+    {
+        auto arg = convert->get_argument(0);
+        if (arg->get_element_type() == element_type &&
+            is_widening(element_type, convert->get_element_type()))
+        {
+            return arg;
+        }
+    }
+    return node;
+}
+
+op::util::ReducerKind op::util::get_reducer_kind(const shared_ptr<Function>& function)
+{
+    static const unordered_map<type_index, ReducerKind> kinds{
+        {TI(op::Add), ReducerKind::Add},
+        {TI(op::Multiply), ReducerKind::Multiply},
+        {TI(op::Maximum), ReducerKind::Maximum},
+        {TI(op::Minimum), ReducerKind::Minimum},
+        {TI(op::And), ReducerKind::And},
+        {TI(op::Or), ReducerKind::Or}};
+
+    auto& params = function->get_parameters();
+    auto& results = function->get_results();
+    if (params.size() != 2 || results.size() != 1)
+    {
+        return ReducerKind::Unknown;
+    }
+    auto element_type = results.at(0)->get_element_type();
+    for (auto& param : params)
+    {
+        if (param->get_element_type() != element_type || param->get_shape() != Shape{})
+        {
+            return ReducerKind::Unknown;
+        }
+    }
+    if (results.at(0)->get_shape() != Shape{})
+    {
+        return ReducerKind::Unknown;
+    }
+
+    auto root = results.at(0)->get_argument(0);
+    if (auto convert = dynamic_pointer_cast<op::Convert>(root))
+    {
+        // The narrowing Convert back to the function type undoes a widening of the arguments
+        root = convert->get_argument(0);
+        if (!is_widening(element_type, root->get_element_type()))
+        {
+            return ReducerKind::Unknown;
+        }
+    }
+
+    auto kind = kinds.find(TI(*root));
+    if (kind == kinds.end() || root->get_input_size() != 2)
+    {
+        return ReducerKind::Unknown;
+    }
+    auto arg0 = skip_convert(root->get_argument(0), element_type);
+    auto arg1 = skip_convert(root->get_argument(1), element_type);
+    bool uses_both_params = (arg0 == params.at(0) && arg1 == params.at(1)) ||
+                            (arg0 == params.at(1) && arg1 == params.at(0));
+    if (!uses_both_params)
+    {
+        return ReducerKind::Unknown;
+    }
+    return kind->second;
+}
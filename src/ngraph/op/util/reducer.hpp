@@ -0,0 +1,50 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+
+#include "ngraph/function.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        namespace util
+        {
+            /// \brief The standard monoids a reduction function can be recognised as.
+            enum class ReducerKind
+            {
+                Unknown,
+                Add,
+                Multiply,
+                Maximum,
+                Minimum,
+                And,
+                Or
+            };
+
+            /// \brief Classifies the reduction function of an op::Reduce or op::ReduceWindow.
+            ///
+            /// A function is recognised when it applies a single Add, Multiply, Maximum,
+            /// Minimum, And or Or to its two scalar parameters, optionally computing in a
+            /// wider type of the same kind through Converts of both parameters and of the
+            /// result. Anything else is ReducerKind::Unknown and must be called as a function.
+            ReducerKind get_reducer_kind(const std::shared_ptr<Function>& function);
+        }
+    }
+}
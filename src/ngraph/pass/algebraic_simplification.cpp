@@ -31,8 +31,10 @@
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/log.hpp"
 #include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
 #include "ngraph/op/product.hpp"
 #include "ngraph/op/reshape.hpp"
+#include "ngraph/op/scatter_add.hpp"
 #include "ngraph/op/slice.hpp"
 #include "ngraph/op/subtract.hpp"
 #include "ngraph/op/sum.hpp"
@@ -248,6 +250,83 @@ static bool simplify_concat(std::shared_ptr<Node> n)
     return true;
 }
 
+// Returns `n` if it is a ScatterAdd into zeros, i.e. a sparse gradient of rows
+static std::shared_ptr<op::ScatterAdd> get_sparse_rows(std::shared_ptr<Node> n)
+{
+    auto scatter_add = std::dynamic_pointer_cast<op::ScatterAdd>(n);
+    if (!scatter_add)
+    {
+        return nullptr;
+    }
+    auto base = scatter_add->get_argument(0);
+    if (auto bcst = std::dynamic_pointer_cast<op::Broadcast>(base))
+    {
+        base = bcst->get_argument(0);
+    }
+    return ngraph::is_zero(base) ? scatter_add : nullptr;
+}
+
+//`simplify_sparse_rows` keeps sparse row gradients from being densified
+//
+//a + scatter_add(0, i, r) -> scatter_add(a, i, r)
+//a - scatter_add(0, i, r) -> scatter_add(a, i, -r)
+//broadcast(c) * scatter_add(0, i, r) -> scatter_add(0, i, broadcast(c) * r)
+static bool simplify_sparse_rows(std::shared_ptr<Node> n)
+{
+    for (size_t i = 0; i < 2; i++)
+    {
+        auto rows = get_sparse_rows(n->get_argument(i));
+        if (!rows || (i == 0 && std::dynamic_pointer_cast<op::Subtract>(n)))
+        {
+            continue;
+        }
+        auto other = n->get_argument(1 - i);
+        auto indices = rows->get_argument(1);
+        auto updates = rows->get_argument(2);
+
+        std::shared_ptr<Node> replacement;
+        if (std::dynamic_pointer_cast<op::Add>(n))
+        {
+            replacement = std::make_shared<op::ScatterAdd>(other, indices, updates);
+        }
+        else if (std::dynamic_pointer_cast<op::Subtract>(n))
+        {
+            replacement = std::make_shared<op::ScatterAdd>(
+                other, indices, std::make_shared<op::Negative>(updates));
+        }
+        else if (auto bcst = std::dynamic_pointer_cast<op::Broadcast>(other))
+        {
+            auto scalar = bcst->get_argument(0);
+            if (shape_size(scalar->get_shape()) != 1)
+            {
+                continue;
+            }
+            if (scalar->get_shape() != Shape{})
+            {
+                scalar = std::make_shared<op::Reshape>(
+                    scalar, get_default_order(scalar->get_shape()), Shape{});
+            }
+            AxisSet axes;
+            for (size_t axis = 0; axis < updates->get_shape().size(); axis++)
+            {
+                axes.insert(axis);
+            }
+            auto scale = std::make_shared<op::Broadcast>(scalar, updates->get_shape(), axes);
+            replacement = std::make_shared<op::ScatterAdd>(
+                rows->get_argument(0), indices, std::make_shared<op::Multiply>(scale, updates));
+        }
+
+        if (replacement)
+        {
+            NGRAPH_DEBUG << " Replacing " << n->get_name() << " with a ScatterAdd of "
+                         << rows->get_name() << "'s rows";
+            ngraph::replace_node(n, replacement);
+            return true;
+        }
+    }
+    return false;
+}
+
 //`simplify_multiply` optimizes the following 4 *base* cases
 //(8 cases in total including variants due to commutativity)
 //
@@ -285,7 +364,7 @@ static bool simplify_multiply(std::shared_ptr<Node> n)
         return true;
     }
 
-    return false;
+    return simplify_sparse_rows(n);
 }
 
 //`simplify_add` optimizes the following 2 *base* cases
@@ -320,7 +399,7 @@ static bool simplify_add(std::shared_ptr<Node> n)
             NGRAPH_DEBUG << cnst->get_name() << " not equal to 0 ";
         }
     }
-    return false;
+    return simplify_sparse_rows(n);
 }
 
 //`simplify_log` optimizes `log(exp(x)/y)` into `x - log(y)`
@@ -475,6 +554,7 @@ static std::unordered_map<std::type_index, std::function<bool(std::shared_ptr<No
     return std::unordered_map<std::type_index, std::function<bool(std::shared_ptr<Node>)>>(
         {{TI(op::Add), simplify_add},
          {TI(op::Multiply), simplify_multiply},
+         {TI(op::Subtract), simplify_sparse_rows},
          {TI(op::Concat), simplify_concat},
          {TI(op::Sum),
           std::function<bool(std::shared_ptr<Node>)>{
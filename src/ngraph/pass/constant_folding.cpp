@@ -14,41 +14,131 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
 #include <stdint.h>
+#include <thread>
+#include <unordered_set>
 
 #include "constant_folding.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/op/abs.hpp"
+#include "ngraph/op/acos.hpp"
 #include "ngraph/op/add.hpp"
+#include "ngraph/op/and.hpp"
+#include "ngraph/op/argmax.hpp"
+#include "ngraph/op/argmin.hpp"
+#include "ngraph/op/asin.hpp"
+#include "ngraph/op/atan.hpp"
 #include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/ceiling.hpp"
+#include "ngraph/op/concat.hpp"
 #include "ngraph/op/constant.hpp"
+#include "ngraph/op/convert.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/cos.hpp"
+#include "ngraph/op/cosh.hpp"
 #include "ngraph/op/dequantize.hpp"
 #include "ngraph/op/divide.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/equal.hpp"
+#include "ngraph/op/exp.hpp"
+#include "ngraph/op/floor.hpp"
+#include "ngraph/op/greater.hpp"
+#include "ngraph/op/greater_eq.hpp"
+#include "ngraph/op/less.hpp"
+#include "ngraph/op/less_eq.hpp"
+#include "ngraph/op/log.hpp"
+#include "ngraph/op/max.hpp"
 #include "ngraph/op/maximum.hpp"
+#include "ngraph/op/min.hpp"
 #include "ngraph/op/minimum.hpp"
 #include "ngraph/op/multiply.hpp"
 #include "ngraph/op/negative.hpp"
+#include "ngraph/op/not.hpp"
+#include "ngraph/op/not_equal.hpp"
+#include "ngraph/op/one_hot.hpp"
+#include "ngraph/op/or.hpp"
 #include "ngraph/op/pad.hpp"
+#include "ngraph/op/power.hpp"
+#include "ngraph/op/product.hpp"
 #include "ngraph/op/quantize.hpp"
 #include "ngraph/op/relu.hpp"
+#include "ngraph/op/replace_slice.hpp"
 #include "ngraph/op/reshape.hpp"
+#include "ngraph/op/reverse.hpp"
+#include "ngraph/op/select.hpp"
+#include "ngraph/op/sigmoid.hpp"
+#include "ngraph/op/sign.hpp"
+#include "ngraph/op/sin.hpp"
+#include "ngraph/op/sinh.hpp"
+#include "ngraph/op/slice.hpp"
+#include "ngraph/op/sqrt.hpp"
 #include "ngraph/op/subtract.hpp"
+#include "ngraph/op/sum.hpp"
+#include "ngraph/op/tan.hpp"
+#include "ngraph/op/tanh.hpp"
+#include "ngraph/op/util/arithmetic_reduction.hpp"
+#include "ngraph/op/util/index_reduction.hpp"
 #include "ngraph/pattern/matcher.hpp"
 #include "ngraph/pattern/op/label.hpp"
 #include "ngraph/runtime/reference/abs.hpp"
+#include "ngraph/runtime/reference/acos.hpp"
 #include "ngraph/runtime/reference/add.hpp"
+#include "ngraph/runtime/reference/and.hpp"
+#include "ngraph/runtime/reference/argmax.hpp"
+#include "ngraph/runtime/reference/argmin.hpp"
+#include "ngraph/runtime/reference/asin.hpp"
+#include "ngraph/runtime/reference/atan.hpp"
 #include "ngraph/runtime/reference/broadcast.hpp"
+#include "ngraph/runtime/reference/ceiling.hpp"
+#include "ngraph/runtime/reference/concat.hpp"
+#include "ngraph/runtime/reference/convert.hpp"
+#include "ngraph/runtime/reference/convolution.hpp"
+#include "ngraph/runtime/reference/cos.hpp"
+#include "ngraph/runtime/reference/cosh.hpp"
 #include "ngraph/runtime/reference/dequantize.hpp"
 #include "ngraph/runtime/reference/divide.hpp"
+#include "ngraph/runtime/reference/dot.hpp"
+#include "ngraph/runtime/reference/equal.hpp"
+#include "ngraph/runtime/reference/exp.hpp"
+#include "ngraph/runtime/reference/floor.hpp"
+#include "ngraph/runtime/reference/greater.hpp"
+#include "ngraph/runtime/reference/greater_eq.hpp"
+#include "ngraph/runtime/reference/less.hpp"
+#include "ngraph/runtime/reference/less_eq.hpp"
+#include "ngraph/runtime/reference/log.hpp"
+#include "ngraph/runtime/reference/max.hpp"
 #include "ngraph/runtime/reference/maximum.hpp"
+#include "ngraph/runtime/reference/min.hpp"
 #include "ngraph/runtime/reference/minimum.hpp"
 #include "ngraph/runtime/reference/multiply.hpp"
 #include "ngraph/runtime/reference/negate.hpp"
+#include "ngraph/runtime/reference/not.hpp"
+#include "ngraph/runtime/reference/not_equal.hpp"
+#include "ngraph/runtime/reference/one_hot.hpp"
+#include "ngraph/runtime/reference/or.hpp"
 #include "ngraph/runtime/reference/pad.hpp"
+#include "ngraph/runtime/reference/power.hpp"
+#include "ngraph/runtime/reference/product.hpp"
 #include "ngraph/runtime/reference/quantize.hpp"
 #include "ngraph/runtime/reference/relu.hpp"
+#include "ngraph/runtime/reference/replace_slice.hpp"
 #include "ngraph/runtime/reference/reshape.hpp"
+#include "ngraph/runtime/reference/reverse.hpp"
+#include "ngraph/runtime/reference/select.hpp"
+#include "ngraph/runtime/reference/sigmoid.hpp"
+#include "ngraph/runtime/reference/sign.hpp"
+#include "ngraph/runtime/reference/sin.hpp"
+#include "ngraph/runtime/reference/sinh.hpp"
+#include "ngraph/runtime/reference/slice.hpp"
+#include "ngraph/runtime/reference/sqrt.hpp"
 #include "ngraph/runtime/reference/subtract.hpp"
+#include "ngraph/runtime/reference/sum.hpp"
+#include "ngraph/runtime/reference/tan.hpp"
+#include "ngraph/runtime/reference/tanh.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -620,3 +710,706 @@ void ngraph::pass::ConstantFolding::construct_constant_quantize()
         quant, constant_quantize_callback, "ConstantFolding.ConstantQuantize");
     this->add_matcher(quantize_matcher);
 }
+
+// Folds that produce at least this many elements are split across threads
+static const size_t s_parallel_fold_elements = 1 << 16;
+
+namespace
+{
+    // Worker threads shared by all folds in the process. They are started on the first large
+    // fold, so folding many constants neither starts threads per fold nor oversubscribes the
+    // machine when several functions are compiled at once.
+    class FoldThreadPool
+    {
+    public:
+        static FoldThreadPool& get()
+        {
+            static FoldThreadPool pool(std::max(std::thread::hardware_concurrency(), 1u) - 1);
+            return pool;
+        }
+
+        size_t get_thread_count() const { return m_threads.size(); }
+        void submit(std::function<void()> task)
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_tasks.push_back(move(task));
+            }
+            m_task_ready.notify_one();
+        }
+
+        ~FoldThreadPool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stopping = true;
+            }
+            m_task_ready.notify_all();
+            for (auto& th : m_threads)
+            {
+                th.join();
+            }
+        }
+
+    private:
+        FoldThreadPool(size_t thread_count)
+        {
+            for (size_t i = 0; i < thread_count; i++)
+            {
+                m_threads.emplace_back([this]() { run(); });
+            }
+        }
+
+        void run()
+        {
+            while (true)
+            {
+                std::function<void()> task;
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    m_task_ready.wait(lock, [this] { return m_stopping || !m_tasks.empty(); });
+                    if (m_tasks.empty())
+                    {
+                        return;
+                    }
+                    task = move(m_tasks.front());
+                    m_tasks.pop_front();
+                }
+                task();
+            }
+        }
+
+        std::mutex m_mutex;
+        std::condition_variable m_task_ready;
+        std::deque<std::function<void()>> m_tasks;
+        bool m_stopping = false;
+        std::vector<std::thread> m_threads;
+    };
+}
+
+// Calls f(begin, end) on consecutive chunks of [0, count). When the fold produces enough
+// work_elements, all but the first chunk run on the shared FoldThreadPool while the calling
+// thread runs the first; small folds stay on the calling thread.
+template <typename F>
+static void parallel_fold(size_t count, size_t work_elements, F f)
+{
+    size_t thread_count =
+        std::min<size_t>({FoldThreadPool::get().get_thread_count() + 1,
+                          std::max<size_t>(work_elements / s_parallel_fold_elements, 1),
+                          std::max<size_t>(count, 1)});
+    if (thread_count <= 1)
+    {
+        f(0, count);
+        return;
+    }
+
+    size_t chunk = (count + thread_count - 1) / thread_count;
+    vector<exception_ptr> errors(thread_count);
+    auto run_chunk = [&f, &errors, chunk, count](size_t t) {
+        size_t begin = std::min(t * chunk, count);
+        size_t end = std::min(begin + chunk, count);
+        try
+        {
+            f(begin, end);
+        }
+        catch (...)
+        {
+            errors[t] = current_exception();
+        }
+    };
+
+    std::mutex mutex;
+    std::condition_variable chunks_done;
+    size_t pending_chunks = thread_count - 1;
+    for (size_t t = 1; t < thread_count; t++)
+    {
+        FoldThreadPool::get().submit([&run_chunk, &mutex, &chunks_done, &pending_chunks, t]() {
+            run_chunk(t);
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--pending_chunks == 0)
+            {
+                chunks_done.notify_one();
+            }
+        });
+    }
+    run_chunk(0);
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        chunks_done.wait(lock, [&pending_chunks] { return pending_chunks == 0; });
+    }
+    for (auto& error : errors)
+    {
+        if (error)
+        {
+            rethrow_exception(error);
+        }
+    }
+}
+
+static bool is_supported_evaluate_op(const Node& node)
+{
+    static const unordered_set<string> supported_ops{
+        "Abs", "Acos", "Add", "And", "ArgMax", "ArgMin", "Asin", "Atan", "Broadcast", "Ceiling",
+        "Concat", "Convert", "Convolution", "Cos", "Cosh", "Divide", "Dot", "Equal", "Exp",
+        "Floor", "Greater", "GreaterEq", "Less", "LessEq", "Log", "Max", "Maximum", "Min",
+        "Minimum", "Multiply", "Negative", "Not", "NotEqual", "OneHot", "Or", "Pad", "Power",
+        "Product", "Relu", "ReplaceSlice", "Reshape", "Reverse", "Select", "Sigmoid", "Sign",
+        "Sin", "Sinh", "Slice", "Sqrt", "Subtract", "Sum", "Tan", "Tanh"};
+    return supported_ops.count(node.description()) != 0;
+}
+
+template <typename TI>
+static void evaluate_convert(
+    const TI* arg, void* out, const element::Type& type, size_t begin, size_t end)
+{
+    size_t count = end - begin;
+    if (type == element::boolean)
+    {
+        runtime::reference::convert<TI>(arg + begin, static_cast<char*>(out) + begin, count);
+    }
+    else if (type == element::f32)
+    {
+        runtime::reference::convert<TI>(arg + begin, static_cast<float*>(out) + begin, count);
+    }
+    else if (type == element::f64)
+    {
+        runtime::reference::convert<TI>(arg + begin, static_cast<double*>(out) + begin, count);
+    }
+    else if (type == element::i8)
+    {
+        runtime::reference::convert<TI>(arg + begin, static_cast<int8_t*>(out) + begin, count);
+    }
+    else if (type == element::i16)
+    {
+        runtime::reference::convert<TI>(arg + begin, static_cast<int16_t*>(out) + begin, count);
+    }
+    else if (type == element::i32)
+    {
+        runtime::reference::convert<TI>(arg + begin, static_cast<int32_t*>(out) + begin, count);
+    }
+    else if (type == element::i64)
+    {
+        runtime::reference::convert<TI>(arg + begin, static_cast<int64_t*>(out) + begin, count);
+    }
+    else if (type == element::u8)
+    {
+        runtime::reference::convert<TI>(arg + begin, static_cast<uint8_t*>(out) + begin, count);
+    }
+    else if (type == element::u16)
+    {
+        runtime::reference::convert<TI>(arg + begin, static_cast<uint16_t*>(out) + begin, count);
+    }
+    else if (type == element::u32)
+    {
+        runtime::reference::convert<TI>(arg + begin, static_cast<uint32_t*>(out) + begin, count);
+    }
+    else if (type == element::u64)
+    {
+        runtime::reference::convert<TI>(arg + begin, static_cast<uint64_t*>(out) + begin, count);
+    }
+    else
+    {
+        throw ngraph_error("Unsupported element type " + type.c_type_string() + " for Convert");
+    }
+}
+
+// Runs the reference kernel of node on the constant data in args. T is the element type of the
+// data argument: the first one, or the second one for Select.
+template <typename T>
+static void evaluate_node(const Node& node, const vector<const void*>& args, void* out)
+{
+    const string& op = node.description();
+    const Shape& out_shape = node.get_output_shape(0);
+    size_t count = shape_size(out_shape);
+    const T* arg0 = static_cast<const T*>(args[0]);
+    const T* arg1 = args.size() > 1 ? static_cast<const T*>(args[1]) : nullptr;
+    T* out_data = static_cast<T*>(out);
+
+    auto unary = [&](void (*kernel)(const T*, T*, size_t)) {
+        parallel_fold(count, count, [&](size_t begin, size_t end) {
+            kernel(arg0 + begin, out_data + begin, end - begin);
+        });
+    };
+    auto binary = [&](void (*kernel)(const T*, const T*, T*, size_t)) {
+        parallel_fold(count, count, [&](size_t begin, size_t end) {
+            kernel(arg0 + begin, arg1 + begin, out_data + begin, end - begin);
+        });
+    };
+    auto comparison = [&](void (*kernel)(const T*, const T*, char*, size_t)) {
+        parallel_fold(count, count, [&](size_t begin, size_t end) {
+            kernel(arg0 + begin, arg1 + begin, static_cast<char*>(out) + begin, end - begin);
+        });
+    };
+
+    if (op == "Abs")
+    {
+        unary(runtime::reference::abs<T>);
+    }
+    else if (op == "Acos")
+    {
+        unary(runtime::reference::acos<T>);
+    }
+    else if (op == "Asin")
+    {
+        unary(runtime::reference::asin<T>);
+    }
+    else if (op == "Atan")
+    {
+        unary(runtime::reference::atan<T>);
+    }
+    else if (op == "Ceiling")
+    {
+        unary(runtime::reference::ceiling<T>);
+    }
+    else if (op == "Cos")
+    {
+        unary(runtime::reference::cos<T>);
+    }
+    else if (op == "Cosh")
+    {
+        unary(runtime::reference::cosh<T>);
+    }
+    else if (op == "Exp")
+    {
+        unary(runtime::reference::exp<T>);
+    }
+    else if (op == "Floor")
+    {
+        unary(runtime::reference::floor<T>);
+    }
+    else if (op == "Log")
+    {
+        unary(runtime::reference::log<T>);
+    }
+    else if (op == "Negative")
+    {
+        unary(runtime::reference::negate<T>);
+    }
+    else if (op == "Not")
+    {
+        unary(runtime::reference::logical_not<T>);
+    }
+    else if (op == "Relu")
+    {
+        unary(runtime::reference::relu<T>);
+    }
+    else if (op == "Sigmoid")
+    {
+        unary(runtime::reference::sigmoid<T>);
+    }
+    else if (op == "Sign")
+    {
+        unary(runtime::reference::sign<T>);
+    }
+    else if (op == "Sin")
+    {
+        unary(runtime::reference::sin<T>);
+    }
+    else if (op == "Sinh")
+    {
+        unary(runtime::reference::sinh<T>);
+    }
+    else if (op == "Sqrt")
+    {
+        unary(runtime::reference::sqrt<T>);
+    }
+    else if (op == "Tan")
+    {
+        unary(runtime::reference::tan<T>);
+    }
+    else if (op == "Tanh")
+    {
+        unary(runtime::reference::tanh<T>);
+    }
+    else if (op == "Add")
+    {
+        binary(runtime::reference::add<T>);
+    }
+    else if (op == "And")
+    {
+        binary(runtime::reference::logical_and<T>);
+    }
+    else if (op == "Divide")
+    {
+        binary(runtime::reference::divide<T>);
+    }
+    else if (op == "Maximum")
+    {
+        binary(runtime::reference::maximum<T>);
+    }
+    else if (op == "Minimum")
+    {
+        binary(runtime::reference::minimum<T>);
+    }
+    else if (op == "Multiply")
+    {
+        binary(runtime::reference::multiply<T>);
+    }
+    else if (op == "Or")
+    {
+        binary(runtime::reference::logical_or<T>);
+    }
+    else if (op == "Power")
+    {
+        binary(runtime::reference::power<T>);
+    }
+    else if (op == "Subtract")
+    {
+        binary(runtime::reference::subtract<T>);
+    }
+    else if (op == "Equal")
+    {
+        comparison(runtime::reference::equal<T>);
+    }
+    else if (op == "Greater")
+    {
+        comparison(runtime::reference::greater<T>);
+    }
+    else if (op == "GreaterEq")
+    {
+        comparison(runtime::reference::greater_eq<T>);
+    }
+    else if (op == "Less")
+    {
+        comparison(runtime::reference::less<T>);
+    }
+    else if (op == "LessEq")
+    {
+        comparison(runtime::reference::less_eq<T>);
+    }
+    else if (op == "NotEqual")
+    {
+        comparison(runtime::reference::not_equal<T>);
+    }
+    else if (op == "Select")
+    {
+        const char* condition = static_cast<const char*>(args[0]);
+        const T* arg2 = static_cast<const T*>(args[2]);
+        parallel_fold(count, count, [&](size_t begin, size_t end) {
+            runtime::reference::select<T>(condition + begin,
+                                          arg1 + begin,
+                                          arg2 + begin,
+                                          out_data + begin,
+                                          end - begin);
+        });
+    }
+    else if (op == "Convert")
+    {
+        parallel_fold(count, count, [&](size_t begin, size_t end) {
+            evaluate_convert<T>(arg0, out, node.get_output_element_type(0), begin, end);
+        });
+    }
+    else if (op == "ArgMax" || op == "ArgMin")
+    {
+        size_t axis = static_cast<const op::util::IndexReduction&>(node).get_reduction_axis();
+        auto index_type = node.get_output_element_type(0);
+        if (index_type == element::i64)
+        {
+            auto kernel = op == "ArgMax" ? runtime::reference::argmax<T, int64_t>
+                                         : runtime::reference::argmin<T, int64_t>;
+            kernel(arg0, static_cast<int64_t*>(out), node.get_input_shape(0), out_shape, axis);
+        }
+        else if (index_type == element::i32)
+        {
+            auto kernel = op == "ArgMax" ? runtime::reference::argmax<T, int32_t>
+                                         : runtime::reference::argmin<T, int32_t>;
+            kernel(arg0, static_cast<int32_t*>(out), node.get_input_shape(0), out_shape, axis);
+        }
+        else
+        {
+            throw ngraph_error("Unsupported index element type " +
+                               index_type.c_type_string() + " for " + op);
+        }
+    }
+    else if (op == "Broadcast")
+    {
+        auto& broadcast = static_cast<const op::Broadcast&>(node);
+        runtime::reference::broadcast<T>(arg0,
+                                         out_data,
+                                         node.get_input_shape(0),
+                                         out_shape,
+                                         broadcast.get_broadcast_axes());
+    }
+    else if (op == "Concat")
+    {
+        vector<const T*> in_args;
+        vector<Shape> in_shapes;
+        for (size_t i = 0; i < node.get_input_size(); i++)
+        {
+            in_args.push_back(static_cast<const T*>(args[i]));
+            in_shapes.push_back(node.get_input_shape(i));
+        }
+        auto& concat = static_cast<const op::Concat&>(node);
+        runtime::reference::concat<T>(
+            in_args, out_data, in_shapes, out_shape, concat.get_concatenation_axis());
+    }
+    else if (op == "OneHot")
+    {
+        runtime::reference::one_hot<T>(arg0,
+                                       out_data,
+                                       node.get_input_shape(0),
+                                       out_shape,
+                                       static_cast<const op::OneHot&>(node).get_one_hot_axis());
+    }
+    else if (op == "Pad")
+    {
+        auto& pad = static_cast<const op::Pad&>(node);
+        runtime::reference::pad<T>(arg0,
+                                   arg1,
+                                   out_data,
+                                   node.get_input_shape(0),
+                                   out_shape,
+                                   pad.get_padding_below(),
+                                   pad.get_padding_above(),
+                                   pad.get_padding_interior());
+    }
+    else if (op == "ReplaceSlice")
+    {
+        auto& slice = static_cast<const op::ReplaceSlice&>(node);
+        runtime::reference::replace_slice<T>(arg0,
+                                             arg1,
+                                             out_data,
+                                             node.get_input_shape(1),
+                                             slice.get_lower_bounds(),
+                                             slice.get_upper_bounds(),
+                                             slice.get_strides(),
+                                             out_shape);
+    }
+    else if (op == "Reshape")
+    {
+        runtime::reference::reshape<T>(arg0,
+                                       out_data,
+                                       node.get_input_shape(0),
+                                       static_cast<const op::Reshape&>(node).get_input_order(),
+                                       out_shape);
+    }
+    else if (op == "Reverse")
+    {
+        runtime::reference::reverse<T>(arg0,
+                                       out_data,
+                                       node.get_input_shape(0),
+                                       out_shape,
+                                       static_cast<const op::Reverse&>(node).get_reversed_axes());
+    }
+    else if (op == "Slice")
+    {
+        auto& slice = static_cast<const op::Slice&>(node);
+        runtime::reference::slice<T>(arg0,
+                                     out_data,
+                                     node.get_input_shape(0),
+                                     slice.get_lower_bounds(),
+                                     slice.get_upper_bounds(),
+                                     slice.get_strides(),
+                                     out_shape);
+    }
+    else if (op == "Sum" || op == "Product" || op == "Max" || op == "Min")
+    {
+        auto kernel = op == "Sum" ? runtime::reference::sum<T>
+                                  : op == "Product" ? runtime::reference::product<T>
+                                                    : op == "Max" ? runtime::reference::max<T>
+                                                                  : runtime::reference::min<T>;
+        kernel(arg0,
+               out_data,
+               node.get_input_shape(0),
+               out_shape,
+               static_cast<const op::util::ArithmeticReduction&>(node).get_reduction_axes());
+    }
+    else if (op == "Dot")
+    {
+        // Rows of arg0 map to leading rows of the output, so they are folded independently
+        auto& dot = static_cast<const op::Dot&>(node);
+        const Shape& arg0_shape = node.get_input_shape(0);
+        const Shape& arg1_shape = node.get_input_shape(1);
+        size_t reduction_axes_count = dot.get_reduction_axes_count();
+        bool split = arg0_shape.size() > reduction_axes_count;
+        size_t rows = split ? arg0_shape[0] : 1;
+        size_t arg0_row_size = rows ? shape_size(arg0_shape) / rows : 0;
+        size_t out_row_size = rows ? count / rows : 0;
+        size_t dot_size = shape_size(
+            Shape(arg0_shape.end() - reduction_axes_count, arg0_shape.end()));
+        parallel_fold(rows, count * dot_size, [&](size_t begin, size_t end) {
+            Shape arg0_chunk_shape = arg0_shape;
+            Shape out_chunk_shape = out_shape;
+            if (split)
+            {
+                arg0_chunk_shape[0] = end - begin;
+                out_chunk_shape[0] = end - begin;
+            }
+            runtime::reference::dot<T>(arg0 + begin * arg0_row_size,
+                                       arg1,
+                                       out_data + begin * out_row_size,
+                                       arg0_chunk_shape,
+                                       arg1_shape,
+                                       out_chunk_shape,
+                                       reduction_axes_count);
+        });
+    }
+    else if (op == "Convolution")
+    {
+        // Every image of the batch is folded independently
+        auto& conv = static_cast<const op::Convolution&>(node);
+        const Shape& data_shape = node.get_input_shape(0);
+        const Shape& filters_shape = node.get_input_shape(1);
+        size_t batch = data_shape[0];
+        size_t data_image_size = batch ? shape_size(data_shape) / batch : 0;
+        size_t out_image_size = batch ? count / batch : 0;
+        size_t work = count * (filters_shape[0] ? shape_size(filters_shape) / filters_shape[0] : 0);
+        parallel_fold(batch, work, [&](size_t begin, size_t end) {
+            Shape data_chunk_shape = data_shape;
+            Shape out_chunk_shape = out_shape;
+            data_chunk_shape[0] = end - begin;
+            out_chunk_shape[0] = end - begin;
+            runtime::reference::convolution<T>(arg0 + begin * data_image_size,
+                                               arg1,
+                                               out_data + begin * out_image_size,
+                                               data_chunk_shape,
+                                               filters_shape,
+                                               out_chunk_shape,
+                                               conv.get_window_movement_strides(),
+                                               conv.get_window_dilation_strides(),
+                                               conv.get_padding_below(),
+                                               conv.get_padding_above(),
+                                               conv.get_data_dilation_strides(),
+                                               0,
+                                               1,
+                                               1,
+                                               0,
+                                               0,
+                                               1,
+                                               false);
+        });
+    }
+    else
+    {
+        NGRAPH_ASSERT(false) << "evaluate_node must be consistent with is_supported_evaluate_op";
+    }
+}
+
+static shared_ptr<op::Constant> make_constant_evaluate(const shared_ptr<Node>& node)
+{
+    vector<const void*> args;
+    for (auto arg : node->get_arguments())
+    {
+        args.push_back(static_pointer_cast<op::Constant>(arg)->get_data_ptr());
+    }
+
+    auto out_type = node->get_output_element_type(0);
+    auto out_shape = node->get_output_shape(0);
+    vector<char> out(shape_size(out_shape) * out_type.size());
+
+    auto type = node->get_input_element_type(node->description() == "Select" ? 1 : 0);
+    if (type == element::boolean)
+    {
+        evaluate_node<char>(*node, args, out.data());
+    }
+    else if (type == element::f32)
+    {
+        evaluate_node<float>(*node, args, out.data());
+    }
+    else if (type == element::f64)
+    {
+        evaluate_node<double>(*node, args, out.data());
+    }
+    else if (type == element::i8)
+    {
+        evaluate_node<int8_t>(*node, args, out.data());
+    }
+    else if (type == element::i16)
+    {
+        evaluate_node<int16_t>(*node, args, out.data());
+    }
+    else if (type == element::i32)
+    {
+        evaluate_node<int32_t>(*node, args, out.data());
+    }
+    else if (type == element::i64)
+    {
+        evaluate_node<int64_t>(*node, args, out.data());
+    }
+    else if (type == element::u8)
+    {
+        evaluate_node<uint8_t>(*node, args, out.data());
+    }
+    else if (type == element::u16)
+    {
+        evaluate_node<uint16_t>(*node, args, out.data());
+    }
+    else if (type == element::u32)
+    {
+        evaluate_node<uint32_t>(*node, args, out.data());
+    }
+    else if (type == element::u64)
+    {
+        evaluate_node<uint64_t>(*node, args, out.data());
+    }
+    else
+    {
+        return nullptr;
+    }
+
+    return make_shared<op::Constant>(out_type, out_shape, out.data());
+}
+
+void ngraph::pass::ConstantFolding::construct_constant_evaluate()
+{
+    auto is_foldable = [](shared_ptr<Node> n) {
+        if (n->is_constant() || n->get_output_size() != 1 || !is_supported_evaluate_op(*n))
+        {
+            return false;
+        }
+        for (auto arg : n->get_arguments())
+        {
+            if (!arg->is_constant())
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+    auto foldable = make_shared<pattern::op::Label>(element::f32, Shape{}, is_foldable);
+
+    size_t max_folded_bytes = m_max_folded_bytes;
+    auto constant_evaluate_callback = [max_folded_bytes](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for constant_evaluate_callback against node = "
+                     << m.get_match_root()->get_name();
+
+        auto node = m.get_match_root();
+
+        size_t in_bytes = 0;
+        for (auto arg : node->get_arguments())
+        {
+            in_bytes += shape_size(arg->get_shape()) * arg->get_element_type().size();
+        }
+        size_t out_bytes =
+            shape_size(node->get_output_shape(0)) * node->get_output_element_type(0).size();
+        if (out_bytes > max_folded_bytes && out_bytes > in_bytes)
+        {
+            NGRAPH_DEBUG << "Not folding " << node->get_name() << ": " << out_bytes
+                         << " bytes exceed the limit of " << max_folded_bytes;
+            return false;
+        }
+
+        shared_ptr<op::Constant> folded;
+        try
+        {
+            folded = make_constant_evaluate(node);
+        }
+        catch (const std::exception& e)
+        {
+            // e.g. an integer division by zero; leave the op to fail when it is executed
+            NGRAPH_DEBUG << "Not folding " << node->get_name() << ": " << e.what();
+            return false;
+        }
+        if (!folded)
+        {
+            return false;
+        }
+
+        replace_node(node, folded);
+        return true;
+    };
+
+    auto evaluate_matcher = make_shared<pattern::Matcher>(
+        foldable, constant_evaluate_callback, "ConstantFolding.ConstantEvaluate");
+    this->add_matcher(evaluate_matcher);
+}
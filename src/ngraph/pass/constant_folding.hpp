@@ -37,11 +37,16 @@ public:
         DEQUANTIZE,
         UNARY,
         BINARY,
-        QUANTIZE
+        QUANTIZE,
+        EVALUATE
     };
 
-    ConstantFolding()
+    /// \param max_folded_bytes Ops whose folded result would be larger than this, and larger
+    ///        than their constant inputs together, are left in the graph so that they do not
+    ///        bloat the constants.
+    ConstantFolding(size_t max_folded_bytes = 16 * 1024 * 1024)
         : GraphRewrite()
+        , m_max_folded_bytes(max_folded_bytes)
     {
         construct_constant_reshape();
         construct_constant_broadcast();
@@ -50,12 +55,15 @@ public:
         construct_constant_binary();
         construct_constant_quantize();
         construct_constant_dequantize();
+        construct_constant_evaluate();
     }
 
     //this allows to specify the order in which matchers will be run
     //and also allows to register the same matcher more than once
-    ConstantFolding(const std::vector<CFTransformations>& transformations)
+    ConstantFolding(const std::vector<CFTransformations>& transformations,
+                    size_t max_folded_bytes = 16 * 1024 * 1024)
         : GraphRewrite()
+        , m_max_folded_bytes(max_folded_bytes)
     {
         for (auto cft : transformations)
         {
@@ -68,6 +76,7 @@ public:
             case CFTransformations::BINARY: construct_constant_binary(); break;
             case CFTransformations::DEQUANTIZE: construct_constant_dequantize(); break;
             case CFTransformations::QUANTIZE: construct_constant_quantize(); break;
+            case CFTransformations::EVALUATE: construct_constant_evaluate(); break;
             }
         }
     }
@@ -80,4 +89,8 @@ private:
     void construct_constant_binary();
     void construct_constant_quantize();
     void construct_constant_dequantize();
+    // Folds any other op whose arguments are all constants by running its reference kernel
+    void construct_constant_evaluate();
+
+    size_t m_max_folded_bytes;
 };
@@ -16,13 +16,22 @@
 
 #include <algorithm>
 #include <iostream>
+#include <list>
 #include <regex>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
 #include "graph_rewrite.hpp"
+#include "ngraph/function.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/pattern/matcher.hpp"
+#include "ngraph/pattern/op/pattern.hpp"
+
+using namespace std;
+using namespace ngraph;
 
 // GraphRewrite algorithm:
 // GraphRewrite processes an input graph in an topological order(i.e. args before users)
@@ -55,41 +64,398 @@
 // b) you are modifying nodes after the current node in the topological order
 // c) there's no linear order of fusions which will give
 //    the correct final fusion. i.e. the same fusion needs to occur before and after some other fusion
+//
+// Work-list:
+// Matchers are indexed by the op type at the root of their pattern, so a node is only tried
+// against matchers that can possibly match it (plus the ones rooted at a Label, Any or Skip).
+// The topological order is computed once per run and kept up to date after every rewrite:
+// the nodes a callback creates are found by walking back from the users of the matched nodes
+// and are slotted right in front of the current root, and the nodes a rewrite disconnects are
+// skipped and dropped from the order. Only if a callback wires a new node to an argument that
+// comes *after* the root does the order have to be recomputed.
+// Further passes requested from callbacks that only re-register matchers (told apart by name)
+// which already ran over the whole graph don't revisit it either: a pattern of depth `d` can
+// only start to match at a node at most `d - 1` users away from an edge that changed, so only
+// those nodes are visited (in topological order).
+
+namespace
+{
+    // Topological order of the nodes GraphRewrite visits. Ranks are spaced out so nodes
+    // created by a callback can be placed in front of the current root without
+    // renumbering the rest of the graph
+    class RewriteOrder
+    {
+    public:
+        using iterator = list<shared_ptr<Node>>::iterator;
+
+        void build(const shared_ptr<Function>& f)
+        {
+            m_nodes.clear();
+            m_positions.clear();
+            for (auto& node : f->get_ordered_ops())
+            {
+                m_nodes.push_back(node);
+                m_positions[node.get()].it = prev(m_nodes.end());
+            }
+            renumber();
+        }
+
+        iterator begin() { return m_nodes.begin(); }
+        iterator end() { return m_nodes.end(); }
+        bool contains(Node* node) const { return m_positions.count(node) != 0; }
+        size_t rank(Node* node) const { return m_positions.at(node).rank; }
+        iterator find(Node* node) const { return m_positions.at(node).it; }
+        // Places `nodes` (args before users) in front of `pos`. Returns false if one of them
+        // uses a node that comes after `pos`, which leaves the order inconsistent
+        bool insert_before(iterator pos, const NodeVector& nodes)
+        {
+            size_t first = pos == m_nodes.begin() ? 0 : rank(prev(pos)->get());
+            size_t last = rank(pos->get());
+            size_t step = (last - first) / (nodes.size() + 1);
+            for (size_t i = 0; i < nodes.size(); i++)
+            {
+                m_positions[nodes[i].get()] = {m_nodes.insert(pos, nodes[i]),
+                                               first + (i + 1) * step};
+            }
+            if (step == 0)
+            {
+                renumber();
+            }
+
+            for (auto& node : nodes)
+            {
+                for (auto& arg : node->get_arguments())
+                {
+                    if (rank(arg.get()) >= rank(node.get()))
+                    {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        void erase(Node* node)
+        {
+            auto position = m_positions.find(node);
+            m_nodes.erase(position->second.it);
+            m_positions.erase(position);
+        }
+
+    private:
+        struct Position
+        {
+            iterator it;
+            size_t rank;
+        };
+
+        void renumber()
+        {
+            size_t rank = 0;
+            for (auto& node : m_nodes)
+            {
+                rank += s_spacing;
+                m_positions[node.get()].rank = rank;
+            }
+        }
+
+        static const size_t s_spacing = 1 << 16;
+        list<shared_ptr<Node>> m_nodes;
+        unordered_map<Node*, Position> m_positions;
+    };
+
+    size_t get_pattern_depth(const shared_ptr<Node>& pattern)
+    {
+        size_t depth = 0;
+        for (auto& arg : pattern->get_arguments())
+        {
+            depth = max(depth, get_pattern_depth(arg));
+        }
+        return depth + 1;
+    }
+}
 
 bool ngraph::pass::GraphRewrite::run_on_function(std::shared_ptr<ngraph::Function> f)
 {
     bool rewritten = false;
+    bool transformed = false;
     const size_t NUM_TRIES = 10;
     size_t tries = NUM_TRIES;
     std::vector<std::shared_ptr<pattern::Matcher>> original_matchers{m_matchers};
+
+    // Matchers sharing a name (e.g. re-registered from a callback) share their statistics.
+    // They are referred to by index as m_matcher_stats grows while matchers are registered
+    m_matcher_stats.clear();
+    unordered_map<string, size_t> stats_indices;
+    auto get_stats_index = [&](const shared_ptr<pattern::Matcher>& matcher) {
+        auto it = stats_indices.find(matcher->get_name());
+        if (it == stats_indices.end())
+        {
+            it = stats_indices.emplace(matcher->get_name(), m_matcher_stats.size()).first;
+            m_matcher_stats.push_back(MatcherStats());
+            m_matcher_stats.back().name = matcher->get_name();
+        }
+        return it->second;
+    };
+
+    RewriteOrder order;
+    order.build(f);
+    bool order_valid = true;
+    // Nodes a rewrite disconnected from the graph
+    unordered_set<Node*> dead;
+    // Nodes whose arguments changed in the last pass
+    unordered_set<Node*> changed;
+    // Names of the matchers that ran over the whole graph in the last pass
+    unordered_set<string> covered;
+
+    auto is_live = [&](Node* node) {
+        if (node->is_output() || node->is_parameter())
+        {
+            return true;
+        }
+        for (auto& user : node->get_users())
+        {
+            if (order.contains(user.get()) && dead.count(user.get()) == 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+
     do
     {
         rewritten = false;
         std::vector<std::shared_ptr<pattern::Matcher>> matchers{m_matchers};
         m_matchers.clear();
-        for (auto node : f->get_ordered_ops())
+
+        vector<size_t> matcher_stats;
+        unordered_map<type_index, vector<size_t>> matchers_by_type;
+        vector<size_t> wildcard_matchers;
+        size_t max_depth = 0;
+        for (size_t i = 0; i < matchers.size(); i++)
+        {
+            auto pattern = matchers[i]->get_pattern();
+            matcher_stats.push_back(get_stats_index(matchers[i]));
+            if (dynamic_pointer_cast<pattern::op::Pattern>(pattern))
+            {
+                wildcard_matchers.push_back(i);
+            }
+            else
+            {
+                matchers_by_type[type_index(typeid(*pattern))].push_back(i);
+            }
+            max_depth = max(max_depth, get_pattern_depth(pattern));
+        }
+        // Candidate matchers of every op type seen so far, in registration order
+        unordered_map<type_index, vector<size_t>> candidates;
+
+        // A pass visits every node unless all of its matchers already did so
+        bool visit_all = !order_valid;
+        for (auto& matcher : matchers)
+        {
+            visit_all = visit_all || matcher->get_name() == "Unnamed" ||
+                        covered.count(matcher->get_name()) == 0;
+        }
+        covered.clear();
+        for (auto& matcher : matchers)
+        {
+            covered.insert(matcher->get_name());
+        }
+
+        vector<shared_ptr<Node>> work_list;
+        if (visit_all)
+        {
+            if (!order_valid)
+            {
+                order.build(f);
+                order_valid = true;
+                dead.clear();
+            }
+            work_list.assign(order.begin(), order.end());
+        }
+        else
+        {
+            unordered_set<Node*> reached;
+            vector<Node*> frontier;
+            for (auto node : changed)
+            {
+                if (order.contains(node) && dead.count(node) == 0 && reached.insert(node).second)
+                {
+                    frontier.push_back(node);
+                }
+            }
+            for (size_t depth = 1; depth < max_depth && !frontier.empty(); depth++)
+            {
+                vector<Node*> next;
+                for (auto node : frontier)
+                {
+                    for (auto& user : node->get_users())
+                    {
+                        if (order.contains(user.get()) && dead.count(user.get()) == 0 &&
+                            reached.insert(user.get()).second)
+                        {
+                            next.push_back(user.get());
+                        }
+                    }
+                }
+                frontier.swap(next);
+            }
+            vector<Node*> nodes(reached.begin(), reached.end());
+            sort(nodes.begin(), nodes.end(), [&order](Node* a, Node* b) {
+                return order.rank(a) < order.rank(b);
+            });
+            for (auto node : nodes)
+            {
+                work_list.push_back(*order.find(node));
+            }
+        }
+        changed.clear();
+
+        for (auto& node : work_list)
         {
-            for (auto matcher : matchers)
+            if (dead.count(node.get()) != 0)
+            {
+                continue;
+            }
+
+            type_index type(typeid(*node));
+            auto it = candidates.find(type);
+            if (it == candidates.end())
+            {
+                vector<size_t> indices;
+                auto typed = matchers_by_type.find(type);
+                if (typed != matchers_by_type.end())
+                {
+                    indices = typed->second;
+                }
+                indices.insert(indices.end(), wildcard_matchers.begin(), wildcard_matchers.end());
+                sort(indices.begin(), indices.end());
+                it = candidates.emplace(type, indices).first;
+            }
+
+            for (auto i : it->second)
             {
+                auto& matcher = matchers[i];
+                size_t stats_index = matcher_stats[i];
+                m_matcher_stats[stats_index].attempts++;
+                auto start = chrono::high_resolution_clock::now();
                 NGRAPH_DEBUG << "Running matcher " << matcher->get_name() << "("
                              << matcher->get_pattern()->get_name() << ") on " << node->get_name();
-                if (matcher->match(node))
+                bool matched = matcher->match(node);
+                bool processed = false;
+                NodeVector matched_nodes;
+                NodeVector users;
+                if (matched)
                 {
                     NGRAPH_DEBUG << "Matcher " << matcher << matcher->get_name() << " matched "
                                  << node->get_name();
-                    if (matcher->process_match())
+                    m_matcher_stats[stats_index].matches++;
+                    matched_nodes = matcher->get_matched_nodes();
+                    matched_nodes.push_back(node);
+                    for (auto& matched_node : matched_nodes)
+                    {
+                        auto matched_users = matched_node->get_users();
+                        users.insert(users.end(), matched_users.begin(), matched_users.end());
+                    }
+                    processed = matcher->process_match();
+                }
+                m_matcher_stats[stats_index].time += chrono::high_resolution_clock::now() - start;
+                if (!processed)
+                {
+                    continue;
+                }
+                m_matcher_stats[stats_index].rewrites++;
+                rewritten = true;
+                transformed = true;
+
+                // Pick up the nodes the callback created, args before users. Walking back
+                // from the live users of the matched nodes reaches every new node that
+                // feeds the graph
+                NodeVector created;
+                unordered_set<Node*> visited;
+                function<void(const shared_ptr<Node>&)> discover =
+                    [&](const shared_ptr<Node>& n) {
+                        for (auto& arg : n->get_arguments())
+                        {
+                            if (!visited.insert(arg.get()).second)
+                            {
+                                continue;
+                            }
+                            if (order.contains(arg.get()))
+                            {
+                                // a callback may revive a node an earlier rewrite disconnected
+                                if (dead.erase(arg.get()) == 0)
+                                {
+                                    continue;
+                                }
+                                discover(arg);
+                                continue;
+                            }
+                            discover(arg);
+                            created.push_back(arg);
+                        }
+                    };
+                for (auto& user : users)
+                {
+                    if (order.contains(user.get()) && dead.count(user.get()) == 0)
+                    {
+                        discover(user);
+                        changed.insert(user.get());
+                    }
+                }
+                if (!created.empty())
+                {
+                    order_valid =
+                        order.insert_before(order.find(node.get()), created) && order_valid;
+                    for (auto& n : created)
                     {
-                        rewritten = true;
-                        break;
+                        changed.insert(n.get());
                     }
                 }
+
+                // Disconnected nodes are skipped from now on
+                vector<Node*> stack;
+                for (auto& matched_node : matched_nodes)
+                {
+                    stack.push_back(matched_node.get());
+                }
+                while (!stack.empty())
+                {
+                    Node* n = stack.back();
+                    stack.pop_back();
+                    if (!order.contains(n) || dead.count(n) != 0 || is_live(n))
+                    {
+                        continue;
+                    }
+                    dead.insert(n);
+                    for (auto& arg : n->get_arguments())
+                    {
+                        stack.push_back(arg.get());
+                    }
+                }
+                break;
             }
         }
 
+        // Release the nodes the rewrites disconnected
+        for (auto node : dead)
+        {
+            changed.erase(node);
+            order.erase(node);
+        }
+        dead.clear();
     } while (rewritten && m_matchers.size() > 0 && tries--);
 
+    for (auto& stats : m_matcher_stats)
+    {
+        NGRAPH_DEBUG << "Matcher " << stats.name << " attempts=" << stats.attempts
+                     << " matches=" << stats.matches << " rewrites=" << stats.rewrites << " time="
+                     << chrono::duration_cast<chrono::microseconds>(stats.time).count() << "us";
+    }
+
     m_matchers.assign(original_matchers.begin(), original_matchers.end());
-    return (NUM_TRIES - tries) > 1; //this means a graph was transformed
+    return transformed;
 }
 
 static const std::vector<std::regex> initialize_fusion_regexes()
@@ -16,8 +16,12 @@
 
 #pragma once
 
+#include <chrono>
 #include <functional>
 #include <set>
+#include <string>
+#include <vector>
+
 #include "ngraph/pass/pass.hpp"
 
 namespace ngraph
@@ -43,10 +47,26 @@ namespace ngraph
 /// the existing ops by providing a callback to \p Matcher object
 /// Patterns can be added by using \sa add_matcher
 /// Callbacks should use \sa replace_node to transform matched sub graphs
+/// Per-matcher timing and hit counts of the last run are available via \sa get_matcher_stats
+/// and are collected per pass by \sa Manager::get_pass_profile
 
 class ngraph::pass::GraphRewrite : public FunctionPass
 {
 public:
+    /// \brief What one matcher (or all matchers sharing its name) cost in a run
+    struct MatcherStats
+    {
+        std::string name;
+        // nodes the pattern was tried on
+        size_t attempts = 0;
+        // nodes the pattern matched
+        size_t matches = 0;
+        // matches whose callback transformed the graph
+        size_t rewrites = 0;
+        // time spent matching and in callbacks
+        std::chrono::nanoseconds time{0};
+    };
+
     GraphRewrite()
         : FunctionPass()
     {
@@ -56,9 +76,12 @@ public:
     void add_matcher(std::shared_ptr<pattern::Matcher> m);
     virtual bool run_on_function(std::shared_ptr<ngraph::Function> f);
 
+    /// \return statistics of the last \sa run_on_function in matcher registration order
+    const std::vector<MatcherStats>& get_matcher_stats() const { return m_matcher_stats; }
 private:
     // enable cascading rewrites
     std::vector<std::shared_ptr<pattern::Matcher>> m_matchers;
+    std::vector<MatcherStats> m_matcher_stats;
 };
 
 class ngraph::pass::RecurrentGraphRewrite : public FunctionPass
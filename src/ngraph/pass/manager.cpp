@@ -15,9 +15,11 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <chrono>
 #ifdef _WIN32
 #else
 #include <cxxabi.h>
+#include <sys/resource.h>
 #endif
 #include <iomanip>
 #include <iostream>
@@ -28,6 +30,7 @@
 #include "ngraph/node.hpp"
 #include "ngraph/op/function_call.hpp"
 #include "ngraph/op/reduce.hpp"
+#include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/pass/serialize.hpp"
@@ -37,6 +40,73 @@
 using namespace std;
 using namespace ngraph;
 
+static string get_pass_name(const pass::PassBase& pass)
+{
+    string name = typeid(pass).name();
+#ifndef _WIN32
+    int status;
+    char* demangled = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+    if (demangled)
+    {
+        name = demangled;
+        free(demangled);
+    }
+#endif
+    return name;
+}
+
+static size_t get_peak_memory()
+{
+    size_t result = 0;
+#ifndef _WIN32
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+    {
+#ifdef __APPLE__
+        result = usage.ru_maxrss;
+#else
+        // kilobytes on Linux
+        result = usage.ru_maxrss * 1024;
+#endif
+    }
+#endif
+    return result;
+}
+
+static size_t count_nodes(const vector<shared_ptr<Function>>& fs)
+{
+    size_t count = 0;
+    for (auto& f : fs)
+    {
+        count += f->get_ops().size();
+    }
+    return count;
+}
+
+using MatcherStats = pass::GraphRewrite::MatcherStats;
+
+// Matchers of the same name share their statistics across functions
+static void add_matcher_stats(vector<MatcherStats>& totals, const vector<MatcherStats>& stats)
+{
+    for (auto& s : stats)
+    {
+        auto it = find_if(totals.begin(), totals.end(), [&s](const MatcherStats& t) {
+            return t.name == s.name;
+        });
+        if (it == totals.end())
+        {
+            totals.push_back(s);
+        }
+        else
+        {
+            it->attempts += s.attempts;
+            it->matches += s.matches;
+            it->rewrites += s.rewrites;
+            it->time += s.time;
+        }
+    }
+}
+
 ngraph::pass::Manager::Manager()
 {
     static const auto nevt = std::getenv("NGRAPH_ENABLE_VISUALIZE_TRACING");
@@ -62,6 +132,9 @@ void ngraph::pass::Manager::initialize_default_passes()
 void ngraph::pass::Manager::run_passes(shared_ptr<Function> func, bool transitive)
 {
     bool profile_enabled = getenv("NGRAPH_PROFILE_PASS_ENABLE") != nullptr;
+    const char* timeline_file = getenv("NGRAPH_PROFILE_PASS_TIMELINE");
+    bool record_profile = m_profile || profile_enabled || timeline_file != nullptr;
+    m_pass_profile.clear();
 
     vector<shared_ptr<Function>> fs;
     if (transitive)
@@ -80,8 +153,20 @@ void ngraph::pass::Manager::run_passes(shared_ptr<Function> func, bool transitiv
     stopwatch pass_timer;
     stopwatch overall_timer;
     overall_timer.start();
+    auto run_start = chrono::steady_clock::now();
     for (shared_ptr<PassBase> pass : m_pass_list)
     {
+        PassProfile profile;
+        if (record_profile)
+        {
+            profile.name = get_pass_name(*pass);
+            profile.start = overall_timer.get_microseconds();
+            profile.nodes_before = count_nodes(fs);
+            profile.nodes_allocated = Node::get_thread_instance_count();
+            profile.peak_memory_growth = get_peak_memory();
+        }
+        auto rewrite_pass = dynamic_pointer_cast<GraphRewrite>(pass);
+
         pass_timer.start();
         pass->set_state(get_state());
         auto module_pass = dynamic_pointer_cast<ModulePass>(pass);
@@ -101,6 +186,10 @@ void ngraph::pass::Manager::run_passes(shared_ptr<Function> func, bool transitiv
             for (shared_ptr<Function> f : fs)
             {
                 function_pass->run_on_function(f);
+                if (record_profile && rewrite_pass)
+                {
+                    add_matcher_stats(profile.matchers, rewrite_pass->get_matcher_stats());
+                }
             }
         }
         else if (node_pass)
@@ -152,21 +241,28 @@ void ngraph::pass::Manager::run_passes(shared_ptr<Function> func, bool transitiv
         }
         index++;
         pass_timer.stop();
+        if (record_profile)
+        {
+            profile.duration = pass_timer.get_microseconds();
+            profile.nodes_after = count_nodes(fs);
+            profile.nodes_allocated = Node::get_thread_instance_count() - profile.nodes_allocated;
+            profile.peak_memory_growth = get_peak_memory() - profile.peak_memory_growth;
+            m_pass_profile.push_back(profile);
+        }
         if (profile_enabled)
         {
-            PassBase* p = pass.get();
-            string name = typeid(*p).name();
-#ifndef _WIN32
-            int status;
-            name = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
-#endif
-            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << name << "\n";
+            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << get_pass_name(*pass)
+                 << " nodes " << profile.nodes_before << "->" << profile.nodes_after << "\n";
         }
     }
     if (profile_enabled)
     {
         cout << "passes done in " << overall_timer.get_milliseconds() << "ms\n";
     }
+    if (timeline_file)
+    {
+        write_pass_profile_timeline(timeline_file, m_pass_profile, run_start);
+    }
 }
 
 ngraph::pass::ManagerState& ngraph::pass::Manager::get_state()
@@ -24,6 +24,7 @@
 #include "ngraph/pass/manager_state.hpp"
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/pass/pass_config.hpp"
+#include "ngraph/pass/pass_profile.hpp"
 
 namespace ngraph
 {
@@ -62,6 +63,12 @@ public:
     void set_pass_config(const PassConfig& pass_config) { m_pass_config = pass_config; }
     void set_pass_visualization(bool new_state) { m_visualize = new_state; }
     void set_pass_serialization(bool new_state) { m_serialize = new_state; }
+    /// \brief Records a \sa PassProfile of every pass in \sa run_passes. Also enabled by
+    /// NGRAPH_PROFILE_PASS_ENABLE and by NGRAPH_PROFILE_PASS_TIMELINE, which names a
+    /// chrome://tracing file that collects the profiles of all runs in the process
+    void set_pass_profiling(bool new_state) { m_profile = new_state; }
+    /// \return the profile of the last \sa run_passes in pass registration order
+    const std::vector<PassProfile>& get_pass_profile() const { return m_pass_profile; }
 private:
     std::vector<std::string> m_pass_names;
     std::vector<std::shared_ptr<PassBase>> m_pass_list;
@@ -69,4 +76,6 @@ private:
     PassConfig m_pass_config;
     bool m_visualize = false;
     bool m_serialize = false;
+    bool m_profile = false;
+    std::vector<PassProfile> m_pass_profile;
 };
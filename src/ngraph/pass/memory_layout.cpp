@@ -14,13 +14,19 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <exception>
+#include <map>
+#include <numeric>
 #include <sstream>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "ngraph/log.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/concat.hpp"
 #include "ngraph/op/get_output_element.hpp"
+#include "ngraph/op/op.hpp"
 #include "ngraph/op/slice.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
@@ -30,9 +36,14 @@
 using namespace std;
 using namespace ngraph;
 
-pass::MemoryLayout::MemoryLayout(size_t alignment, bool disable_memory_sharing)
+pass::MemoryLayout::MemoryLayout(size_t alignment,
+                                 bool disable_memory_sharing,
+                                 bool pack_intervals,
+                                 bool persist_cacheable)
     : m_alignment(alignment)
     , m_disable_memory_sharing(disable_memory_sharing)
+    , m_pack_intervals(pack_intervals)
+    , m_persist_cacheable(persist_cacheable)
 {
     if (m_alignment == 0)
     {
@@ -43,19 +54,34 @@ pass::MemoryLayout::MemoryLayout(size_t alignment, bool disable_memory_sharing)
 bool pass::MemoryLayout::run_on_function(shared_ptr<ngraph::Function> function)
 {
     MemoryManager mm(m_alignment, m_disable_memory_sharing);
-    for (shared_ptr<Node> node : function->get_ordered_ops())
+    MemoryManager cache_mm(m_alignment, true);
+    unordered_set<const descriptor::Tensor*> cached_tensors;
+
+    // With interval packing, temporaries are only grouped into buffers here: in-place outputs
+    // join the buffer of their input. Offsets are assigned once every lifetime is known.
+    list<shared_ptr<Node>> ordered_ops = function->get_ordered_ops();
+    unordered_map<descriptor::Tensor*, size_t> tensor_buffers;
+    unordered_map<const descriptor::Tensor*, size_t> tensor_last_use;
+    vector<size_t> buffer_sizes;
+    vector<size_t> buffer_first_use;
+    size_t step = 0;
+
+    for (shared_ptr<Node> node : ordered_ops)
     {
         std::map<descriptor::Tensor*, descriptor::Tensor*> in_place_outputs;
         std::set<const descriptor::Tensor*> reused_inputs;
+        bool cached = false;
 
         if (node->is_op())
         {
             auto op = std::static_pointer_cast<op::Op>(node);
+            auto op_annotations = op->get_op_annotations();
+            cached = m_persist_cacheable && op_annotations && op_annotations->is_cacheable();
             // concat and slice in_place_oi should be treated differently
             if (!std::dynamic_pointer_cast<op::Concat>(node) &&
                 !std::dynamic_pointer_cast<op::Slice>(node))
             {
-                if (auto op_annotations = op->get_op_annotations())
+                if (op_annotations)
                 {
                     for (auto oi_pair : op_annotations->get_in_place_oi_pairs())
                     {
@@ -64,11 +90,23 @@ bool pass::MemoryLayout::run_on_function(shared_ptr<ngraph::Function> function)
                         auto input_node =
                             node->get_inputs().at(oi_pair.input).get_output().get_node();
 
+                        // Cached tensors never share memory with the temporaries, and nothing
+                        // may overwrite them
+                        if (cached != (cached_tensors.count(input) != 0) ||
+                            (cached && oi_pair.destructive))
+                        {
+                            continue;
+                        }
+
                         // For destructive kernel, this should be the last use
                         // Non-destructive kernels can pass through if memory sharing is disabled
+                        // Packing extends the input's buffer over the output's lifetime,
+                        // so non-destructive kernels can always pass a temporary through
                         if ((node->liveness_free_list.count(input) != 0 ||
                              std::dynamic_pointer_cast<op::GetOutputElement>(node) ||
-                             (m_disable_memory_sharing && !oi_pair.destructive)) &&
+                             (m_disable_memory_sharing && !oi_pair.destructive) ||
+                             (m_pack_intervals && !oi_pair.destructive &&
+                              tensor_buffers.count(input) != 0)) &&
                             node->liveness_new_list.count(output) != 0)
                         {
                             in_place_outputs.insert({output, input});
@@ -79,8 +117,59 @@ bool pass::MemoryLayout::run_on_function(shared_ptr<ngraph::Function> function)
             }
         }
 
+        if (cached)
+        {
+            for (descriptor::Tensor* tensor : node->liveness_new_list)
+            {
+                size_t offset = in_place_outputs.count(tensor)
+                                    ? in_place_outputs.at(tensor)->get_pool_offset()
+                                    : cache_mm.allocate(tensor->size());
+                tensor->set_pool_offset(offset);
+                cached_tensors.insert(tensor);
+            }
+        }
+
+        if (m_pack_intervals)
+        {
+            for (descriptor::Tensor* tensor : node->liveness_new_list)
+            {
+                auto in_place = in_place_outputs.find(tensor);
+                if (cached_tensors.count(tensor) != 0)
+                {
+                    continue;
+                }
+                if (in_place == in_place_outputs.end())
+                {
+                    tensor_buffers[tensor] = buffer_sizes.size();
+                    buffer_sizes.push_back(tensor->size());
+                    buffer_first_use.push_back(step);
+                }
+                else if (tensor_buffers.count(in_place->second) != 0)
+                {
+                    size_t buffer = tensor_buffers.at(in_place->second);
+                    tensor_buffers[tensor] = buffer;
+                    buffer_sizes[buffer] = max(buffer_sizes[buffer], tensor->size());
+                }
+                else
+                {
+                    // Passed through from a tensor that does not live in the pool
+                    tensor->set_pool_offset(in_place->second->get_pool_offset());
+                }
+            }
+            for (const descriptor::Tensor* tensor : node->liveness_free_list)
+            {
+                tensor_last_use[tensor] = step;
+            }
+            step++;
+            continue;
+        }
+
         for (descriptor::Tensor* tensor : node->liveness_new_list)
         {
+            if (cached_tensors.count(tensor) != 0)
+            {
+                continue;
+            }
             size_t offset = in_place_outputs.count(tensor)
                                 ? in_place_outputs.at(tensor)->get_pool_offset()
                                 : mm.allocate(tensor->size());
@@ -91,14 +180,46 @@ bool pass::MemoryLayout::run_on_function(shared_ptr<ngraph::Function> function)
         {
             for (const descriptor::Tensor* tensor : node->liveness_free_list)
             {
-                if (reused_inputs.count(tensor) == 0)
+                if (reused_inputs.count(tensor) == 0 && cached_tensors.count(tensor) == 0)
                 {
                     mm.free(tensor->get_pool_offset());
                 }
             }
         }
     }
-    function->set_temporary_pool_size(mm.max_allocated());
+
+    function->set_cache_pool_size(cache_mm.max_allocated());
+    if (!m_pack_intervals)
+    {
+        function->set_temporary_pool_size(mm.max_allocated());
+        return false;
+    }
+
+    // A buffer lives until its last tensor dies; tensors that are never freed live to the end
+    vector<size_t> buffer_last_use(buffer_first_use);
+    for (const auto& tensor_buffer : tensor_buffers)
+    {
+        auto last_use = tensor_last_use.find(tensor_buffer.first);
+        size_t last = last_use != tensor_last_use.end() ? last_use->second : step;
+        size_t& buffer_last = buffer_last_use[tensor_buffer.second];
+        buffer_last = max(buffer_last, last);
+    }
+
+    MemoryIntervalPacker packer(m_alignment);
+    for (size_t buffer = 0; buffer < buffer_sizes.size(); buffer++)
+    {
+        packer.add(buffer_sizes[buffer], buffer_first_use[buffer], buffer_last_use[buffer]);
+    }
+    packer.pack();
+
+    for (const auto& tensor_buffer : tensor_buffers)
+    {
+        tensor_buffer.first->set_pool_offset(packer.get_offset(tensor_buffer.second));
+    }
+    NGRAPH_DEBUG << "Packed temporaries of " << function->get_name() << " into "
+                 << packer.max_allocated() << " bytes, lower bound " << packer.lower_bound()
+                 << " bytes";
+    function->set_temporary_pool_size(packer.max_allocated());
 
     return false;
 }
@@ -288,3 +409,91 @@ size_t pass::MemoryManager::align(size_t size, size_t alignment)
     }
     return size;
 }
+
+pass::MemoryIntervalPacker::MemoryIntervalPacker(size_t alignment)
+    : m_alignment{alignment}
+    , m_max_allocated{0}
+    , m_lower_bound{0}
+{
+    if (m_alignment == 0)
+    {
+        throw invalid_argument("Memory alignment must be > 0");
+    }
+}
+
+size_t pass::MemoryIntervalPacker::add(size_t size, size_t first, size_t last)
+{
+    if (last < first)
+    {
+        throw invalid_argument("Buffer lifetime ends before it starts");
+    }
+    m_buffers.push_back(buffer{MemoryManager::align(size, m_alignment), first, last, 0});
+    return m_buffers.size() - 1;
+}
+
+void pass::MemoryIntervalPacker::pack()
+{
+    vector<size_t> order(m_buffers.size());
+    iota(order.begin(), order.end(), 0);
+    stable_sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+        return m_buffers[a].m_size > m_buffers[b].m_size;
+    });
+
+    m_max_allocated = 0;
+    vector<const buffer*> placed;
+    for (size_t id : order)
+    {
+        buffer& current = m_buffers[id];
+
+        vector<const buffer*> overlapping;
+        for (const buffer* other : placed)
+        {
+            if (other->m_first <= current.m_last && current.m_first <= other->m_last)
+            {
+                overlapping.push_back(other);
+            }
+        }
+        sort(overlapping.begin(), overlapping.end(), [](const buffer* a, const buffer* b) {
+            return a->m_offset < b->m_offset;
+        });
+
+        size_t best_offset = numeric_limits<size_t>::max();
+        size_t best_gap = numeric_limits<size_t>::max();
+        size_t gap_start = 0;
+        for (const buffer* other : overlapping)
+        {
+            if (other->m_offset > gap_start)
+            {
+                size_t gap = other->m_offset - gap_start;
+                if (gap >= current.m_size && gap < best_gap)
+                {
+                    best_gap = gap;
+                    best_offset = gap_start;
+                }
+            }
+            gap_start = max(gap_start, other->m_offset + other->m_size);
+        }
+        if (best_offset == numeric_limits<size_t>::max())
+        {
+            best_offset = gap_start;
+        }
+
+        current.m_offset = best_offset;
+        placed.push_back(&current);
+        m_max_allocated = max(m_max_allocated, best_offset + current.m_size);
+    }
+
+    map<size_t, ptrdiff_t> live_size_changes;
+    for (const buffer& b : m_buffers)
+    {
+        live_size_changes[b.m_first] += b.m_size;
+        live_size_changes[b.m_last + 1] -= b.m_size;
+    }
+    m_lower_bound = 0;
+    ptrdiff_t live_size = 0;
+    for (const auto& change : live_size_changes)
+    {
+        live_size += change.second;
+        m_lower_bound = max(m_lower_bound, static_cast<size_t>(live_size));
+    }
+}
@@ -19,6 +19,7 @@
 #include <limits>
 #include <list>
 #include <sstream>
+#include <vector>
 
 #include "ngraph/pass/pass.hpp"
 
@@ -29,18 +30,68 @@ namespace ngraph
         class MemoryLayout;
         class MemoryNode;
         class MemoryManager;
+        class MemoryIntervalPacker;
     }
 }
 
 class ngraph::pass::MemoryLayout : public FunctionPass
 {
 public:
-    MemoryLayout(size_t alignment = 1, bool disable_memory_sharing = false);
+    /// \param pack_intervals Place temporaries with MemoryIntervalPacker, which sees the whole
+    ///        liveness table, instead of allocating them op by op. Takes precedence over
+    ///        disable_memory_sharing, except that non-destructive in-place outputs of persistent
+    ///        tensors are still passed through when sharing is disabled.
+    /// \param persist_cacheable Place the outputs of ops marked cacheable by
+    ///        PropagateCacheability in a separate pool, sized by Function::get_cache_pool_size,
+    ///        whose tensors are never reused or overwritten, so a backend can keep them across
+    ///        calls. Offsets of these tensors are relative to that pool.
+    MemoryLayout(size_t alignment = 1,
+                 bool disable_memory_sharing = false,
+                 bool pack_intervals = false,
+                 bool persist_cacheable = false);
     bool run_on_function(std::shared_ptr<ngraph::Function>) override;
 
 private:
     size_t m_alignment;
     bool m_disable_memory_sharing;
+    bool m_pack_intervals;
+    bool m_persist_cacheable;
+};
+
+/// \brief Assigns offsets to buffers whose lifetimes are known up front.
+///
+/// Buffers are placed greedily, largest first. Each one goes into the smallest gap between the
+/// already placed buffers whose lifetimes overlap its own, or above all of them if no gap is
+/// large enough.
+class ngraph::pass::MemoryIntervalPacker
+{
+public:
+    MemoryIntervalPacker(size_t alignment = 1);
+
+    /// \brief Adds a buffer that is live from step `first` through step `last`, inclusive.
+    /// \return The buffer's id, used to look up its offset after pack().
+    size_t add(size_t size, size_t first, size_t last);
+    void pack();
+
+    size_t get_offset(size_t id) const { return m_buffers.at(id).m_offset; }
+    /// \brief The pool size needed by the packed buffers.
+    size_t max_allocated() const { return m_max_allocated; }
+    /// \brief The largest total size of buffers live at the same step. No placement can use
+    ///        less memory than this.
+    size_t lower_bound() const { return m_lower_bound; }
+private:
+    struct buffer
+    {
+        size_t m_size;
+        size_t m_first;
+        size_t m_last;
+        size_t m_offset;
+    };
+
+    std::vector<buffer> m_buffers;
+    size_t m_alignment;
+    size_t m_max_allocated;
+    size_t m_lower_bound;
 };
 
 class ngraph::pass::MemoryManager
@@ -0,0 +1,145 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <fstream>
+#include <map>
+#include <mutex>
+
+#include "ngraph/pass/pass_profile.hpp"
+#include "nlohmann/json.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static int64_t to_microseconds(chrono::nanoseconds time)
+{
+    return chrono::duration_cast<chrono::microseconds>(time).count();
+}
+
+void pass::write_pass_profile_json(ostream& out, const vector<PassProfile>& profile)
+{
+    nlohmann::json passes = nlohmann::json::array();
+    for (auto& pass : profile)
+    {
+        nlohmann::json matchers = nlohmann::json::array();
+        for (auto& stats : pass.matchers)
+        {
+            matchers.push_back({{"name", stats.name},
+                                {"attempts", stats.attempts},
+                                {"matches", stats.matches},
+                                {"rewrites", stats.rewrites},
+                                {"time_us", to_microseconds(stats.time)}});
+        }
+        passes.push_back({{"name", pass.name},
+                          {"start_us", pass.start},
+                          {"time_us", pass.duration},
+                          {"nodes_before", pass.nodes_before},
+                          {"nodes_after", pass.nodes_after},
+                          {"nodes_allocated", pass.nodes_allocated},
+                          {"peak_memory_growth", pass.peak_memory_growth},
+                          {"matchers", matchers}});
+    }
+    out << passes.dump(4) << "\n";
+}
+
+namespace
+{
+    // What this process needs to remember to add another run to a timeline file
+    struct Timeline
+    {
+        chrono::steady_clock::time_point first_run_start;
+        size_t run_count = 0;
+        bool has_events = false;
+    };
+
+    const string trace_header = "{\"traceEvents\":[";
+    const string trace_footer = "]}";
+}
+
+void pass::write_pass_profile_timeline(const string& file_name,
+                                       const vector<PassProfile>& profile,
+                                       chrono::steady_clock::time_point run_start)
+{
+    static mutex timelines_mutex;
+    static map<string, Timeline> timelines;
+    lock_guard<mutex> lock(timelines_mutex);
+
+    Timeline& timeline = timelines[file_name];
+    if (timeline.run_count == 0)
+    {
+        timeline.first_run_start = run_start;
+    }
+    int64_t offset = to_microseconds(run_start - timeline.first_run_start);
+    size_t run = timeline.run_count++;
+    nlohmann::json trace = nlohmann::json::array();
+    for (auto& pass : profile)
+    {
+        trace.push_back({{"ph", "X"},
+                         {"cat", "Pass"},
+                         {"name", pass.name},
+                         {"pid", 0},
+                         {"tid", run},
+                         {"ts", offset + pass.start},
+                         {"dur", pass.duration},
+                         {"args",
+                          {{"nodes_before", pass.nodes_before},
+                           {"nodes_after", pass.nodes_after},
+                           {"nodes_allocated", pass.nodes_allocated},
+                           {"peak_memory_growth", pass.peak_memory_growth}}}});
+
+        int64_t ts = offset + pass.start;
+        for (auto& stats : pass.matchers)
+        {
+            int64_t duration = to_microseconds(stats.time);
+            trace.push_back({{"ph", "X"},
+                             {"cat", "Matcher"},
+                             {"name", stats.name},
+                             {"pid", 0},
+                             {"tid", run},
+                             {"ts", ts},
+                             {"dur", duration},
+                             {"args",
+                              {{"attempts", stats.attempts},
+                               {"matches", stats.matches},
+                               {"rewrites", stats.rewrites}}}});
+            ts += duration;
+        }
+    }
+
+    // The first run starts the file over. Later runs overwrite the footer with their events
+    // and put it back, so the file is a valid trace after every run without rewriting it
+    fstream out;
+    if (run == 0)
+    {
+        out.open(file_name, ios::out | ios::trunc);
+        out << trace_header;
+    }
+    else
+    {
+        out.open(file_name, ios::in | ios::out);
+        out.seekp(-static_cast<streamoff>(trace_footer.size()), ios::end);
+    }
+    for (auto& event : trace)
+    {
+        if (timeline.has_events)
+        {
+            out << ",";
+        }
+        out << event;
+        timeline.has_events = true;
+    }
+    out << trace_footer;
+}
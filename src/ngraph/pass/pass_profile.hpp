@@ -0,0 +1,64 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "ngraph/pass/graph_rewrite.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        /// \brief What one pass cost in a \sa Manager::run_passes
+        struct PassProfile
+        {
+            std::string name;
+            // microseconds since the start of run_passes
+            int64_t start = 0;
+            // wall time of the pass in microseconds
+            int64_t duration = 0;
+            // ops in all the functions the pass ran on
+            size_t nodes_before = 0;
+            size_t nodes_after = 0;
+            // nodes the pass constructed, including the ones it threw away. Counted on the thread
+            // running the passes, so graphs built concurrently elsewhere don't show up here
+            size_t nodes_allocated = 0;
+            // growth of the peak resident set size in bytes (0 where it can't be measured)
+            size_t peak_memory_growth = 0;
+            // per-matcher statistics of GraphRewrite passes, summed over all functions
+            std::vector<GraphRewrite::MatcherStats> matchers;
+        };
+
+        /// \brief Writes \p profile as a JSON array with one object per pass
+        void write_pass_profile_json(std::ostream& out, const std::vector<PassProfile>& profile);
+
+        /// \brief Adds \p profile, one run of \sa Manager::run_passes that started at
+        /// \p run_start, to the chrome://tracing file \p file_name. The file keeps every run this
+        /// process wrote to it, one row per run. Only the events of the new run are written, in
+        /// place of the closing brackets which are then put back. Each pass
+        /// is one event. The matchers of a rewrite pass are laid out back to back inside its
+        /// event as their time is only known in total
+        void write_pass_profile_timeline(const std::string& file_name,
+                                         const std::vector<PassProfile>& profile,
+                                         std::chrono::steady_clock::time_point run_start);
+    }
+}
@@ -19,6 +19,7 @@
 #include "ngraph/file_util.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
+#include "ngraph/runtime/call_queue.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
 #include "ngraph/util.hpp"
 
@@ -43,6 +44,44 @@ void runtime::Backend::remove_compiled_function(shared_ptr<Function> func)
 {
 }
 
+future<bool> runtime::Backend::call_async(shared_ptr<Function> func,
+                                          const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                          const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    throw ngraph_error("Backend does not support asynchronous calls");
+}
+
+void runtime::Backend::set_async_config(size_t worker_count, size_t queue_capacity)
+{
+    if (worker_count == 0 || queue_capacity == 0)
+    {
+        throw ngraph_error("Asynchronous calls require at least one worker and a non-zero queue");
+    }
+    lock_guard<mutex> lock(m_async_mutex);
+    if (m_async_started)
+    {
+        throw ngraph_error("set_async_config must be called before the first call_async");
+    }
+    m_async_worker_count = worker_count;
+    m_async_queue_capacity = queue_capacity;
+}
+
+future<bool> runtime::Backend::enqueue_call(unique_ptr<CallQueue>& queue,
+                                            shared_ptr<Function> func,
+                                            const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                            const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    {
+        lock_guard<mutex> lock(m_async_mutex);
+        if (!queue)
+        {
+            queue.reset(new CallQueue(m_async_worker_count, m_async_queue_capacity));
+            m_async_started = true;
+        }
+    }
+    return queue->submit([this, func, outputs, inputs]() { return call(func, outputs, inputs); });
+}
+
 vector<ngraph::runtime::PerformanceCounter>
     runtime::Backend::get_performance_data(shared_ptr<Function> func) const
 {
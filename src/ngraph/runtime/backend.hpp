@@ -16,7 +16,9 @@
 
 #pragma once
 
+#include <future>
 #include <memory>
+#include <mutex>
 
 #include "ngraph/function.hpp"
 #include "ngraph/runtime/performance_counter.hpp"
@@ -30,6 +32,7 @@ namespace ngraph
         class ExternalFunction;
         class Tensor;
         class Backend;
+        class CallQueue;
         using Handle = std::shared_ptr<Function>;
     }
 }
@@ -103,6 +106,24 @@ public:
         return call(func, outputs, inputs);
     }
 
+    /// \brief Executes a single iteration of a Function without blocking the caller. The call is
+    ///     placed on a bounded queue and run by the backend's worker pool, see
+    ///     `set_async_config`. The tensors must stay alive, and must not be written, until the
+    ///     returned future is ready.
+    /// \param func The function to execute
+    /// \returns future holding the result of `call`, or the exception it threw
+    virtual std::future<bool>
+        call_async(std::shared_ptr<Function> func,
+                   const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                   const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+
+    /// \brief Configure the worker pool used by `call_async`. The pool is created on the first
+    ///     asynchronous call, so the configuration must be set before then; calling this
+    ///     afterwards throws.
+    /// \param worker_count Number of threads executing queued calls
+    /// \param queue_capacity Number of pending calls after which `call_async` blocks
+    void set_async_config(size_t worker_count, size_t queue_capacity);
+
     /// \brief Compiled functions may be cached. This function removes a compiled function
     ///     from the cache.
     /// \param func The function to execute
@@ -128,4 +149,19 @@ protected:
     void validate_call(std::shared_ptr<const Function> func,
                        const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                        const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+
+    /// \brief Submit `call(func, outputs, inputs)` to `queue`, creating the queue from the async
+    ///     configuration on first use. Backends supporting `call_async` own the queue and must
+    ///     declare it after every member that `call` uses, so that pending calls are drained
+    ///     before the rest of the backend is destroyed.
+    std::future<bool> enqueue_call(std::unique_ptr<CallQueue>& queue,
+                                   std::shared_ptr<Function> func,
+                                   const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                                   const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+
+    size_t m_async_worker_count = 1;
+    size_t m_async_queue_capacity = 64;
+    // Set once a call queue has been created from the configuration
+    bool m_async_started = false;
+    std::mutex m_async_mutex;
 };
@@ -0,0 +1,376 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <sstream>
+#include <unordered_map>
+
+#include "ngraph/except.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/avg_pool.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/concat.hpp"
+#include "ngraph/op/convert.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/get_output_element.hpp"
+#include "ngraph/op/max_pool.hpp"
+#include "ngraph/op/not.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/op/select.hpp"
+#include "ngraph/op/slice.hpp"
+#include "ngraph/op/softmax.hpp"
+#include "ngraph/op/util/arithmetic_reduction.hpp"
+#include "ngraph/op/util/binary_elementwise_arithmetic.hpp"
+#include "ngraph/op/util/binary_elementwise_comparison.hpp"
+#include "ngraph/op/util/binary_elementwise_logical.hpp"
+#include "ngraph/op/util/index_reduction.hpp"
+#include "ngraph/op/util/logical_reduction.hpp"
+#include "ngraph/op/util/unary_elementwise_arithmetic.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/batching_executor.hpp"
+#include "ngraph/runtime/tensor.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static size_t sample_byte_size(const element::Type& type, const Shape& shape)
+{
+    return shape_size(shape) * type.size();
+}
+
+static void check_batch_axis(const string& what, const Shape& shape)
+{
+    if (shape.empty() || shape[0] != 1)
+    {
+        stringstream ss;
+        ss << what << " shape {" << join(shape) << "} does not have a leading batch axis of size 1";
+        throw ngraph_error(ss.str());
+    }
+}
+
+// Returns true if every row of the node's batch axis output is computed from the same row of
+// its batched inputs only. The check is a whitelist: any op not listed here is assumed to mix
+// samples, since a padding row or a neighbouring request would otherwise leak into a result.
+static bool keeps_rows_independent(const shared_ptr<Node>& node,
+                                   const vector<bool>& batched_args,
+                                   size_t batch_size)
+{
+    if (auto softmax = dynamic_pointer_cast<op::Softmax>(node))
+    {
+        return softmax->get_axes().count(0) == 0;
+    }
+    if (dynamic_pointer_cast<op::util::UnaryElementwiseArithmetic>(node) ||
+        dynamic_pointer_cast<op::util::BinaryElementwiseArithmetic>(node) ||
+        dynamic_pointer_cast<op::util::BinaryElementwiseComparison>(node) ||
+        dynamic_pointer_cast<op::util::BinaryElementwiseLogical>(node) ||
+        dynamic_pointer_cast<op::Not>(node) || dynamic_pointer_cast<op::Convert>(node) ||
+        dynamic_pointer_cast<op::Select>(node) ||
+        dynamic_pointer_cast<op::GetOutputElement>(node) || dynamic_pointer_cast<op::Result>(node))
+    {
+        return true;
+    }
+    if (auto broadcast = dynamic_pointer_cast<op::Broadcast>(node))
+    {
+        return broadcast->get_broadcast_axes().count(0) == 0;
+    }
+    if (auto reshape = dynamic_pointer_cast<op::Reshape>(node))
+    {
+        return reshape->get_input_order()[0] == 0 &&
+               reshape->get_output_shape()[0] == batch_size;
+    }
+    if (auto slice = dynamic_pointer_cast<op::Slice>(node))
+    {
+        return slice->get_lower_bounds()[0] == 0 && slice->get_upper_bounds()[0] == batch_size &&
+               slice->get_strides()[0] == 1;
+    }
+    if (auto concat = dynamic_pointer_cast<op::Concat>(node))
+    {
+        return concat->get_concatenation_axis() != 0;
+    }
+    if (auto reduction = dynamic_pointer_cast<op::util::ArithmeticReduction>(node))
+    {
+        return reduction->get_reduction_axes().count(0) == 0;
+    }
+    if (auto reduction = dynamic_pointer_cast<op::util::LogicalReduction>(node))
+    {
+        return reduction->get_reduction_axes().count(0) == 0;
+    }
+    if (auto reduction = dynamic_pointer_cast<op::util::IndexReduction>(node))
+    {
+        return reduction->get_reduction_axis() != 0;
+    }
+    if (auto dot = dynamic_pointer_cast<op::Dot>(node))
+    {
+        // Only the leading axes of the first argument survive into the result's leading axes
+        return batched_args[0] && !batched_args[1] &&
+               node->get_input_shape(0).size() > dot->get_reduction_axes_count();
+    }
+    if (dynamic_pointer_cast<op::Convolution>(node))
+    {
+        return batched_args[0] && !batched_args[1];
+    }
+    if (dynamic_pointer_cast<op::AvgPool>(node) || dynamic_pointer_cast<op::MaxPool>(node))
+    {
+        return true;
+    }
+    return false;
+}
+
+runtime::BatchingExecutor::BatchingExecutor(const shared_ptr<Backend>& backend,
+                                            const shared_ptr<Function>& func,
+                                            size_t max_batch_size,
+                                            chrono::microseconds max_latency)
+    : m_backend(backend)
+    , m_function(func)
+    , m_max_batch_size(max_batch_size)
+    , m_max_latency(max_latency)
+    , m_stopping(false)
+{
+    if (max_batch_size == 0)
+    {
+        throw ngraph_error("BatchingExecutor requires a non-zero batch size");
+    }
+
+    // Clone the function onto parameters with a full batch axis and let shape inference
+    // propagate the batch size to the results
+    NodeMap node_map;
+    size_t staging_size = 0;
+    for (const shared_ptr<op::Parameter>& param : func->get_parameters())
+    {
+        check_batch_axis("Parameter", param->get_shape());
+        Shape batched_shape = param->get_shape();
+        batched_shape[0] = max_batch_size;
+        node_map.add(param, make_shared<op::Parameter>(param->get_element_type(), batched_shape));
+        staging_size = max(staging_size,
+                           sample_byte_size(param->get_element_type(), param->get_shape()));
+    }
+    for (size_t i = 0; i < func->get_output_size(); i++)
+    {
+        check_batch_axis("Result", func->get_output_shape(i));
+        staging_size = max(staging_size,
+                           sample_byte_size(func->get_output_element_type(i),
+                                            func->get_output_shape(i)));
+    }
+    m_batched_function = clone_function(*func, node_map);
+
+    for (size_t i = 0; i < m_batched_function->get_output_size(); i++)
+    {
+        Shape expected = func->get_output_shape(i);
+        expected[0] = max_batch_size;
+        if (m_batched_function->get_output_shape(i) != expected)
+        {
+            stringstream ss;
+            ss << "Result " << i << " does not scale with the batch axis, batched shape is {"
+               << join(m_batched_function->get_output_shape(i)) << "}";
+            throw ngraph_error(ss.str());
+        }
+    }
+
+    // Track which nodes carry the batch axis and reject any that would mix rows
+    unordered_map<Node*, bool> is_batched;
+    for (const shared_ptr<Node>& node : m_batched_function->get_ordered_ops())
+    {
+        if (node->is_parameter())
+        {
+            is_batched[node.get()] = true;
+            continue;
+        }
+        vector<bool> batched_args;
+        for (const shared_ptr<Node>& arg : node->get_arguments())
+        {
+            batched_args.push_back(is_batched[arg.get()]);
+        }
+        bool batched = find(batched_args.begin(), batched_args.end(), true) != batched_args.end();
+        if (batched && !keeps_rows_independent(node, batched_args, max_batch_size))
+        {
+            stringstream ss;
+            ss << "BatchingExecutor cannot batch " << node->get_name()
+               << " because it mixes samples across the batch axis";
+            throw ngraph_error(ss.str());
+        }
+        is_batched[node.get()] = batched;
+    }
+    m_backend->compile(m_batched_function);
+
+    // Zero the batched inputs so that padding rows of partial batches hold finite values
+    for (const shared_ptr<op::Parameter>& param : m_batched_function->get_parameters())
+    {
+        auto tensor = m_backend->create_tensor(param->get_element_type(), param->get_shape());
+        vector<char> zeros(sample_byte_size(param->get_element_type(), param->get_shape()), 0);
+        tensor->write(zeros.data(), 0, zeros.size());
+        m_batched_inputs.push_back(tensor);
+    }
+    for (size_t i = 0; i < m_batched_function->get_output_size(); i++)
+    {
+        m_batched_outputs.push_back(
+            m_backend->create_tensor(m_batched_function->get_output_element_type(i),
+                                     m_batched_function->get_output_shape(i)));
+    }
+    m_staging.resize(staging_size);
+    m_last_batch_size = 0;
+
+    m_dispatcher = thread(&BatchingExecutor::dispatch_loop, this);
+}
+
+runtime::BatchingExecutor::~BatchingExecutor()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_has_work.notify_all();
+    m_dispatcher.join();
+    m_backend->remove_compiled_function(m_batched_function);
+}
+
+future<runtime::BatchingExecutor::RequestStats>
+    runtime::BatchingExecutor::call(const vector<shared_ptr<Tensor>>& outputs,
+                                    const vector<shared_ptr<Tensor>>& inputs)
+{
+    const ParameterVector& params = m_function->get_parameters();
+    if (inputs.size() != params.size() || outputs.size() != m_function->get_output_size())
+    {
+        throw ngraph_error("BatchingExecutor call does not match the Function's signature");
+    }
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        if (inputs[i]->get_element_type() != params[i]->get_element_type() ||
+            inputs[i]->get_shape() != params[i]->get_shape())
+        {
+            stringstream ss;
+            ss << "Input " << i << " does not match Parameter " << params[i]->get_name();
+            throw ngraph_error(ss.str());
+        }
+    }
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        if (outputs[i]->get_element_type() != m_function->get_output_element_type(i) ||
+            outputs[i]->get_shape() != m_function->get_output_shape(i))
+        {
+            stringstream ss;
+            ss << "Output " << i << " does not match Result " << i;
+            throw ngraph_error(ss.str());
+        }
+    }
+
+    Request request;
+    request.outputs = outputs;
+    request.inputs = inputs;
+    request.submitted = chrono::steady_clock::now();
+    future<RequestStats> result = request.result.get_future();
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_pending.push_back(move(request));
+    }
+    m_has_work.notify_one();
+    return result;
+}
+
+void runtime::BatchingExecutor::dispatch_loop()
+{
+    while (true)
+    {
+        vector<Request> batch;
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_has_work.wait(lock, [this] { return m_stopping || !m_pending.empty(); });
+            if (m_pending.empty())
+            {
+                return;
+            }
+            // Hold the batch open until it is full or its oldest request has waited long enough
+            auto deadline = m_pending.front().submitted + m_max_latency;
+            m_has_work.wait_until(lock, deadline, [this] {
+                return m_stopping || m_pending.size() >= m_max_batch_size;
+            });
+            size_t count = min(m_pending.size(), m_max_batch_size);
+            for (size_t i = 0; i < count; i++)
+            {
+                batch.push_back(move(m_pending.front()));
+                m_pending.pop_front();
+            }
+        }
+        run_batch(batch);
+    }
+}
+
+void runtime::BatchingExecutor::run_batch(vector<Request>& batch)
+{
+    auto start = chrono::steady_clock::now();
+    // Until staging completes, every row up to the larger of the two batches may hold a
+    // sample, so a batch that fails halfway still has its rows cleared by the next one
+    size_t stale_rows = m_last_batch_size;
+    m_last_batch_size = max(m_last_batch_size, batch.size());
+    try
+    {
+        for (size_t i = 0; i < m_batched_inputs.size(); i++)
+        {
+            const shared_ptr<op::Parameter>& param = m_function->get_parameters()[i];
+            size_t size = sample_byte_size(param->get_element_type(), param->get_shape());
+            for (size_t r = 0; r < batch.size(); r++)
+            {
+                batch[r].inputs[i]->read(m_staging.data(), 0, size);
+                m_batched_inputs[i]->write(m_staging.data(), r * size, size);
+            }
+            // Clear rows left behind by a larger previous batch so stale samples, which may
+            // hold NaNs or Infs, do not reach the kernels
+            if (batch.size() < stale_rows)
+            {
+                fill(m_staging.begin(), m_staging.begin() + size, 0);
+                for (size_t r = batch.size(); r < stale_rows; r++)
+                {
+                    m_batched_inputs[i]->write(m_staging.data(), r * size, size);
+                }
+            }
+        }
+        m_last_batch_size = batch.size();
+
+        m_backend->call(m_batched_function, m_batched_outputs, m_batched_inputs);
+
+        for (size_t i = 0; i < m_batched_outputs.size(); i++)
+        {
+            size_t size = sample_byte_size(m_function->get_output_element_type(i),
+                                           m_function->get_output_shape(i));
+            for (size_t r = 0; r < batch.size(); r++)
+            {
+                m_batched_outputs[i]->read(m_staging.data(), r * size, size);
+                batch[r].outputs[i]->write(m_staging.data(), 0, size);
+            }
+        }
+    }
+    catch (...)
+    {
+        for (Request& request : batch)
+        {
+            request.result.set_exception(current_exception());
+        }
+        return;
+    }
+    auto end = chrono::steady_clock::now();
+
+    for (Request& request : batch)
+    {
+        RequestStats stats;
+        stats.queue_time = chrono::duration_cast<chrono::microseconds>(start - request.submitted);
+        stats.execution_time = chrono::duration_cast<chrono::microseconds>(end - start);
+        stats.batch_size = batch.size();
+        request.result.set_value(stats);
+    }
+}
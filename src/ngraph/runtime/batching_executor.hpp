@@ -0,0 +1,115 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ngraph/function.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class Backend;
+        class Tensor;
+        class BatchingExecutor;
+    }
+}
+
+/// \brief Gathers single-sample calls into batches and runs them on a batched copy of a
+/// Function.
+///
+/// Every parameter and result of the Function must have a leading batch axis of size 1. The
+/// executor clones the Function with a batch axis of `max_batch_size` and compiles it once.
+/// Requests are collected until either `max_batch_size` of them are pending or the oldest has
+/// waited `max_latency`. Their inputs are then copied into the batched inputs, the batched
+/// function is called once, and each result row is copied back to its caller. Partial batches
+/// are padded with zero rows. The constructor rejects Functions containing an op that could mix
+/// samples across the batch axis, such as a reduction over it; only ops known to compute each
+/// output row from the same input row are accepted.
+class ngraph::runtime::BatchingExecutor
+{
+public:
+    /// \brief Latency breakdown of a single request
+    struct RequestStats
+    {
+        /// Time from submission until the request's batch started executing
+        std::chrono::microseconds queue_time;
+        /// Time to gather, execute and scatter the request's batch
+        std::chrono::microseconds execution_time;
+        /// Number of requests that shared the batch
+        size_t batch_size;
+    };
+
+    BatchingExecutor(const std::shared_ptr<Backend>& backend,
+                     const std::shared_ptr<Function>& func,
+                     size_t max_batch_size,
+                     std::chrono::microseconds max_latency);
+    ~BatchingExecutor();
+
+    /// \brief Submit a single-sample call. The tensors must stay alive until the returned
+    ///     future is ready.
+    /// \param outputs Tensors receiving the results of the single-sample Function
+    /// \param inputs Tensors matching the parameters of the single-sample Function
+    /// \returns future holding the request's latency breakdown, or the exception raised while
+    ///     executing its batch
+    std::future<RequestStats> call(const std::vector<std::shared_ptr<Tensor>>& outputs,
+                                   const std::vector<std::shared_ptr<Tensor>>& inputs);
+
+    std::shared_ptr<Function> get_batched_function() const { return m_batched_function; }
+    size_t get_max_batch_size() const { return m_max_batch_size; }
+    std::chrono::microseconds get_max_latency() const { return m_max_latency; }
+private:
+    BatchingExecutor(const BatchingExecutor&) = delete;
+    BatchingExecutor(BatchingExecutor&&) = delete;
+    BatchingExecutor& operator=(const BatchingExecutor&) = delete;
+
+    struct Request
+    {
+        std::vector<std::shared_ptr<Tensor>> outputs;
+        std::vector<std::shared_ptr<Tensor>> inputs;
+        std::chrono::steady_clock::time_point submitted;
+        std::promise<RequestStats> result;
+    };
+
+    void dispatch_loop();
+    void run_batch(std::vector<Request>& batch);
+
+    std::shared_ptr<Backend> m_backend;
+    std::shared_ptr<Function> m_function;
+    std::shared_ptr<Function> m_batched_function;
+    size_t m_max_batch_size;
+    std::chrono::microseconds m_max_latency;
+    std::vector<std::shared_ptr<Tensor>> m_batched_inputs;
+    std::vector<std::shared_ptr<Tensor>> m_batched_outputs;
+    std::vector<char> m_staging;
+    size_t m_last_batch_size;
+
+    bool m_stopping;
+    std::deque<Request> m_pending;
+    std::mutex m_mutex;
+    std::condition_variable m_has_work;
+    std::thread m_dispatcher;
+};
@@ -0,0 +1,82 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/call_queue.hpp"
+#include "ngraph/except.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::CallQueue::CallQueue(size_t worker_count, size_t capacity)
+    : m_capacity(capacity)
+    , m_stopping(false)
+{
+    if (worker_count == 0 || capacity == 0)
+    {
+        throw ngraph_error("CallQueue requires at least one worker and a non-zero capacity");
+    }
+    for (size_t i = 0; i < worker_count; i++)
+    {
+        m_workers.emplace_back(&CallQueue::worker_loop, this);
+    }
+}
+
+runtime::CallQueue::~CallQueue()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_not_empty.notify_all();
+    for (auto& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+future<bool> runtime::CallQueue::submit(function<bool()> call)
+{
+    packaged_task<bool()> task(move(call));
+    auto result = task.get_future();
+    {
+        unique_lock<mutex> lock(m_mutex);
+        m_not_full.wait(lock, [this] { return m_pending.size() < m_capacity; });
+        m_pending.push_back(move(task));
+    }
+    m_not_empty.notify_one();
+    return result;
+}
+
+void runtime::CallQueue::worker_loop()
+{
+    while (true)
+    {
+        packaged_task<bool()> task;
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_not_empty.wait(lock, [this] { return m_stopping || !m_pending.empty(); });
+            if (m_pending.empty())
+            {
+                // Only reached when stopping, after the backlog has drained
+                return;
+            }
+            task = move(m_pending.front());
+            m_pending.pop_front();
+        }
+        m_not_full.notify_one();
+        task();
+    }
+}
@@ -0,0 +1,67 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class CallQueue;
+    }
+}
+
+/// \brief A bounded FIFO of pending calls serviced by a fixed pool of worker threads.
+///
+/// submit() blocks while the queue holds `capacity` pending calls, which applies backpressure
+/// to producers instead of letting the backlog grow without bound. Destroying the queue waits
+/// for every submitted call to finish.
+class ngraph::runtime::CallQueue
+{
+public:
+    CallQueue(size_t worker_count, size_t capacity);
+    ~CallQueue();
+
+    /// \brief Enqueue a call for execution on one of the workers.
+    /// \returns future holding the call's result, or the exception it threw
+    std::future<bool> submit(std::function<bool()> call);
+
+    size_t get_worker_count() const { return m_workers.size(); }
+    size_t get_capacity() const { return m_capacity; }
+private:
+    CallQueue(const CallQueue&) = delete;
+    CallQueue(CallQueue&&) = delete;
+    CallQueue& operator=(const CallQueue&) = delete;
+
+    void worker_loop();
+
+    size_t m_capacity;
+    bool m_stopping;
+    std::deque<std::packaged_task<bool()>> m_pending;
+    std::mutex m_mutex;
+    std::condition_variable m_not_empty;
+    std::condition_variable m_not_full;
+    std::vector<std::thread> m_workers;
+};
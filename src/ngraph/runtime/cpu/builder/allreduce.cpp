@@ -34,8 +34,8 @@ namespace ngraph
             {
                 auto& functors = external_function->get_functors();
 
-                auto& arg_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
                 auto count = static_cast<int>(out[0].get_size());
                 auto data_type = MLSL::DT_FLOAT;
 
@@ -48,10 +48,15 @@ namespace ngraph
                     data_type = MLSL::DT_DOUBLE;
                 }
 
-                auto functor = [&, count, data_type](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
+                auto functor = [&, count, data_type, arg_buffer_index, out_buffer_index](
+                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
                     MLSL::CommReq* req = ctx->mlsl_dist->AllReduce(
-                        arg_tensor, out_tensor, count, data_type, MLSL::RT_SUM, MLSL::GT_DATA);
+                        ctx->buffer_data[arg_buffer_index],
+                        ctx->buffer_data[out_buffer_index],
+                        count,
+                        data_type,
+                        MLSL::RT_SUM,
+                        MLSL::GT_DATA);
                     ctx->mlsl_env->Wait(req);
                 };
 
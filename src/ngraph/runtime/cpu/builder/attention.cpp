@@ -0,0 +1,108 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/op/attention.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/attention.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::ScaledDotProductAttention)
+            {
+                auto& functors = external_function->get_functors();
+
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto arg2_buffer_index = external_function->get_buffer_index(args[2].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto scale =
+                    static_cast<const ngraph::op::ScaledDotProductAttention*>(node)->get_scale();
+                auto& query_shape = args[0].get_shape();
+                auto& key_shape = args[1].get_shape();
+                auto& value_shape = args[2].get_shape();
+                size_t rank = query_shape.size();
+                size_t batches = rank == 3 ? query_shape[0] : 1;
+                size_t query_length = query_shape[rank - 2];
+                size_t key_length = key_shape[rank - 2];
+                size_t depth = query_shape[rank - 1];
+                size_t value_depth = value_shape[rank - 1];
+
+                std::function<void(void*,
+                                   void*,
+                                   void*,
+                                   void*,
+                                   size_t,
+                                   size_t,
+                                   size_t,
+                                   size_t,
+                                   size_t,
+                                   double,
+                                   int)>
+                    kernel;
+                if (args[0].get_element_type() == element::f32)
+                {
+                    kernel = runtime::cpu::kernel::scaled_dot_product_attention<float>;
+                }
+                else if (args[0].get_element_type() == element::f64)
+                {
+                    kernel = runtime::cpu::kernel::scaled_dot_product_attention<double>;
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported element type for ScaledDotProductAttention");
+                }
+
+                auto functor = [&,
+                                kernel,
+                                batches,
+                                query_length,
+                                key_length,
+                                depth,
+                                value_depth,
+                                scale,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                arg2_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[arg0_buffer_index],
+                           ctx->buffer_data[arg1_buffer_index],
+                           ctx->buffer_data[arg2_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           batches,
+                           query_length,
+                           key_length,
+                           depth,
+                           value_depth,
+                           scale,
+                           ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            REGISTER_OP_BUILDER(ScaledDotProductAttention);
+        }
+    }
+}
@@ -37,7 +37,7 @@ namespace ngraph
 
                 auto& functors = external_function->get_functors();
 
-                vector<reference_wrapper<void*>> arg_tensors;
+                vector<size_t> arg_buffer_indices;
                 vector<Shape> arg_shapes;
                 vector<size_t> arg_sizes;
                 auto element_size = concat->get_input_element_type(0).size();
@@ -45,15 +45,15 @@ namespace ngraph
                 {
                     if (shape_size(arg.get_shape()))
                     {
-                        arg_tensors.emplace_back(
-                            external_function->get_tensor_data(arg.get_name()));
+                        arg_buffer_indices.emplace_back(
+                            external_function->get_buffer_index(arg.get_name()));
                         arg_shapes.emplace_back(arg.get_shape());
                         arg_sizes.emplace_back(shape_size(arg.get_shape()) * element_size);
                     }
                 }
                 auto nargs = args.size();
 
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
                 auto out_shape = out[0].get_shape();
 
                 if (auto op_annotations = concat->get_op_annotations())
@@ -63,21 +63,25 @@ namespace ngraph
                     {
                         auto out_size = shape_size(out_shape) * element_size;
 
-                        auto functor = [&, arg_tensors, nargs, out_size, arg_sizes](
-                            CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        auto functor = [&,
+                                        arg_buffer_indices,
+                                        nargs,
+                                        out_size,
+                                        arg_sizes,
+                                        out_buffer_index](CPURuntimeContext* ctx,
+                                                          CPUExecutionContext* ectx) {
+                            auto out_ptr = static_cast<char*>(ctx->buffer_data[out_buffer_index]);
                             auto offset = 0;
                             for (size_t i = 0; i < nargs; i++)
                             {
+                                auto arg_ptr = static_cast<char*>(
+                                    ctx->buffer_data[arg_buffer_indices[i]]);
                                 // if the argument pointer does not fall within the concat output buffer
                                 // (caused by propagate_in_place_output or propagate_in_place_input), we need to copy the data;
                                 // otherwise, we can skip the copy.
-                                if (arg_tensors[i] < out_tensor ||
-                                    arg_tensors[i] >=
-                                        reinterpret_cast<char*>(out_tensor) + out_size)
+                                if (arg_ptr < out_ptr || arg_ptr >= out_ptr + out_size)
                                 {
-                                    memcpy(reinterpret_cast<char*>(out_tensor) + offset,
-                                           arg_tensors[i],
-                                           arg_sizes[i]);
+                                    memcpy(out_ptr + offset, arg_ptr, arg_sizes[i]);
                                 }
                                 offset += arg_sizes[i];
                             }
@@ -106,13 +110,15 @@ namespace ngraph
                         mkldnn_emitter->build_concat(inputs_data_desc, result_desc, concat_dim);
                     auto& deps = mkldnn_emitter->get_primitive_deps(concat_index);
 
-                    auto functor = [&, arg_tensors, nargs, concat_index](
+                    auto functor = [&, arg_buffer_indices, nargs, concat_index, out_buffer_index](
                         CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
                         for (size_t i = 0; i < nargs; i++)
                         {
-                            cpu::mkldnn_utils::set_memory_ptr(ctx, deps[i], arg_tensors[i]);
+                            cpu::mkldnn_utils::set_memory_ptr(
+                                ctx, deps[i], ctx->buffer_data[arg_buffer_indices[i]]);
                         }
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[nargs], out_tensor);
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[nargs], ctx->buffer_data[out_buffer_index]);
                         cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, concat_index);
                     };
 
@@ -127,9 +133,24 @@ namespace ngraph
                                           out[0].get_shape().size(),
                                           runtime::cpu::kernel::concat);
 
-                    auto functor = [&, kernel, arg_tensors, arg_shapes, out_shape, axis](
-                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                        kernel(arg_tensors, arg_shapes, out_tensor, out_shape, axis);
+                    auto functor = [&,
+                                    kernel,
+                                    arg_buffer_indices,
+                                    arg_shapes,
+                                    out_shape,
+                                    axis,
+                                    out_buffer_index](CPURuntimeContext* ctx,
+                                                      CPUExecutionContext* ectx) {
+                        vector<void*> arg_tensors;
+                        for (auto index : arg_buffer_indices)
+                        {
+                            arg_tensors.push_back(ctx->buffer_data[index]);
+                        }
+                        kernel(arg_tensors,
+                               arg_shapes,
+                               ctx->buffer_data[out_buffer_index],
+                               out_shape,
+                               axis);
                     };
                     functors.emplace_back(functor);
                 }
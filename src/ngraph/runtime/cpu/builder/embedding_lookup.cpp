@@ -14,11 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
-#include <cstring>
-
 #include "ngraph/op/embedding_lookup.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
-#include "ngraph/runtime/reference/embedding_lookup.hpp"
+#include "ngraph/runtime/cpu/kernel/embedding_lookup.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -33,96 +31,38 @@ namespace ngraph
             void Builder::BUILDER_DECL(ngraph::op::EmbeddingLookup)
             {
                 auto& functors = external_function->get_functors();
-                auto& tensor_data = external_function->get_tensor_data();
-
-                CPUKernelFunctor functor;
-
-                auto& arg0_tensor = tensor_data[args[0].get_name()];
-                auto& arg1_tensor = tensor_data[args[1].get_name()];
-                auto& out_tensor = tensor_data[out[0].get_name()];
-                if (out[0].get_element_type() != element::f32 &&
-                    out[0].get_element_type() != element::f64)
-                {
-                    throw ngraph_error("Unsupported output element type");
-                }
-                auto in_shape = args[1].get_shape();
-                size_t element_count = shape_size(args[0].get_shape());
-                auto out_shape = out[0].get_shape();
-                auto element_type = out[0].get_element_type();
-                auto index_element_type = args[0].get_element_type();
-                if (element_type == element::f32)
-                {
-                    if (index_element_type == element::f32)
-                    {
-                        functor = [&, in_shape, element_count](CPURuntimeContext* ctx,
-                                                               CPUExecutionContext* ectx) {
 
-                            ngraph::runtime::reference::embedding<float, float>(
-                                static_cast<float*>(arg0_tensor),
-                                static_cast<float*>(arg1_tensor),
-                                static_cast<float*>(out_tensor),
-                                element_count,
-                                in_shape);
-                        };
-                    }
-                    else if (index_element_type == element::i32)
-                    {
-                        functor = [&, in_shape, element_count](CPURuntimeContext* ctx,
-                                                               CPUExecutionContext* ectx) {
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
-                            ngraph::runtime::reference::embedding<float, int>(
-                                static_cast<int*>(arg0_tensor),
-                                static_cast<float*>(arg1_tensor),
-                                static_cast<float*>(out_tensor),
-                                element_count,
-                                in_shape);
-                        };
-                    }
-                    else
-                    {
-                        throw ngraph_error(
-                            "Unsupported index type in CPU Builder for EmbeddingLookup");
-                    }
-                }
-                else if (element_type == element::i32)
-                {
-                    if (index_element_type == element::f32)
-                    {
-                        functor = [&, in_shape, element_count](CPURuntimeContext* ctx,
-                                                               CPUExecutionContext* ectx) {
+                size_t indices_count = args[0].get_size();
+                auto weights_shape = args[1].get_shape();
+                size_t vocab_size = weights_shape.at(0);
+                size_t row_bytes = weights_shape.at(1) * args[1].get_element_type().size();
 
-                            ngraph::runtime::reference::embedding<int, float>(
-                                static_cast<float*>(arg0_tensor),
-                                static_cast<int*>(arg1_tensor),
-                                static_cast<int*>(out_tensor),
-                                element_count,
-                                in_shape);
-                        };
-                    }
-                    else if (index_element_type == element::i32)
-                    {
-                        functor = [&, in_shape, element_count](CPURuntimeContext* ctx,
-                                                               CPUExecutionContext* ectx) {
+                std::function<decltype(runtime::cpu::kernel::embedding_lookup<int>)> kernel;
 
-                            ngraph::runtime::reference::embedding<int, int>(
-                                static_cast<int*>(arg0_tensor),
-                                static_cast<int*>(arg1_tensor),
-                                static_cast<int*>(out_tensor),
-                                element_count,
-                                in_shape);
-                        };
-                    }
-                    else
-                    {
-                        throw ngraph_error(
-                            "Unsupported index type in CPU Builder for EmbeddingLookup");
-                    }
-                }
-                else
-                {
-                    throw ngraph_error("Unsupported type in CPU Builder for ArgMin");
-                }
+                SELECT_KERNEL(
+                    kernel, args[0].get_element_type(), runtime::cpu::kernel::embedding_lookup);
 
+                auto functor = [&,
+                                kernel,
+                                indices_count,
+                                vocab_size,
+                                row_bytes,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[arg0_buffer_index],
+                           ctx->buffer_data[arg1_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           indices_count,
+                           vocab_size,
+                           row_bytes,
+                           ectx->arena);
+                };
                 functors.emplace_back(functor);
             }
 
@@ -39,7 +39,7 @@ namespace ngraph
                 auto& callees = external_function->get_callees();
 
                 // Note: We bypass the completely broken ngraph "backend" API here
-                vector<reference_wrapper<void *>> arg_tensors, out_tensors;
+                vector<size_t> arg_buffer_indices, out_buffer_indices;
                 vector<Shape> arg_shapes, out_shapes;
                 vector<element::Type> arg_types, out_types;
 
@@ -47,14 +47,16 @@ namespace ngraph
                 {
                     arg_shapes.emplace_back(arg.get_shape());
                     arg_types.emplace_back(arg.get_element_type());
-                    arg_tensors.emplace_back(external_function->get_tensor_data(arg.get_name()));
+                    arg_buffer_indices.emplace_back(
+                        external_function->get_buffer_index(arg.get_name()));
                 }
 
                 for (const auto& result : out)
                 {
                     out_shapes.emplace_back(result.get_shape());
                     out_types.emplace_back(result.get_element_type());
-                    out_tensors.emplace_back(external_function->get_tensor_data(result.get_name()));
+                    out_buffer_indices.emplace_back(
+                        external_function->get_buffer_index(result.get_name()));
                 }
 
                 if (!callees.count(function->get_name()))
@@ -68,20 +70,21 @@ namespace ngraph
                                 backend,
                                 arg_shapes,
                                 arg_types,
-                                arg_tensors,
+                                arg_buffer_indices,
                                 out_shapes,
                                 out_types,
-                                out_tensors](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                                out_buffer_indices](CPURuntimeContext* ctx,
+                                                    CPUExecutionContext* ectx) {
                     TensorViewPtrs inputs, outputs;
                     for (int i = 0; i < arg_shapes.size(); i++)
                     {
-                        inputs.emplace_back(
-                            backend->create_tensor(arg_types[i], arg_shapes[i], arg_tensors[i]));
+                        inputs.emplace_back(backend->create_tensor(
+                            arg_types[i], arg_shapes[i], ctx->buffer_data[arg_buffer_indices[i]]));
                     }
                     for (int i = 0; i < out_shapes.size(); i++)
                     {
-                        outputs.emplace_back(
-                            backend->create_tensor(out_types[i], out_shapes[i], out_tensors[i]));
+                        outputs.emplace_back(backend->create_tensor(
+                            out_types[i], out_shapes[i], ctx->buffer_data[out_buffer_indices[i]]));
                     }
 
                     auto call_frame = callee_external_function->make_call_frame();
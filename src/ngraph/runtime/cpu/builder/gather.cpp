@@ -0,0 +1,88 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/gather.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/gather.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Gather)
+            {
+                auto& functors = external_function->get_functors();
+
+                auto data_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto indices_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                size_t axis = static_cast<const ngraph::op::Gather*>(node)->get_axis();
+                size_t indices_count = args[1].get_size();
+                auto data_shape = args[0].get_shape();
+                size_t outer = shape_size(Shape(data_shape.begin(), data_shape.begin() + axis));
+                size_t axis_len = data_shape.at(axis);
+                size_t inner = shape_size(Shape(data_shape.begin() + axis + 1, data_shape.end()));
+
+                std::function<decltype(runtime::cpu::kernel::gather_i32<float>)> kernel;
+
+                if (args[1].get_element_type() == element::i32)
+                {
+                    SELECT_KERNEL(
+                        kernel, args[0].get_element_type(), runtime::cpu::kernel::gather_i32);
+                }
+                else if (args[1].get_element_type() == element::i64)
+                {
+                    SELECT_KERNEL(
+                        kernel, args[0].get_element_type(), runtime::cpu::kernel::gather_i64);
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported index element type in Gather");
+                }
+
+                auto functor = [&,
+                                kernel,
+                                indices_count,
+                                outer,
+                                axis_len,
+                                inner,
+                                data_buffer_index,
+                                indices_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[data_buffer_index],
+                           ctx->buffer_data[indices_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           indices_count,
+                           outer,
+                           axis_len,
+                           inner,
+                           ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            REGISTER_OP_BUILDER(Gather);
+        }
+    }
+}
@@ -36,10 +36,11 @@ namespace ngraph
                 auto& functors = external_function->get_functors();
                 auto goe = static_cast<const ngraph::op::GetOutputElement*>(node);
                 size_t n = goe->get_n();
-                auto& arg_tensor = external_function->get_tensor_data(args[n].get_name());
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
-                auto functor = [&, n](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                    if (arg_tensor != out_tensor)
+                auto arg_buffer_index = external_function->get_buffer_index(args[n].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto functor = [&, n, arg_buffer_index, out_buffer_index](
+                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    if (ctx->buffer_data[arg_buffer_index] != ctx->buffer_data[out_buffer_index])
                     {
                         throw ngraph_error("GOE's input and out must be equal");
                     }
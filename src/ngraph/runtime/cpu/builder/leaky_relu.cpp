@@ -34,8 +34,8 @@ namespace ngraph
             {
                 auto& functors = external_function->get_functors();
 
-                auto& input_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto input_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
                 size_t count = out[0].get_size();
 
                 auto alpha = static_cast<const op::LeakyRelu*>(node)->get_alpha();
@@ -48,10 +48,12 @@ namespace ngraph
                     auto leaky_relu_index =
                         mkldnn_emitter->build_leaky_relu(input_desc, result_desc, alpha);
                     auto& deps = mkldnn_emitter->get_primitive_deps(leaky_relu_index);
-                    auto functor = [&, leaky_relu_index](CPURuntimeContext* ctx,
-                                                         CPUExecutionContext* ectx) {
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], input_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], out_tensor);
+                    auto functor = [&, leaky_relu_index, input_buffer_index, out_buffer_index](
+                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[0], ctx->buffer_data[input_buffer_index]);
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[1], ctx->buffer_data[out_buffer_index]);
                         cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, leaky_relu_index);
                     };
                     functors.emplace_back(functor);
@@ -63,9 +65,13 @@ namespace ngraph
                     SELECT_KERNEL(
                         kernel, out[0].get_element_type(), runtime::cpu::kernel::leaky_relu);
 
-                    auto functor = [&, kernel, alpha, count](CPURuntimeContext* ctx,
-                                                             CPUExecutionContext* ectx) {
-                        kernel(input_tensor, out_tensor, alpha, count, ectx->arena);
+                    auto functor = [&, kernel, alpha, count, input_buffer_index, out_buffer_index](
+                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        kernel(ctx->buffer_data[input_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
+                               alpha,
+                               count,
+                               ectx->arena);
                     };
                     functors.emplace_back(functor);
                 }
@@ -14,18 +14,16 @@
 // limitations under the License.
 //*****************************************************************************
 
-#include <Halide.h>
-#include <HalideBuffer.h>
-#include <functional>
 #include <set>
-#include <string>
 #include <typeindex>
 #include <typeinfo>
 #include <unordered_map>
 
 #include "ngraph/op/abs.hpp"
 #include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
 #include "ngraph/op/divide.hpp"
+#include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/maximum.hpp"
 #include "ngraph/op/minimum.hpp"
 #include "ngraph/op/multiply.hpp"
@@ -33,8 +31,8 @@
 #include "ngraph/op/relu.hpp"
 #include "ngraph/op/subtract.hpp"
 
-#include "halide_generators.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/loop_kernel.hpp"
 #include "ngraph/runtime/cpu/op/loop_kernel.hpp"
 
 using namespace std;
@@ -48,103 +46,246 @@ namespace ngraph
     {
         namespace cpu
         {
+            // GOEE doesn't see GOEs in subgraphs that are hidden inside LoopKernels
+            // we have to manually propagate the source output
+            static const descriptor::Output* get_goe_input_output(const descriptor::Output* output)
+            {
+                auto it = output;
+                while (auto goe =
+                           dynamic_pointer_cast<ngraph::op::GetOutputElement>(it->get_node()))
+                {
+                    it = &goe->get_inputs().at(goe->get_n()).get_output();
+                }
+                return it;
+            }
+
             template <>
             void Builder::BUILDER_DECL(ngraph::runtime::cpu::op::LoopKernel)
             {
-                const ngraph::runtime::cpu::op::LoopKernel* hs =
+                using kernel::loop::Opcode;
+                using kernel::loop::Instruction;
+
+                static const unordered_map<type_index, Opcode> opcodes{
+                    {TI(ngraph::op::Add), Opcode::Add},
+                    {TI(ngraph::op::Subtract), Opcode::Subtract},
+                    {TI(ngraph::op::Multiply), Opcode::Multiply},
+                    {TI(ngraph::op::Divide), Opcode::Divide},
+                    {TI(ngraph::op::Minimum), Opcode::Minimum},
+                    {TI(ngraph::op::Maximum), Opcode::Maximum},
+                    {TI(ngraph::op::Negative), Opcode::Negative},
+                    {TI(ngraph::op::Abs), Opcode::Abs},
+                    {TI(ngraph::op::Relu), Opcode::Relu}};
+
+                const ngraph::runtime::cpu::op::LoopKernel* lk =
                     static_cast<const ngraph::runtime::cpu::op::LoopKernel*>(node);
+                const NodeVector& node_list = lk->get_node_list();
+                const NodeVector& output_nodes = lk->get_kernel_outputs();
+                auto& functors = external_function->get_functors();
 
-                const auto& generators = ngraph::runtime::cpu::halide::get_halide_generators();
+                auto element_type = out[0].get_element_type();
+                size_t count = out[0].get_size();
 
-                auto& halide_functions = external_function->get_halide_functions();
-                auto& subgraph_params = external_function->get_subgraph_params();
-                auto& subgraph_param_sizes = external_function->get_subgraph_param_sizes();
-                auto& subgraph_param_ptrs = external_function->get_subgraph_param_ptrs();
+                // Broadcasts of single elements read straight from the splatted input, others
+                // tile or repeat their input into a register of their own
+                unordered_map<const descriptor::Output*, const descriptor::Output*> aliases;
+                auto resolve = [&aliases](const descriptor::Output* output) {
+                    output = get_goe_input_output(output);
+                    auto alias = aliases.find(output);
+                    return alias != aliases.end() ? alias->second : output;
+                };
 
-                std::set<std::string> param_names;
-                for (const auto& op : hs->get_node_list())
+                unordered_map<const descriptor::Output*, size_t> last_use;
+                for (size_t i = 0; i < node_list.size(); i++)
                 {
-                    if (!generators.count(TI(*op)))
+                    auto& op_node = node_list[i];
+                    if (op_node->get_output_size() > 1)
                     {
-                        throw ngraph_error("Invalid op in halide subgraph");
+                        throw ngraph_error("no multi-output ops in a LoopKernel");
+                    }
+                    if (op_node->get_element_type() != element_type ||
+                        shape_size(op_node->get_shape()) != count)
+                    {
+                        throw ngraph_error("LoopKernel ops must share one element type and shape");
                     }
-                    vector<Halide::Func> inputs;
-                    for (const auto& input : op->get_inputs())
+                    if (auto broadcast = dynamic_pointer_cast<ngraph::op::Broadcast>(op_node))
                     {
-                        auto tensor_name = input.get_output().get_tensor_ptr()->get_name();
-                        if (halide_functions.count(tensor_name))
+                        auto pattern = runtime::cpu::op::get_loop_broadcast(*broadcast);
+                        if (pattern.period == 0)
                         {
-                            inputs.emplace_back(halide_functions[tensor_name]);
+                            throw ngraph_error(
+                                "LoopKernel only broadcasts along leading or trailing axes");
                         }
-                        else
+                        if (pattern.period != 1)
                         {
-                            if (param_names.count(tensor_name) == 0)
-                            {
-                                param_names.insert(tensor_name);
-                                subgraph_params[tensor_name] =
-                                    Halide::ImageParam(Halide::Float(32), 1, tensor_name);
-                                subgraph_param_sizes[tensor_name] =
-                                    shape_size(input.get_output().get_tensor_ptr()->get_shape());
-                                subgraph_param_ptrs.emplace(
-                                    tensor_name, external_function->get_tensor_data(tensor_name));
-                                inputs.emplace_back(subgraph_params[tensor_name]);
-                            }
-                            else
-                            {
-                                inputs.emplace_back(subgraph_params[tensor_name]);
-                            }
+                            continue;
                         }
+                        auto value = resolve(&op_node->get_inputs().at(0).get_output());
+                        aliases[&op_node->get_outputs().at(0)] = value;
+                        last_use[value] = i;
+                        continue;
                     }
-                    //TODO: this needs to be extended to support multi-output ops inside
-                    //a subgraph
-                    if (op->get_outputs().size() > 1)
+                    for (auto& input : op_node->get_inputs())
                     {
-                        throw ngraph_error("no multi-output ops in a LoopKernel");
+                        last_use[resolve(&input.get_output())] = i;
                     }
-                    halide_functions[op->get_output_tensor_ptr()->get_name()] =
-                        generators.at(TI(*op))(inputs);
                 }
 
-                auto& functors = external_function->get_functors();
-
-                std::vector<std::tuple<void*&, size_t>> buffers_data;
-                std::vector<Halide::Expr> results;
+                kernel::loop::Program program;
+                program.num_registers = 0;
+                vector<size_t> free_registers;
+                unordered_map<const descriptor::Output*, size_t> registers;
+                auto allocate_register = [&]() {
+                    if (free_registers.empty())
+                    {
+                        return program.num_registers++;
+                    }
+                    size_t reg = free_registers.back();
+                    free_registers.pop_back();
+                    return reg;
+                };
 
-                auto output_nodes = hs->get_kernel_outputs();
-                Halide::Var x;
-                for (size_t i = 0; i < output_nodes.size(); i++)
+                unordered_map<const descriptor::Output*, size_t> arg_indices;
+                for (size_t i = 0; i < args.size(); i++)
                 {
-                    auto result_func =
-                        halide_functions[output_nodes.at(i)->get_output_tensor_ptr()->get_name()];
-                    results.push_back((result_func(x) + 0));
-                    auto& out_tensor = external_function->get_tensor_data(out[i].get_name());
-                    buffers_data.push_back(
-                        std::tuple<void*&, size_t>(out_tensor, out[i].get_size()));
+                    auto value = resolve(&lk->get_inputs().at(i).get_output());
+                    arg_indices[value] = i;
+                    if (registers.count(value) != 0 || last_use.count(value) == 0)
+                    {
+                        continue;
+                    }
+                    Opcode opcode;
+                    if (args[i].get_size() == count)
+                    {
+                        opcode = Opcode::Load;
+                    }
+                    else if (args[i].get_size() == 1)
+                    {
+                        opcode = Opcode::Splat;
+                    }
+                    else
+                    {
+                        throw ngraph_error("LoopKernel input " + args[i].get_name() +
+                                           " has neither the output size nor a single element");
+                    }
+                    registers[value] = allocate_register();
+                    program.instructions.push_back(Instruction{opcode, registers[value], i, 0});
                 }
 
-                Halide::Func terminal_func;
-                terminal_func(x) = Halide::Tuple(results);
-                CPUKernelFunctor functor = [&, terminal_func, buffers_data, param_names](
-                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) mutable {
+                for (size_t i = 0; i < node_list.size(); i++)
+                {
+                    auto& op_node = node_list[i];
+                    const Node& n = *op_node;
+                    if (auto broadcast = dynamic_pointer_cast<ngraph::op::Broadcast>(op_node))
+                    {
+                        auto pattern = runtime::cpu::op::get_loop_broadcast(*broadcast);
+                        auto value = resolve(&op_node->get_outputs().at(0));
+                        if (pattern.period != 1)
+                        {
+                            auto input = resolve(&op_node->get_inputs().at(0).get_output());
+                            registers[value] = allocate_register();
+                            program.instructions.push_back(
+                                Instruction{pattern.tile ? Opcode::Tile : Opcode::Repeat,
+                                            registers[value],
+                                            arg_indices.at(input),
+                                            pattern.period});
+                        }
+                        for (size_t j = 0; j < output_nodes.size(); j++)
+                        {
+                            if (output_nodes[j] == op_node)
+                            {
+                                program.instructions.push_back(
+                                    Instruction{Opcode::Store, j, registers.at(value), 0});
+                            }
+                        }
+                        if (last_use.count(value) == 0 || last_use.at(value) == i)
+                        {
+                            free_registers.push_back(registers.at(value));
+                        }
+                        continue;
+                    }
+                    auto opcode = opcodes.find(TI(n));
+                    if (opcode == opcodes.end())
+                    {
+                        throw ngraph_error("Unsupported op " + op_node->description() +
+                                           " in LoopKernel");
+                    }
+                    if (opcode->second == Opcode::Divide && !element_type.is_real())
+                    {
+                        // integer division has to throw on a zero divisor
+                        throw ngraph_error("LoopKernel only divides real numbers");
+                    }
+
+                    set<const descriptor::Output*> inputs;
+                    vector<size_t> arg_registers;
+                    for (auto& input : op_node->get_inputs())
+                    {
+                        auto value = resolve(&input.get_output());
+                        arg_registers.push_back(registers.at(value));
+                        inputs.insert(value);
+                    }
+                    // Values dying here can hand their register to the result, since every
+                    // element is read before the same element is written
+                    for (auto value : inputs)
+                    {
+                        if (last_use.at(value) == i)
+                        {
+                            free_registers.push_back(registers.at(value));
+                        }
+                    }
+
+                    auto value = &op_node->get_outputs().at(0);
+                    size_t reg = allocate_register();
+                    registers[value] = reg;
+                    program.instructions.push_back(Instruction{
+                        opcode->second, reg, arg_registers.at(0), arg_registers.back()});
 
-                    std::vector<Halide::Argument> halide_args;
-                    for (auto& param : param_names)
+                    for (size_t j = 0; j < output_nodes.size(); j++)
                     {
-                        Halide::Buffer<float> param_buffer(
-                            static_cast<float*>(subgraph_param_ptrs.at(param).get()),
-                            subgraph_param_sizes.at(param));
-                        subgraph_params[param].set(param_buffer);
+                        if (output_nodes[j] == op_node)
+                        {
+                            program.instructions.push_back(Instruction{Opcode::Store, j, reg, 0});
+                        }
                     }
-                    std::vector<Halide::Buffer<>> buffers;
-                    for (auto tuple : buffers_data)
+                    if (last_use.count(value) == 0)
                     {
-                        buffers.push_back(Halide::Buffer<float>(
-                            static_cast<float*>(std::get<0>(tuple)), std::get<1>(tuple)));
+                        free_registers.push_back(reg);
                     }
-                    Halide::Realization r(buffers);
-                    terminal_func.realize(r);
+                }
 
-                };
+                vector<size_t> input_buffer_indices;
+                for (auto& arg : args)
+                {
+                    input_buffer_indices.push_back(
+                        external_function->get_buffer_index(arg.get_name()));
+                }
+                vector<size_t> output_buffer_indices;
+                for (auto& result : out)
+                {
+                    output_buffer_indices.push_back(
+                        external_function->get_buffer_index(result.get_name()));
+                }
+
+                std::function<void(
+                    const kernel::loop::Program&, void* const*, void* const*, size_t, int)>
+                    kernel;
+
+                SELECT_KERNEL(kernel, element_type, runtime::cpu::kernel::loop_kernel);
+
+                auto functor =
+                    [&, kernel, program, input_buffer_indices, output_buffer_indices, count](
+                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        vector<void*> inputs;
+                        for (auto index : input_buffer_indices)
+                        {
+                            inputs.push_back(ctx->buffer_data[index]);
+                        }
+                        vector<void*> outputs;
+                        for (auto index : output_buffer_indices)
+                        {
+                            outputs.push_back(ctx->buffer_data[index]);
+                        }
+                        kernel(program, inputs.data(), outputs.data(), count, ectx->arena);
+                    };
                 functors.emplace_back(functor);
             }
         }
@@ -21,6 +21,7 @@
 #include "ngraph/op/quantize.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/kernel/quantization.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/reference/dequantize.hpp"
@@ -39,7 +40,6 @@ namespace ngraph
             void Builder::BUILDER_DECL(ngraph::op::Dequantize)
             {
                 auto& functors = external_function->get_functors();
-                auto& tensor_data = external_function->get_tensor_data();
 
                 const ngraph::op::Dequantize* dequantize =
                     static_cast<const ngraph::op::Dequantize*>(node);
@@ -47,43 +47,112 @@ namespace ngraph
 
                 if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
                 {
-                    auto& arg0_tensor = tensor_data[args[0].get_name()];
-                    auto& out_tensor = tensor_data[out[0].get_name()];
+                    auto arg0_buffer_index =
+                        external_function->get_buffer_index(args[0].get_name());
+                    auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
                     auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
                     auto input_desc = mkldnn_utils::get_input_mkldnn_md(node, 0);
                     auto result_desc = mkldnn_utils::get_output_mkldnn_md(node, 0);
                     size_t dequantize_index =
                         mkldnn_emitter->build_dequantization(node, input_desc, result_desc);
                     auto& deps = mkldnn_emitter->get_primitive_deps(dequantize_index);
-                    functor = [&, dequantize_index](CPURuntimeContext* ctx,
-                                                    CPUExecutionContext* ectx) {
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], arg0_tensor);
-                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], out_tensor);
+                    functor = [&, dequantize_index, arg0_buffer_index, out_buffer_index](
+                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[1], ctx->buffer_data[out_buffer_index]);
                         cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, dequantize_index);
                     };
                     functors.emplace_back(functor);
                 }
                 else
                 {
-                    auto& arg0_tensor = tensor_data[args[0].get_name()];
-                    auto& arg1_tensor = tensor_data[args[1].get_name()];
-                    auto& arg2_tensor = tensor_data[args[2].get_name()];
-                    auto& out_tensor = tensor_data[out[0].get_name()];
+                    auto arg0_buffer_index =
+                        external_function->get_buffer_index(args[0].get_name());
+                    auto arg1_buffer_index =
+                        external_function->get_buffer_index(args[1].get_name());
+                    auto arg2_buffer_index =
+                        external_function->get_buffer_index(args[2].get_name());
+                    auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
                     auto arg0_shape = args[0].get_shape();
                     auto arg1_shape = args[1].get_shape();
                     auto daxes = dequantize->get_axes();
 
-                    if (args[0].get_element_type() == element::i8)
+                    size_t outer, channels, inner;
+                    if (kernel::get_quantization_layout(arg0_shape, daxes, outer, channels, inner))
+                    {
+                        std::function<void(void*, void*, void*, void*, size_t, size_t, size_t, int)>
+                            kernel;
+                        auto in_type = args[0].get_element_type();
+                        auto out_type = out[0].get_element_type();
+                        if (in_type == element::i8 && out_type == element::f32)
+                        {
+                            kernel = runtime::cpu::kernel::dequantize<int8_t, float>;
+                        }
+                        else if (in_type == element::i8 && out_type == element::f64)
+                        {
+                            kernel = runtime::cpu::kernel::dequantize<int8_t, double>;
+                        }
+                        else if (in_type == element::u8 && out_type == element::f32)
+                        {
+                            kernel = runtime::cpu::kernel::dequantize<uint8_t, float>;
+                        }
+                        else if (in_type == element::u8 && out_type == element::f64)
+                        {
+                            kernel = runtime::cpu::kernel::dequantize<uint8_t, double>;
+                        }
+                        else if (in_type == element::i32 && out_type == element::f32)
+                        {
+                            kernel = runtime::cpu::kernel::dequantize<int32_t, float>;
+                        }
+                        else if (in_type == element::i32 && out_type == element::f64)
+                        {
+                            kernel = runtime::cpu::kernel::dequantize<int32_t, double>;
+                        }
+                        else
+                        {
+                            throw ngraph_error("Unsupported dequantization element type");
+                        }
+
+                        functor = [&,
+                                   kernel,
+                                   outer,
+                                   channels,
+                                   inner,
+                                   arg0_buffer_index,
+                                   arg1_buffer_index,
+                                   arg2_buffer_index,
+                                   out_buffer_index](CPURuntimeContext* ctx,
+                                                     CPUExecutionContext* ectx) {
+                            kernel(ctx->buffer_data[arg0_buffer_index],
+                                   ctx->buffer_data[arg1_buffer_index],
+                                   ctx->buffer_data[arg2_buffer_index],
+                                   ctx->buffer_data[out_buffer_index],
+                                   outer,
+                                   channels,
+                                   inner,
+                                   ectx->arena);
+                        };
+                    }
+                    else if (args[0].get_element_type() == element::i8)
                     {
                         if (out[0].get_element_type() == element::f32)
                         {
-                            functor = [&, arg0_shape, arg1_shape, daxes](
-                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                            functor = [&,
+                                       arg0_shape,
+                                       arg1_shape,
+                                       daxes,
+                                       arg0_buffer_index,
+                                       arg1_buffer_index,
+                                       arg2_buffer_index,
+                                       out_buffer_index](CPURuntimeContext* ctx,
+                                                         CPUExecutionContext* ectx) {
                                 ngraph::runtime::reference::dequantize<int8_t>(
-                                    static_cast<int8_t*>(arg0_tensor),
-                                    static_cast<float*>(arg1_tensor),
-                                    static_cast<int8_t*>(arg2_tensor),
-                                    static_cast<float*>(out_tensor),
+                                    static_cast<int8_t*>(ctx->buffer_data[arg0_buffer_index]),
+                                    static_cast<float*>(ctx->buffer_data[arg1_buffer_index]),
+                                    static_cast<int8_t*>(ctx->buffer_data[arg2_buffer_index]),
+                                    static_cast<float*>(ctx->buffer_data[out_buffer_index]),
                                     arg0_shape,
                                     arg1_shape,
                                     daxes);
@@ -91,13 +160,20 @@ namespace ngraph
                         }
                         else if (out[0].get_element_type() == element::f64)
                         {
-                            functor = [&, arg0_shape, arg1_shape, daxes](
-                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                            functor = [&,
+                                       arg0_shape,
+                                       arg1_shape,
+                                       daxes,
+                                       arg0_buffer_index,
+                                       arg1_buffer_index,
+                                       arg2_buffer_index,
+                                       out_buffer_index](CPURuntimeContext* ctx,
+                                                         CPUExecutionContext* ectx) {
                                 ngraph::runtime::reference::dequantize<int8_t>(
-                                    static_cast<int8_t*>(arg0_tensor),
-                                    static_cast<double*>(arg1_tensor),
-                                    static_cast<int8_t*>(arg2_tensor),
-                                    static_cast<double*>(out_tensor),
+                                    static_cast<int8_t*>(ctx->buffer_data[arg0_buffer_index]),
+                                    static_cast<double*>(ctx->buffer_data[arg1_buffer_index]),
+                                    static_cast<int8_t*>(ctx->buffer_data[arg2_buffer_index]),
+                                    static_cast<double*>(ctx->buffer_data[out_buffer_index]),
                                     arg0_shape,
                                     arg1_shape,
                                     daxes);
@@ -112,13 +188,20 @@ namespace ngraph
                     {
                         if (out[0].get_element_type() == element::f32)
                         {
-                            functor = [&, arg0_shape, arg1_shape, daxes](
-                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                            functor = [&,
+                                       arg0_shape,
+                                       arg1_shape,
+                                       daxes,
+                                       arg0_buffer_index,
+                                       arg1_buffer_index,
+                                       arg2_buffer_index,
+                                       out_buffer_index](CPURuntimeContext* ctx,
+                                                         CPUExecutionContext* ectx) {
                                 ngraph::runtime::reference::dequantize<uint8_t>(
-                                    static_cast<uint8_t*>(arg0_tensor),
-                                    static_cast<float*>(arg1_tensor),
-                                    static_cast<uint8_t*>(arg2_tensor),
-                                    static_cast<float*>(out_tensor),
+                                    static_cast<uint8_t*>(ctx->buffer_data[arg0_buffer_index]),
+                                    static_cast<float*>(ctx->buffer_data[arg1_buffer_index]),
+                                    static_cast<uint8_t*>(ctx->buffer_data[arg2_buffer_index]),
+                                    static_cast<float*>(ctx->buffer_data[out_buffer_index]),
                                     arg0_shape,
                                     arg1_shape,
                                     daxes);
@@ -126,13 +209,20 @@ namespace ngraph
                         }
                         else if (out[0].get_element_type() == element::f64)
                         {
-                            functor = [&, arg0_shape, arg1_shape, daxes](
-                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                            functor = [&,
+                                       arg0_shape,
+                                       arg1_shape,
+                                       daxes,
+                                       arg0_buffer_index,
+                                       arg1_buffer_index,
+                                       arg2_buffer_index,
+                                       out_buffer_index](CPURuntimeContext* ctx,
+                                                         CPUExecutionContext* ectx) {
                                 ngraph::runtime::reference::dequantize<uint8_t>(
-                                    static_cast<uint8_t*>(arg0_tensor),
-                                    static_cast<double*>(arg1_tensor),
-                                    static_cast<uint8_t*>(arg2_tensor),
-                                    static_cast<double*>(out_tensor),
+                                    static_cast<uint8_t*>(ctx->buffer_data[arg0_buffer_index]),
+                                    static_cast<double*>(ctx->buffer_data[arg1_buffer_index]),
+                                    static_cast<uint8_t*>(ctx->buffer_data[arg2_buffer_index]),
+                                    static_cast<double*>(ctx->buffer_data[out_buffer_index]),
                                     arg0_shape,
                                     arg1_shape,
                                     daxes);
@@ -147,13 +237,20 @@ namespace ngraph
                     {
                         if (out[0].get_element_type() == element::f32)
                         {
-                            functor = [&, arg0_shape, arg1_shape, daxes](
-                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                            functor = [&,
+                                       arg0_shape,
+                                       arg1_shape,
+                                       daxes,
+                                       arg0_buffer_index,
+                                       arg1_buffer_index,
+                                       arg2_buffer_index,
+                                       out_buffer_index](CPURuntimeContext* ctx,
+                                                         CPUExecutionContext* ectx) {
                                 ngraph::runtime::reference::dequantize<int32_t>(
-                                    static_cast<int32_t*>(arg0_tensor),
-                                    static_cast<float*>(arg1_tensor),
-                                    static_cast<int32_t*>(arg2_tensor),
-                                    static_cast<float*>(out_tensor),
+                                    static_cast<int32_t*>(ctx->buffer_data[arg0_buffer_index]),
+                                    static_cast<float*>(ctx->buffer_data[arg1_buffer_index]),
+                                    static_cast<int32_t*>(ctx->buffer_data[arg2_buffer_index]),
+                                    static_cast<float*>(ctx->buffer_data[out_buffer_index]),
                                     arg0_shape,
                                     arg1_shape,
                                     daxes);
@@ -161,13 +258,20 @@ namespace ngraph
                         }
                         else if (out[0].get_element_type() == element::f64)
                         {
-                            functor = [&, arg0_shape, arg1_shape, daxes](
-                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                            functor = [&,
+                                       arg0_shape,
+                                       arg1_shape,
+                                       daxes,
+                                       arg0_buffer_index,
+                                       arg1_buffer_index,
+                                       arg2_buffer_index,
+                                       out_buffer_index](CPURuntimeContext* ctx,
+                                                         CPUExecutionContext* ectx) {
                                 ngraph::runtime::reference::dequantize<int32_t>(
-                                    static_cast<int32_t*>(arg0_tensor),
-                                    static_cast<double*>(arg1_tensor),
-                                    static_cast<int32_t*>(arg2_tensor),
-                                    static_cast<double*>(out_tensor),
+                                    static_cast<int32_t*>(ctx->buffer_data[arg0_buffer_index]),
+                                    static_cast<double*>(ctx->buffer_data[arg1_buffer_index]),
+                                    static_cast<int32_t*>(ctx->buffer_data[arg2_buffer_index]),
+                                    static_cast<double*>(ctx->buffer_data[out_buffer_index]),
                                     arg0_shape,
                                     arg1_shape,
                                     daxes);
@@ -193,8 +297,9 @@ namespace ngraph
                 {
                     auto quantize = static_cast<const ngraph::op::Quantize*>(node);
                     auto& functors = external_function->get_functors();
-                    auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());
-                    auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                    auto arg0_buffer_index =
+                        external_function->get_buffer_index(args[0].get_name());
+                    auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
                     auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
                     auto input_desc = mkldnn_utils::get_input_mkldnn_md(node, 0);
                     auto result_desc = mkldnn_utils::get_output_mkldnn_md(node, 0);
@@ -204,7 +309,8 @@ namespace ngraph
                     std::vector<float> scales;
                     if (scale_const_op == nullptr)
                     {
-                        auto& arg1_tensor = external_function->get_tensor_data(args[1].get_name());
+                        auto arg1_buffer_index =
+                            external_function->get_buffer_index(args[1].get_name());
                         auto scales_size = shape_size(args[1].get_shape());
 
                         // Dummy value while we wait for the actual values that are provided during
@@ -213,16 +319,24 @@ namespace ngraph
                         size_t quantize_index =
                             mkldnn_emitter->build_quantize_reorder(input_desc, result_desc, scales);
                         auto& deps = mkldnn_emitter->get_primitive_deps(quantize_index);
-                        auto functor = [&, input_desc, result_desc, scales_size, quantize_index](
-                            CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        auto functor = [&,
+                                        input_desc,
+                                        result_desc,
+                                        scales_size,
+                                        quantize_index,
+                                        arg1_buffer_index,
+                                        arg0_buffer_index,
+                                        out_buffer_index](CPURuntimeContext* ctx,
+                                                          CPUExecutionContext* ectx) {
                             // Create MKLDNN reorder primitive during the first iteration.
                             // Assumes the scales dont change for the duration of the graph
                             if (ctx->first_iteration)
                             {
                                 mkldnn::primitive_attr attr;
                                 vector<float> dyn_scales;
-                                dyn_scales.assign(static_cast<float*>(arg1_tensor),
-                                                  static_cast<float*>(arg1_tensor) + scales_size);
+                                auto scales =
+                                    static_cast<float*>(ctx->buffer_data[arg1_buffer_index]);
+                                dyn_scales.assign(scales, scales + scales_size);
                                 attr.set_output_scales(0, dyn_scales);
                                 attr.set_int_output_round_mode(mkldnn::round_mode::round_nearest);
                                 auto reorder_desc = mkldnn::reorder::primitive_desc(
@@ -234,8 +348,10 @@ namespace ngraph
                                                     *ctx->mkldnn_primitives[deps[0]],
                                                     *ctx->mkldnn_primitives[deps[1]]);
                             }
-                            cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], arg0_tensor);
-                            cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], out_tensor);
+                            cpu::mkldnn_utils::set_memory_ptr(
+                                ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
+                            cpu::mkldnn_utils::set_memory_ptr(
+                                ctx, deps[1], ctx->buffer_data[out_buffer_index]);
                             cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, quantize_index);
                         };
                         functors.emplace_back(functor);
@@ -247,10 +363,12 @@ namespace ngraph
                         size_t quantize_index =
                             mkldnn_emitter->build_quantize_reorder(input_desc, result_desc, scales);
                         auto& deps = mkldnn_emitter->get_primitive_deps(quantize_index);
-                        auto functor = [&, quantize_index](CPURuntimeContext* ctx,
-                                                           CPUExecutionContext* ectx) {
-                            cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], arg0_tensor);
-                            cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], out_tensor);
+                        auto functor = [&, quantize_index, arg0_buffer_index, out_buffer_index](
+                            CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                            cpu::mkldnn_utils::set_memory_ptr(
+                                ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
+                            cpu::mkldnn_utils::set_memory_ptr(
+                                ctx, deps[1], ctx->buffer_data[out_buffer_index]);
                             cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, quantize_index);
                         };
                         functors.emplace_back(functor);
@@ -259,33 +377,109 @@ namespace ngraph
                 else
                 {
                     auto& functors = external_function->get_functors();
-                    auto& tensor_data = external_function->get_tensor_data();
 
                     const ngraph::op::Quantize* quantize =
                         static_cast<const ngraph::op::Quantize*>(node);
                     CPUKernelFunctor functor;
 
-                    auto& arg0_tensor = tensor_data[args[0].get_name()];
-                    auto& arg1_tensor = tensor_data[args[1].get_name()];
-                    auto& arg2_tensor = tensor_data[args[2].get_name()];
-                    auto& out_tensor = tensor_data[out[0].get_name()];
+                    auto arg0_buffer_index =
+                        external_function->get_buffer_index(args[0].get_name());
+                    auto arg1_buffer_index =
+                        external_function->get_buffer_index(args[1].get_name());
+                    auto arg2_buffer_index =
+                        external_function->get_buffer_index(args[2].get_name());
+                    auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                     auto arg0_shape = args[0].get_shape();
                     auto arg1_shape = args[1].get_shape();
                     auto daxes = quantize->get_axes();
                     op::Quantize::RoundMode round_mode = quantize->get_round_mode();
 
-                    if (args[0].get_element_type() == element::f32)
+                    size_t outer, channels, inner;
+                    if (kernel::get_quantization_layout(arg0_shape, daxes, outer, channels, inner))
+                    {
+                        std::function<void(void*,
+                                           void*,
+                                           void*,
+                                           void*,
+                                           size_t,
+                                           size_t,
+                                           size_t,
+                                           op::Quantize::RoundMode,
+                                           int)>
+                            kernel;
+                        auto in_type = args[0].get_element_type();
+                        auto out_type = out[0].get_element_type();
+                        if (in_type == element::f32 && out_type == element::i8)
+                        {
+                            kernel = runtime::cpu::kernel::quantize<float, int8_t>;
+                        }
+                        else if (in_type == element::f32 && out_type == element::u8)
+                        {
+                            kernel = runtime::cpu::kernel::quantize<float, uint8_t>;
+                        }
+                        else if (in_type == element::f32 && out_type == element::i32)
+                        {
+                            kernel = runtime::cpu::kernel::quantize<float, int32_t>;
+                        }
+                        else if (in_type == element::f64 && out_type == element::i8)
+                        {
+                            kernel = runtime::cpu::kernel::quantize<double, int8_t>;
+                        }
+                        else if (in_type == element::f64 && out_type == element::u8)
+                        {
+                            kernel = runtime::cpu::kernel::quantize<double, uint8_t>;
+                        }
+                        else if (in_type == element::f64 && out_type == element::i32)
+                        {
+                            kernel = runtime::cpu::kernel::quantize<double, int32_t>;
+                        }
+                        else
+                        {
+                            throw ngraph_error("Unsupported quantization element type");
+                        }
+
+                        functor = [&,
+                                   kernel,
+                                   outer,
+                                   channels,
+                                   inner,
+                                   round_mode,
+                                   arg0_buffer_index,
+                                   arg1_buffer_index,
+                                   arg2_buffer_index,
+                                   out_buffer_index](CPURuntimeContext* ctx,
+                                                     CPUExecutionContext* ectx) {
+                            kernel(ctx->buffer_data[arg0_buffer_index],
+                                   ctx->buffer_data[arg1_buffer_index],
+                                   ctx->buffer_data[arg2_buffer_index],
+                                   ctx->buffer_data[out_buffer_index],
+                                   outer,
+                                   channels,
+                                   inner,
+                                   round_mode,
+                                   ectx->arena);
+                        };
+                    }
+                    else if (args[0].get_element_type() == element::f32)
                     {
                         if (out[0].get_element_type() == element::i8)
                         {
-                            functor = [&, arg0_shape, arg1_shape, daxes, round_mode](
-                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                            functor = [&,
+                                       arg0_shape,
+                                       arg1_shape,
+                                       daxes,
+                                       round_mode,
+                                       arg0_buffer_index,
+                                       arg1_buffer_index,
+                                       arg2_buffer_index,
+                                       out_buffer_index](CPURuntimeContext* ctx,
+                                                         CPUExecutionContext* ectx) {
                                 ngraph::runtime::reference::quantize<float>(
-                                    static_cast<float*>(arg0_tensor),
-                                    static_cast<float*>(arg1_tensor),
-                                    static_cast<int8_t*>(arg2_tensor),
-                                    static_cast<int8_t*>(out_tensor),
+                                    static_cast<float*>(ctx->buffer_data[arg0_buffer_index]),
+                                    static_cast<float*>(ctx->buffer_data[arg1_buffer_index]),
+                                    static_cast<int8_t*>(ctx->buffer_data[arg2_buffer_index]),
+                                    static_cast<int8_t*>(ctx->buffer_data[out_buffer_index]),
                                     arg0_shape,
                                     arg1_shape,
                                     daxes,
@@ -294,13 +488,21 @@ namespace ngraph
                         }
                         else if (out[0].get_element_type() == element::u8)
                         {
-                            functor = [&, arg0_shape, arg1_shape, daxes, round_mode](
-                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                            functor = [&,
+                                       arg0_shape,
+                                       arg1_shape,
+                                       daxes,
+                                       round_mode,
+                                       arg0_buffer_index,
+                                       arg1_buffer_index,
+                                       arg2_buffer_index,
+                                       out_buffer_index](CPURuntimeContext* ctx,
+                                                         CPUExecutionContext* ectx) {
                                 ngraph::runtime::reference::quantize<float>(
-                                    static_cast<float*>(arg0_tensor),
-                                    static_cast<float*>(arg1_tensor),
-                                    static_cast<uint8_t*>(arg2_tensor),
-                                    static_cast<uint8_t*>(out_tensor),
+                                    static_cast<float*>(ctx->buffer_data[arg0_buffer_index]),
+                                    static_cast<float*>(ctx->buffer_data[arg1_buffer_index]),
+                                    static_cast<uint8_t*>(ctx->buffer_data[arg2_buffer_index]),
+                                    static_cast<uint8_t*>(ctx->buffer_data[out_buffer_index]),
                                     arg0_shape,
                                     arg1_shape,
                                     daxes,
@@ -309,13 +511,21 @@ namespace ngraph
                         }
                         else if (out[0].get_element_type() == element::i32)
                         {
-                            functor = [&, arg0_shape, arg1_shape, daxes, round_mode](
-                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                            functor = [&,
+                                       arg0_shape,
+                                       arg1_shape,
+                                       daxes,
+                                       round_mode,
+                                       arg0_buffer_index,
+                                       arg1_buffer_index,
+                                       arg2_buffer_index,
+                                       out_buffer_index](CPURuntimeContext* ctx,
+                                                         CPUExecutionContext* ectx) {
                                 ngraph::runtime::reference::quantize<float>(
-                                    static_cast<float*>(arg0_tensor),
-                                    static_cast<float*>(arg1_tensor),
-                                    static_cast<int32_t*>(arg2_tensor),
-                                    static_cast<int32_t*>(out_tensor),
+                                    static_cast<float*>(ctx->buffer_data[arg0_buffer_index]),
+                                    static_cast<float*>(ctx->buffer_data[arg1_buffer_index]),
+                                    static_cast<int32_t*>(ctx->buffer_data[arg2_buffer_index]),
+                                    static_cast<int32_t*>(ctx->buffer_data[out_buffer_index]),
                                     arg0_shape,
                                     arg1_shape,
                                     daxes,
@@ -331,13 +541,21 @@ namespace ngraph
                     {
                         if (out[0].get_element_type() == element::i8)
                         {
-                            functor = [&, arg0_shape, arg1_shape, daxes, round_mode](
-                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                            functor = [&,
+                                       arg0_shape,
+                                       arg1_shape,
+                                       daxes,
+                                       round_mode,
+                                       arg0_buffer_index,
+                                       arg1_buffer_index,
+                                       arg2_buffer_index,
+                                       out_buffer_index](CPURuntimeContext* ctx,
+                                                         CPUExecutionContext* ectx) {
                                 ngraph::runtime::reference::quantize<double>(
-                                    static_cast<double*>(arg0_tensor),
-                                    static_cast<double*>(arg1_tensor),
-                                    static_cast<int8_t*>(arg2_tensor),
-                                    static_cast<int8_t*>(out_tensor),
+                                    static_cast<double*>(ctx->buffer_data[arg0_buffer_index]),
+                                    static_cast<double*>(ctx->buffer_data[arg1_buffer_index]),
+                                    static_cast<int8_t*>(ctx->buffer_data[arg2_buffer_index]),
+                                    static_cast<int8_t*>(ctx->buffer_data[out_buffer_index]),
                                     arg0_shape,
                                     arg1_shape,
                                     daxes,
@@ -346,13 +564,21 @@ namespace ngraph
                         }
                         else if (out[0].get_element_type() == element::u8)
                         {
-                            functor = [&, arg0_shape, arg1_shape, daxes, round_mode](
-                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                            functor = [&,
+                                       arg0_shape,
+                                       arg1_shape,
+                                       daxes,
+                                       round_mode,
+                                       arg0_buffer_index,
+                                       arg1_buffer_index,
+                                       arg2_buffer_index,
+                                       out_buffer_index](CPURuntimeContext* ctx,
+                                                         CPUExecutionContext* ectx) {
                                 ngraph::runtime::reference::quantize<double>(
-                                    static_cast<double*>(arg0_tensor),
-                                    static_cast<double*>(arg1_tensor),
-                                    static_cast<uint8_t*>(arg2_tensor),
-                                    static_cast<uint8_t*>(out_tensor),
+                                    static_cast<double*>(ctx->buffer_data[arg0_buffer_index]),
+                                    static_cast<double*>(ctx->buffer_data[arg1_buffer_index]),
+                                    static_cast<uint8_t*>(ctx->buffer_data[arg2_buffer_index]),
+                                    static_cast<uint8_t*>(ctx->buffer_data[out_buffer_index]),
                                     arg0_shape,
                                     arg1_shape,
                                     daxes,
@@ -361,13 +587,21 @@ namespace ngraph
                         }
                         else if (out[0].get_element_type() == element::i32)
                         {
-                            functor = [&, arg0_shape, arg1_shape, daxes, round_mode](
-                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                            functor = [&,
+                                       arg0_shape,
+                                       arg1_shape,
+                                       daxes,
+                                       round_mode,
+                                       arg0_buffer_index,
+                                       arg1_buffer_index,
+                                       arg2_buffer_index,
+                                       out_buffer_index](CPURuntimeContext* ctx,
+                                                         CPUExecutionContext* ectx) {
                                 ngraph::runtime::reference::quantize<double>(
-                                    static_cast<double*>(arg0_tensor),
-                                    static_cast<double*>(arg1_tensor),
-                                    static_cast<int32_t*>(arg2_tensor),
-                                    static_cast<int32_t*>(out_tensor),
+                                    static_cast<double*>(ctx->buffer_data[arg0_buffer_index]),
+                                    static_cast<double*>(ctx->buffer_data[arg1_buffer_index]),
+                                    static_cast<int32_t*>(ctx->buffer_data[arg2_buffer_index]),
+                                    static_cast<int32_t*>(ctx->buffer_data[out_buffer_index]),
                                     arg0_shape,
                                     arg1_shape,
                                     daxes,
@@ -0,0 +1,118 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/experimental/quantized_dot.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/quantized_dot.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::QuantizedDot)
+            {
+                auto& functors = external_function->get_functors();
+
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto arg2_buffer_index = external_function->get_buffer_index(args[2].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto& data_shape = args[0].get_shape();
+                auto& weights_shape = args[1].get_shape();
+                size_t m = data_shape[0];
+                size_t k = data_shape[1];
+                size_t n = weights_shape[1];
+
+                std::function<void(void*, void*, void*, void*, size_t, size_t, size_t, int)>
+                    kernel;
+                auto data_type = args[0].get_element_type();
+                auto out_type = out[0].get_element_type();
+                if (data_type == element::u8)
+                {
+                    if (out_type == element::i8)
+                    {
+                        kernel = runtime::cpu::kernel::quantized_dot<uint8_t, int8_t, int8_t>;
+                    }
+                    else if (out_type == element::u8)
+                    {
+                        kernel = runtime::cpu::kernel::quantized_dot<uint8_t, int8_t, uint8_t>;
+                    }
+                    else if (out_type == element::i32)
+                    {
+                        kernel = runtime::cpu::kernel::quantized_dot<uint8_t, int8_t, int32_t>;
+                    }
+                    else if (out_type == element::f32)
+                    {
+                        kernel = runtime::cpu::kernel::quantized_dot<uint8_t, int8_t, float>;
+                    }
+                }
+                else if (data_type == element::i8)
+                {
+                    if (out_type == element::i8)
+                    {
+                        kernel = runtime::cpu::kernel::quantized_dot<int8_t, int8_t, int8_t>;
+                    }
+                    else if (out_type == element::u8)
+                    {
+                        kernel = runtime::cpu::kernel::quantized_dot<int8_t, int8_t, uint8_t>;
+                    }
+                    else if (out_type == element::i32)
+                    {
+                        kernel = runtime::cpu::kernel::quantized_dot<int8_t, int8_t, int32_t>;
+                    }
+                    else if (out_type == element::f32)
+                    {
+                        kernel = runtime::cpu::kernel::quantized_dot<int8_t, int8_t, float>;
+                    }
+                }
+                if (!kernel)
+                {
+                    throw ngraph_error("Unsupported element types for QuantizedDot");
+                }
+
+                auto functor = [&,
+                                kernel,
+                                m,
+                                k,
+                                n,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                arg2_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[arg0_buffer_index],
+                           ctx->buffer_data[arg1_buffer_index],
+                           ctx->buffer_data[arg2_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           m,
+                           k,
+                           n,
+                           ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            REGISTER_OP_BUILDER(QuantizedDot);
+        }
+    }
+}
@@ -16,11 +16,18 @@
 
 #include "ngraph/runtime/cpu/kernel/reduce_function.hpp"
 #include "ngraph/op/reduce.hpp"
+#include "ngraph/op/util/reducer.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
+#include "ngraph/runtime/cpu/kernel/reduce_max.hpp"
+#include "ngraph/runtime/cpu/kernel/reduce_min.hpp"
+#include "ngraph/runtime/cpu/kernel/reduce_product.hpp"
+#include "ngraph/runtime/cpu/kernel/reduce_sum.hpp"
 #include "ngraph/runtime/tensor.hpp"
 
+#include "reduction.hpp"
+
 using namespace std;
 using namespace ngraph;
 
@@ -30,12 +37,90 @@ namespace ngraph
     {
         namespace cpu
         {
+            // Lowers a Reduce whose function is a standard monoid to the vectorised
+            // reduction kernels, folding in the initial value afterwards
+            static void build_recognised_reduce(CPU_ExternalFunction* external_function,
+                                                const ngraph::Node* node,
+                                                const vector<TensorViewWrapper>& args,
+                                                const vector<TensorViewWrapper>& out,
+                                                ngraph::op::util::ReducerKind reducer_kind)
+            {
+                using ngraph::op::util::ReducerKind;
+
+                auto build_reduction = [&]() {
+                    switch (reducer_kind)
+                    {
+                    case ReducerKind::Add:
+                    {
+                        BUILD_REDUCTION_FUNCTOR(Reduce, sum);
+                        break;
+                    }
+                    case ReducerKind::Multiply:
+                    {
+                        BUILD_REDUCTION_FUNCTOR(Reduce, product);
+                        break;
+                    }
+                    case ReducerKind::Maximum:
+                    case ReducerKind::Or:
+                    {
+                        BUILD_REDUCTION_FUNCTOR(Reduce, max);
+                        break;
+                    }
+                    case ReducerKind::Minimum:
+                    case ReducerKind::And:
+                    {
+                        BUILD_REDUCTION_FUNCTOR(Reduce, min);
+                        break;
+                    }
+                    case ReducerKind::Unknown: throw ngraph_error("Unrecognised Reduce function");
+                    }
+                };
+                build_reduction();
+                auto& functors = external_function->get_functors();
+                auto reduction = functors.back();
+                functors.pop_back();
+
+                std::function<decltype(runtime::cpu::kernel::reduce_function_initial<float>)>
+                    initial_kernel;
+                SELECT_KERNEL(initial_kernel,
+                              args[0].get_element_type(),
+                              runtime::cpu::kernel::reduce_function_initial);
+
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto count = out[0].get_size();
+
+                auto functor = [&,
+                                reduction,
+                                initial_kernel,
+                                reducer_kind,
+                                count,
+                                arg1_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                    reduction(ctx, ectx);
+                    initial_kernel(ctx->buffer_data[arg1_buffer_index],
+                                   ctx->buffer_data[out_buffer_index],
+                                   count,
+                                   reducer_kind,
+                                   ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Reduce)
             {
                 auto reduce = static_cast<const ngraph::op::Reduce*>(node);
                 auto function = reduce->get_functions()[0];
 
+                auto reducer_kind = ngraph::op::util::get_reducer_kind(function);
+                if (reducer_kind != ngraph::op::util::ReducerKind::Unknown)
+                {
+                    build_recognised_reduce(external_function, node, args, out, reducer_kind);
+                    return;
+                }
+
                 auto& functors = external_function->get_functors();
                 auto& callees = external_function->get_callees();
 
@@ -45,9 +130,9 @@ namespace ngraph
                 }
                 auto& reducer_external_function = callees[function->get_name()];
 
-                auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& arg1_tensor = external_function->get_tensor_data(args[1].get_name());
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                 auto arg0_shape = args[0].get_shape();
                 auto out_shape = out[0].get_shape();
@@ -57,8 +142,11 @@ namespace ngraph
                 if (reduction_axes.empty())
                 {
                     size_t size = args[0].get_size() * args[0].get_element_type().size();
-                    auto functor = [&, size](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                        memcpy(out_tensor, arg0_tensor, size);
+                    auto functor = [&, size, out_buffer_index, arg0_buffer_index](
+                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        memcpy(ctx->buffer_data[out_buffer_index],
+                               ctx->buffer_data[arg0_buffer_index],
+                               size);
                     };
                     functors.emplace_back(functor);
                 }
@@ -72,11 +160,18 @@ namespace ngraph
                                           arg0_shape.size(),
                                           runtime::cpu::kernel::reduce_function_1rd);
 
-                    auto functor = [&, kernel, arg0_shape, out_shape, reduction_axes](
-                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                        kernel(arg0_tensor,
-                               arg1_tensor,
-                               out_tensor,
+                    auto functor = [&,
+                                    kernel,
+                                    arg0_shape,
+                                    out_shape,
+                                    reduction_axes,
+                                    arg0_buffer_index,
+                                    arg1_buffer_index,
+                                    out_buffer_index](CPURuntimeContext* ctx,
+                                                      CPUExecutionContext* ectx) {
+                        kernel(ctx->buffer_data[arg0_buffer_index],
+                               ctx->buffer_data[arg1_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
                                arg0_shape,
                                out_shape,
                                reduction_axes,
@@ -94,11 +189,18 @@ namespace ngraph
                                   args[0].get_element_type(),
                                   runtime::cpu::kernel::reduce_function_2d_2rd);
 
-                    auto functor = [&, kernel, arg0_shape, out_shape, reduction_axes](
-                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                        kernel(arg0_tensor,
-                               arg1_tensor,
-                               out_tensor,
+                    auto functor = [&,
+                                    kernel,
+                                    arg0_shape,
+                                    out_shape,
+                                    reduction_axes,
+                                    arg0_buffer_index,
+                                    arg1_buffer_index,
+                                    out_buffer_index](CPURuntimeContext* ctx,
+                                                      CPUExecutionContext* ectx) {
+                        kernel(ctx->buffer_data[arg0_buffer_index],
+                               ctx->buffer_data[arg1_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
                                arg0_shape,
                                out_shape,
                                reduction_axes,
@@ -116,11 +218,18 @@ namespace ngraph
                                   args[0].get_element_type(),
                                   runtime::cpu::kernel::reduce_function_3d_2rd);
 
-                    auto functor = [&, kernel, arg0_shape, out_shape, reduction_axes](
-                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                        kernel(arg0_tensor,
-                               arg1_tensor,
-                               out_tensor,
+                    auto functor = [&,
+                                    kernel,
+                                    arg0_shape,
+                                    out_shape,
+                                    reduction_axes,
+                                    arg0_buffer_index,
+                                    arg1_buffer_index,
+                                    out_buffer_index](CPURuntimeContext* ctx,
+                                                      CPUExecutionContext* ectx) {
+                        kernel(ctx->buffer_data[arg0_buffer_index],
+                               ctx->buffer_data[arg1_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
                                arg0_shape,
                                out_shape,
                                reduction_axes,
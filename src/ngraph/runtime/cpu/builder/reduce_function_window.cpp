@@ -16,6 +16,7 @@
 
 #include "ngraph/runtime/cpu/kernel/reduce_function_window.hpp"
 #include "ngraph/op/reduce_window.hpp"
+#include "ngraph/op/util/reducer.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/tensor.hpp"
@@ -36,6 +37,52 @@ namespace ngraph
                 auto function = reduce_window->get_functions()[0];
 
                 auto& functors = external_function->get_functors();
+
+                auto reducer_kind = ngraph::op::util::get_reducer_kind(function);
+                if (reducer_kind != ngraph::op::util::ReducerKind::Unknown)
+                {
+                    auto arg0_buffer_index =
+                        external_function->get_buffer_index(args[0].get_name());
+                    auto arg1_buffer_index =
+                        external_function->get_buffer_index(args[1].get_name());
+                    auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                    auto arg0_shape = args[0].get_shape();
+                    auto out_shape = out[0].get_shape();
+                    auto window_shape = reduce_window->get_window_shape();
+                    auto window_movement_strides = reduce_window->get_window_movement_strides();
+
+                    std::function<decltype(
+                        runtime::cpu::kernel::reduce_function_window_native<float>)>
+                        kernel;
+
+                    SELECT_KERNEL(kernel,
+                                  args[0].get_element_type(),
+                                  runtime::cpu::kernel::reduce_function_window_native);
+
+                    auto functor = [&,
+                                    kernel,
+                                    arg0_shape,
+                                    out_shape,
+                                    window_shape,
+                                    window_movement_strides,
+                                    reducer_kind,
+                                    arg0_buffer_index,
+                                    arg1_buffer_index,
+                                    out_buffer_index](CPURuntimeContext* ctx,
+                                                      CPUExecutionContext* ectx) {
+                        kernel(ctx->buffer_data[arg0_buffer_index],
+                               ctx->buffer_data[arg1_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
+                               arg0_shape,
+                               out_shape,
+                               window_shape,
+                               window_movement_strides,
+                               reducer_kind);
+                    };
+                    functors.emplace_back(functor);
+                    return;
+                }
                 auto& callees = external_function->get_callees();
 
                 if (!callees.count(function->get_name()))
@@ -44,9 +91,9 @@ namespace ngraph
                 }
                 auto& reducer_external_function = callees[function->get_name()];
 
-                auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& arg1_tensor = external_function->get_tensor_data(args[1].get_name());
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                 auto arg0_shape = args[0].get_shape();
                 auto out_shape = out[0].get_shape();
@@ -60,18 +107,25 @@ namespace ngraph
                               args[0].get_element_type(),
                               runtime::cpu::kernel::reduce_function_window);
 
-                auto functor =
-                    [&, kernel, arg0_shape, out_shape, window_shape, window_movement_strides](
-                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                        kernel(arg0_tensor,
-                               arg1_tensor,
-                               out_tensor,
-                               arg0_shape,
-                               out_shape,
-                               window_shape,
-                               window_movement_strides,
-                               reducer_external_function);
-                    };
+                auto functor = [&,
+                                kernel,
+                                arg0_shape,
+                                out_shape,
+                                window_shape,
+                                window_movement_strides,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[arg0_buffer_index],
+                           ctx->buffer_data[arg1_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           arg0_shape,
+                           out_shape,
+                           window_shape,
+                           window_movement_strides,
+                           reducer_external_function);
+                };
                 functors.emplace_back(functor);
             }
 
@@ -36,8 +36,8 @@ namespace ngraph
             {
                 auto& functors = external_function->get_functors();
 
-                auto& arg_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                 auto reshape = static_cast<const ngraph::op::Reshape*>(node);
 
@@ -57,10 +57,14 @@ namespace ngraph
                 if (can_skip_reshape())
                 {
                     size_t size = out[0].get_size() * out[0].get_element_type().size();
-                    auto functor = [&, size](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                        if (out_tensor != arg_tensor)
+                    auto functor = [&, size, out_buffer_index, arg_buffer_index](
+                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        if (ctx->buffer_data[out_buffer_index] !=
+                            ctx->buffer_data[arg_buffer_index])
                         {
-                            memcpy(out_tensor, arg_tensor, size);
+                            memcpy(ctx->buffer_data[out_buffer_index],
+                                   ctx->buffer_data[arg_buffer_index],
+                                   size);
                         }
                     };
                     functors.emplace_back(functor);
@@ -83,8 +87,11 @@ namespace ngraph
                 if (same_layout || result_size < 2)
                 {
                     size_t size = out[0].get_size() * out[0].get_element_type().size();
-                    auto functor = [&, size](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                        memcpy(out_tensor, arg_tensor, size);
+                    auto functor = [&, size, out_buffer_index, arg_buffer_index](
+                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        memcpy(ctx->buffer_data[out_buffer_index],
+                               ctx->buffer_data[arg_buffer_index],
+                               size);
                     };
                     functors.emplace_back(functor);
                     return;
@@ -117,10 +124,16 @@ namespace ngraph
 
                     SELECT_KERNEL(ref_kernel, result_element_type, runtime::cpu::kernel::reshape);
 
-                    auto functor = [&, ref_kernel, arg_shape, input_order, result_shape](
-                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                        ref_kernel(arg_tensor,
-                                   out_tensor,
+                    auto functor = [&,
+                                    ref_kernel,
+                                    arg_shape,
+                                    input_order,
+                                    result_shape,
+                                    arg_buffer_index,
+                                    out_buffer_index](CPURuntimeContext* ctx,
+                                                      CPUExecutionContext* ectx) {
+                        ref_kernel(ctx->buffer_data[arg_buffer_index],
+                                   ctx->buffer_data[out_buffer_index],
                                    arg_shape,
                                    input_order,
                                    result_shape,
@@ -130,10 +143,20 @@ namespace ngraph
                     return;
                 }
 
-                auto functor = [&, kernel, arg_shape, input_order, result_shape](
-                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                    kernel(
-                        arg_tensor, out_tensor, arg_shape, input_order, result_shape, ectx->arena);
+                auto functor = [&,
+                                kernel,
+                                arg_shape,
+                                input_order,
+                                result_shape,
+                                arg_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[arg_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           arg_shape,
+                           input_order,
+                           result_shape,
+                           ectx->arena);
                 };
                 functors.emplace_back(functor);
             }
@@ -0,0 +1,89 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/scatter_add.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/scatter_add.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::ScatterAdd)
+            {
+                auto& functors = external_function->get_functors();
+
+                auto inputs_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto indices_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto updates_buffer_index = external_function->get_buffer_index(args[2].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                size_t indices_count = args[1].get_size();
+                auto inputs_shape = args[0].get_shape();
+                size_t num_rows = inputs_shape.at(0);
+                size_t row_len = shape_size(Shape(inputs_shape.begin() + 1, inputs_shape.end()));
+
+                std::function<decltype(runtime::cpu::kernel::scatter_add_i32<float>)> kernel;
+
+                if (args[1].get_element_type() == element::i32)
+                {
+                    SELECT_KERNEL(kernel,
+                                  args[0].get_element_type(),
+                                  runtime::cpu::kernel::scatter_add_i32);
+                }
+                else if (args[1].get_element_type() == element::i64)
+                {
+                    SELECT_KERNEL(kernel,
+                                  args[0].get_element_type(),
+                                  runtime::cpu::kernel::scatter_add_i64);
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported index element type in ScatterAdd");
+                }
+
+                auto functor = [&,
+                                kernel,
+                                indices_count,
+                                num_rows,
+                                row_len,
+                                inputs_buffer_index,
+                                indices_buffer_index,
+                                updates_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[inputs_buffer_index],
+                           ctx->buffer_data[indices_buffer_index],
+                           ctx->buffer_data[updates_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           indices_count,
+                           num_rows,
+                           row_len,
+                           ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            REGISTER_OP_BUILDER(ScatterAdd);
+        }
+    }
+}
@@ -52,13 +52,13 @@ namespace ngraph
                 }
 
                 auto arg0_shape = args[0].get_shape();
-                auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
                 auto arg1_shape = args[1].get_shape();
-                auto& arg1_tensor = external_function->get_tensor_data(args[1].get_name());
-                auto& arg2_tensor = external_function->get_tensor_data(args[2].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto arg2_buffer_index = external_function->get_buffer_index(args[2].get_name());
 
                 auto out_shape = out[0].get_shape();
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                 auto window_shape = select_and_scatter->get_window_shape();
                 auto window_movement_strides = select_and_scatter->get_window_movement_strides();
@@ -106,19 +106,24 @@ namespace ngraph
                                 arg1_shape,
                                 out_shape,
                                 window_shape,
-                                window_movement_strides](CPURuntimeContext* ctx,
-                                                         CPUExecutionContext* ectx) {
-                    reference::select_and_scatter<float>(static_cast<float*>(arg0_tensor),
-                                                         static_cast<float*>(arg1_tensor),
-                                                         static_cast<float*>(arg2_tensor),
-                                                         static_cast<float*>(out_tensor),
-                                                         arg0_shape,
-                                                         arg1_shape,
-                                                         out_shape,
-                                                         select,
-                                                         scatter,
-                                                         window_shape,
-                                                         window_movement_strides);
+                                window_movement_strides,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                arg2_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                    reference::select_and_scatter<float>(
+                        static_cast<float*>(ctx->buffer_data[arg0_buffer_index]),
+                        static_cast<float*>(ctx->buffer_data[arg1_buffer_index]),
+                        static_cast<float*>(ctx->buffer_data[arg2_buffer_index]),
+                        static_cast<float*>(ctx->buffer_data[out_buffer_index]),
+                        arg0_shape,
+                        arg1_shape,
+                        out_shape,
+                        select,
+                        scatter,
+                        window_shape,
+                        window_movement_strides);
                 };
                 functors.emplace_back(functor);
             }
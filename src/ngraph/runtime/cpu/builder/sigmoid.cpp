@@ -35,8 +35,8 @@ namespace ngraph
             {
                 auto& functors = external_function->get_functors();
 
-                auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                 auto input_shape = args[0].get_shape();
                 auto out_shape = out[0].get_shape();
@@ -49,10 +49,12 @@ namespace ngraph
 
                 auto& deps = mkldnn_emitter->get_primitive_deps(sigmoid_index);
 
-                auto functor = [&, sigmoid_index](CPURuntimeContext* ctx,
-                                                  CPUExecutionContext* ectx) {
-                    cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], arg0_tensor);
-                    cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], out_tensor);
+                auto functor = [&, sigmoid_index, arg0_buffer_index, out_buffer_index](
+                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    cpu::mkldnn_utils::set_memory_ptr(
+                        ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
+                    cpu::mkldnn_utils::set_memory_ptr(
+                        ctx, deps[1], ctx->buffer_data[out_buffer_index]);
                     cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, sigmoid_index);
                 };
                 functors.emplace_back(functor);
@@ -63,9 +65,9 @@ namespace ngraph
             {
                 auto& functors = external_function->get_functors();
 
-                auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& arg1_tensor = external_function->get_tensor_data(args[1].get_name());
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                 auto input_shape = args[0].get_shape();
                 auto delta_shape = args[1].get_shape();
@@ -81,11 +83,18 @@ namespace ngraph
                     mkldnn_emitter->build_sigmoid_backward(input_desc, delta_desc, out_desc);
 
                 auto& deps = mkldnn_emitter->get_primitive_deps(sigmoid_index);
-                auto functor = [&, sigmoid_index](CPURuntimeContext* ctx,
+                auto functor = [&,
+                                sigmoid_index,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
                                                   CPUExecutionContext* ectx) {
-                    cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], arg0_tensor);
-                    cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], arg1_tensor);
-                    cpu::mkldnn_utils::set_memory_ptr(ctx, deps[2], out_tensor);
+                    cpu::mkldnn_utils::set_memory_ptr(
+                        ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
+                    cpu::mkldnn_utils::set_memory_ptr(
+                        ctx, deps[1], ctx->buffer_data[arg1_buffer_index]);
+                    cpu::mkldnn_utils::set_memory_ptr(
+                        ctx, deps[2], ctx->buffer_data[out_buffer_index]);
                     cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, sigmoid_index);
                 };
                 functors.emplace_back(functor);
@@ -96,9 +105,9 @@ namespace ngraph
             {
                 auto& functors = external_function->get_functors();
 
-                auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& arg1_tensor = external_function->get_tensor_data(args[1].get_name());
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
                 auto tensor_size = shape_size(args[0].get_shape());
 
                 auto sigmoid_mul = static_cast<const ngraph::op::SigmoidMultiply*>(node);
@@ -108,10 +117,20 @@ namespace ngraph
                         static_cast<size_t>(ngraph::op::SigmoidMultiply::FunctionType::NumTypes) +
                     static_cast<size_t>(sigmoid_mul->get_input_func_type(1));
 
-                auto functor = [&, index, tensor_size](CPURuntimeContext* ctx,
-                                                       CPUExecutionContext* ectx) {
+                auto functor = [&,
+                                index,
+                                tensor_size,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
                     ngraph::runtime::cpu::kernel::sigmoid_multiply(
-                        arg0_tensor, arg1_tensor, out_tensor, tensor_size, index, ectx->arena);
+                        ctx->buffer_data[arg0_buffer_index],
+                        ctx->buffer_data[arg1_buffer_index],
+                        ctx->buffer_data[out_buffer_index],
+                        tensor_size,
+                        index,
+                        ectx->arena);
                 };
 
                 functors.emplace_back(functor);
@@ -121,11 +140,11 @@ namespace ngraph
             void Builder::BUILDER_DECL(ngraph::op::SigmoidMultiplyBackprop)
             {
                 auto& functors = external_function->get_functors();
-                auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& arg1_tensor = external_function->get_tensor_data(args[1].get_name());
-                auto& arg2_tensor = external_function->get_tensor_data(args[2].get_name());
-                auto& out0_tensor = external_function->get_tensor_data(out[0].get_name());
-                auto& out1_tensor = external_function->get_tensor_data(out[1].get_name());
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto arg2_buffer_index = external_function->get_buffer_index(args[2].get_name());
+                auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto out1_buffer_index = external_function->get_buffer_index(out[1].get_name());
                 auto tensor_size = shape_size(args[0].get_shape());
 
                 auto sigmoid_mul = static_cast<const ngraph::op::SigmoidMultiplyBackprop*>(node);
@@ -135,16 +154,24 @@ namespace ngraph
                         static_cast<size_t>(ngraph::op::SigmoidMultiply::FunctionType::NumTypes) +
                     static_cast<size_t>(sigmoid_mul->get_input_func_type(1));
 
-                auto functor = [&, index, tensor_size](CPURuntimeContext* ctx,
-                                                       CPUExecutionContext* ectx) {
-                    ngraph::runtime::cpu::kernel::sigmoid_multiply_backprop(arg0_tensor,
-                                                                            arg1_tensor,
-                                                                            arg2_tensor,
-                                                                            out0_tensor,
-                                                                            out1_tensor,
-                                                                            tensor_size,
-                                                                            index,
-                                                                            ectx->arena);
+                auto functor = [&,
+                                index,
+                                tensor_size,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                arg2_buffer_index,
+                                out0_buffer_index,
+                                out1_buffer_index](CPURuntimeContext* ctx,
+                                                   CPUExecutionContext* ectx) {
+                    ngraph::runtime::cpu::kernel::sigmoid_multiply_backprop(
+                        ctx->buffer_data[arg0_buffer_index],
+                        ctx->buffer_data[arg1_buffer_index],
+                        ctx->buffer_data[arg2_buffer_index],
+                        ctx->buffer_data[out0_buffer_index],
+                        ctx->buffer_data[out1_buffer_index],
+                        tensor_size,
+                        index,
+                        ectx->arena);
                 };
 
                 functors.emplace_back(functor);
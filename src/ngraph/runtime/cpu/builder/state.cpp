@@ -36,8 +36,8 @@ namespace ngraph
                 auto gm = static_cast<const ngraph::op::GenerateMask*>(node);
                 CPUKernelFunctor functor;
 
-                auto& arg_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                 size_t element_count = out[0].get_size();
 
@@ -46,24 +46,28 @@ namespace ngraph
 
                 if (args[0].get_element_type() == element::f32)
                 {
-                    functor = [&, index, element_count](CPURuntimeContext* ctx,
-                                                        CPUExecutionContext* ectx) {
-                        bool training = static_cast<bool>(static_cast<float*>(arg_tensor)[0]);
-                        reference::generate_mask(static_cast<float*>(out_tensor),
-                                                 element_count,
-                                                 static_cast<RNGState*>(ctx->states[index]),
-                                                 training);
+                    functor = [&, index, element_count, arg_buffer_index, out_buffer_index](
+                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        bool training = static_cast<bool>(
+                            static_cast<float*>(ctx->buffer_data[arg_buffer_index])[0]);
+                        reference::generate_mask(
+                            static_cast<float*>(ctx->buffer_data[out_buffer_index]),
+                            element_count,
+                            static_cast<RNGState*>(ctx->states[index]),
+                            training);
                     };
                 }
                 else if (args[0].get_element_type() == element::f64)
                 {
-                    functor = [&, index, element_count](CPURuntimeContext* ctx,
-                                                        CPUExecutionContext* ectx) {
-                        bool training = static_cast<bool>(static_cast<double*>(arg_tensor)[0]);
-                        reference::generate_mask(static_cast<double*>(out_tensor),
-                                                 element_count,
-                                                 static_cast<RNGState*>(ctx->states[index]),
-                                                 training);
+                    functor = [&, index, element_count, arg_buffer_index, out_buffer_index](
+                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        bool training = static_cast<bool>(
+                            static_cast<double*>(ctx->buffer_data[arg_buffer_index])[0]);
+                        reference::generate_mask(
+                            static_cast<double*>(ctx->buffer_data[out_buffer_index]),
+                            element_count,
+                            static_cast<RNGState*>(ctx->states[index]),
+                            training);
                     };
                 }
                 else
@@ -14,11 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
-#include <cstring>
-
 #include "ngraph/op/topk.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
-#include "ngraph/runtime/reference/topk.hpp"
+#include "ngraph/runtime/cpu/kernel/topk.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -34,95 +32,53 @@ namespace ngraph
             {
                 auto& functors = external_function->get_functors();
                 const ngraph::op::TopK* topk = static_cast<const ngraph::op::TopK*>(node);
-                CPUKernelFunctor functor;
 
-                auto& arg_tensor = external_function->get_tensor_data(args[0].get_name());
-                auto& out_indices_tensor = external_function->get_tensor_data(out[0].get_name());
-                auto& out_values_tensor = external_function->get_tensor_data(out[1].get_name());
-                if (out[0].get_element_type() != element::i64 &&
-                    out[0].get_element_type() != element::i32)
-                {
-                    throw ngraph_error("Unsupported index element type");
-                }
-                bool is_int64 = out[0].get_element_type() == element::i64;
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_indices_buffer_index =
+                    external_function->get_buffer_index(out[0].get_name());
+                auto out_values_buffer_index =
+                    external_function->get_buffer_index(out[1].get_name());
                 auto axis = topk->get_top_k_axis();
                 auto in_shape = args[0].get_shape();
-                auto out_shape = out[0].get_shape();
                 auto k = topk->get_k();
                 auto compute_max = topk->get_compute_max();
 
-                auto element_type = args[0].get_element_type();
-                if (element_type == element::f32)
+                std::function<decltype(runtime::cpu::kernel::topk_i32<float>)> kernel;
+
+                if (out[0].get_element_type() == element::i32)
                 {
-                    if (is_int64)
-                    {
-                        functor = [&, in_shape, out_shape, axis, k, compute_max](
-                            CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                            ngraph::runtime::reference::topk<float, int64_t>(
-                                static_cast<float*>(arg_tensor),
-                                static_cast<int64_t*>(out_indices_tensor),
-                                static_cast<float*>(out_values_tensor),
-                                in_shape,
-                                out_shape,
-                                axis,
-                                k,
-                                compute_max);
-                        };
-                    }
-                    else
-                    {
-                        functor = [&, in_shape, out_shape, axis, k, compute_max](
-                            CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                            ngraph::runtime::reference::topk<float, int32_t>(
-                                static_cast<float*>(arg_tensor),
-                                static_cast<int32_t*>(out_indices_tensor),
-                                static_cast<float*>(out_values_tensor),
-                                in_shape,
-                                out_shape,
-                                axis,
-                                k,
-                                compute_max);
-                        };
-                    }
+                    SELECT_KERNEL(
+                        kernel, args[0].get_element_type(), runtime::cpu::kernel::topk_i32);
                 }
-                else if (element_type == element::f64)
+                else if (out[0].get_element_type() == element::i64)
                 {
-                    if (is_int64)
-                    {
-                        functor = [&, in_shape, out_shape, axis, k, compute_max](
-                            CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                            ngraph::runtime::reference::topk<double, int64_t>(
-                                static_cast<double*>(arg_tensor),
-                                static_cast<int64_t*>(out_indices_tensor),
-                                static_cast<double*>(out_values_tensor),
-                                in_shape,
-                                out_shape,
-                                axis,
-                                k,
-                                compute_max);
-                        };
-                    }
-                    else
-                    {
-                        functor = [&, in_shape, out_shape, axis, k, compute_max](
-                            CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                            ngraph::runtime::reference::topk<double, int32_t>(
-                                static_cast<double*>(arg_tensor),
-                                static_cast<int32_t*>(out_indices_tensor),
-                                static_cast<double*>(out_values_tensor),
-                                in_shape,
-                                out_shape,
-                                axis,
-                                k,
-                                compute_max);
-                        };
-                    }
+                    SELECT_KERNEL(
+                        kernel, args[0].get_element_type(), runtime::cpu::kernel::topk_i64);
                 }
                 else
                 {
-                    throw ngraph_error("Unsupported type in CPU Builder for TopK");
+                    throw ngraph_error("Unsupported index element type");
                 }
 
+                auto functor = [&,
+                                kernel,
+                                in_shape,
+                                axis,
+                                k,
+                                compute_max,
+                                arg_buffer_index,
+                                out_indices_buffer_index,
+                                out_values_buffer_index](CPURuntimeContext* ctx,
+                                                         CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[arg_buffer_index],
+                           ctx->buffer_data[out_indices_buffer_index],
+                           ctx->buffer_data[out_values_buffer_index],
+                           in_shape,
+                           axis,
+                           k,
+                           compute_max,
+                           ectx->arena);
+                };
                 functors.emplace_back(functor);
             }
 
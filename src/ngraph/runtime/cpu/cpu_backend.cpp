@@ -69,31 +69,52 @@ shared_ptr<runtime::Tensor> runtime::cpu::CPU_Backend::create_tensor(
 
 runtime::Handle runtime::cpu::CPU_Backend::compile(shared_ptr<Function> func)
 {
-    FunctionInstance& instance = m_function_map[func];
-    if (instance.m_external_function == nullptr)
     {
-        instance.m_external_function = make_shared<CPU_ExternalFunction>(func);
-        instance.m_external_function->m_emit_timing = instance.m_performance_counters_enabled;
-        auto cf = instance.m_external_function->make_call_frame();
-        instance.m_call_frame = dynamic_pointer_cast<CPU_CallFrame>(cf);
+        lock_guard<mutex> lock(m_function_map_mutex);
+        auto it = m_function_map.find(func);
+        if (it != m_function_map.end() && it->second.m_call_frame != nullptr)
+        {
+            return func;
+        }
     }
+
+    // Compiles run one at a time but outside m_function_map_mutex, so calls of functions
+    // that are already compiled never wait for them
+    lock_guard<mutex> compile_lock(m_compile_mutex);
+    bool performance_counters_enabled;
+    {
+        lock_guard<mutex> lock(m_function_map_mutex);
+        FunctionInstance& instance = m_function_map[func];
+        if (instance.m_call_frame != nullptr)
+        {
+            // compiled by another thread while this one waited
+            return func;
+        }
+        performance_counters_enabled = instance.m_performance_counters_enabled;
+    }
+
+    auto external_function = make_shared<CPU_ExternalFunction>(func);
+    external_function->m_emit_timing = performance_counters_enabled;
+    auto call_frame = dynamic_pointer_cast<CPU_CallFrame>(external_function->make_call_frame());
+
+    lock_guard<mutex> lock(m_function_map_mutex);
+    FunctionInstance& instance = m_function_map[func];
+    instance.m_external_function = external_function;
+    instance.m_call_frame = call_frame;
     return func;
 }
 
 std::shared_ptr<ngraph::runtime::cpu::CPU_CallFrame>
     runtime::cpu::CPU_Backend::get_call_frame(std::shared_ptr<Function> func)
 {
-    FunctionInstance& instance = m_function_map[func];
-    if (instance.m_external_function == nullptr)
+    auto rc = compile(func);
+    if (!rc)
     {
-        auto rc = compile(func);
-        if (!rc)
-        {
-            throw ngraph_error("couldn't compile a function");
-        }
+        throw ngraph_error("couldn't compile a function");
     }
 
-    return instance.m_call_frame;
+    lock_guard<mutex> lock(m_function_map_mutex);
+    return m_function_map.at(func).m_call_frame;
 }
 
 bool runtime::cpu::CPU_Backend::call(shared_ptr<Function> func,
@@ -102,24 +123,51 @@ bool runtime::cpu::CPU_Backend::call(shared_ptr<Function> func,
 {
     bool rc = true;
 
-    FunctionInstance& instance = m_function_map[func];
-    if (instance.m_external_function == nullptr)
+    shared_ptr<CPU_CallFrame> call_frame;
     {
-        throw runtime_error("compile() must be called before call().");
+        lock_guard<mutex> lock(m_function_map_mutex);
+        FunctionInstance& instance = m_function_map[func];
+        if (instance.m_external_function == nullptr)
+        {
+            throw runtime_error("compile() must be called before call().");
+        }
+        call_frame = instance.m_call_frame;
     }
 
-    instance.m_call_frame->call(outputs, inputs);
+    // The call frame checks out a runtime context per call, so concurrent calls to
+    // the same function only contend on ops that are not reentrant
+    call_frame->call(outputs, inputs);
 
     return rc;
 }
 
+future<bool>
+    runtime::cpu::CPU_Backend::call_async(shared_ptr<Function> func,
+                                          const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                          const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    return enqueue_call(m_call_queue, func, outputs, inputs);
+}
+
 void runtime::cpu::CPU_Backend::remove_compiled_function(shared_ptr<Function> func)
 {
+    lock_guard<mutex> lock(m_function_map_mutex);
     m_function_map.erase(func);
 }
 
+void runtime::cpu::CPU_Backend::invalidate_cache(shared_ptr<Function> func)
+{
+    lock_guard<mutex> lock(m_function_map_mutex);
+    auto it = m_function_map.find(func);
+    if (it != m_function_map.end() && it->second.m_call_frame != nullptr)
+    {
+        it->second.m_call_frame->invalidate_cache();
+    }
+}
+
 void runtime::cpu::CPU_Backend::enable_performance_data(shared_ptr<Function> func, bool enable)
 {
+    lock_guard<mutex> lock(m_function_map_mutex);
     FunctionInstance& instance = m_function_map[func];
     if (instance.m_external_function != nullptr)
     {
@@ -132,15 +180,14 @@ vector<runtime::PerformanceCounter>
     runtime::cpu::CPU_Backend::get_performance_data(shared_ptr<Function> func) const
 {
     vector<runtime::PerformanceCounter> rc;
+    lock_guard<mutex> lock(m_function_map_mutex);
     auto it = m_function_map.find(func);
     if (it != m_function_map.end())
     {
         const FunctionInstance& instance = it->second;
         if (instance.m_external_function != nullptr)
         {
-            rc.insert(rc.end(),
-                      instance.m_external_function->get_perf_counters().begin(),
-                      instance.m_external_function->get_perf_counters().end());
+            rc = instance.m_external_function->get_perf_counters();
         }
     }
     return rc;
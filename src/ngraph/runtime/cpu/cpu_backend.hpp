@@ -18,8 +18,10 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 
 #include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/call_queue.hpp"
 
 namespace ngraph
 {
@@ -51,8 +53,16 @@ namespace ngraph
                           const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                           const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
 
+                std::future<bool> call_async(
+                    std::shared_ptr<Function> func,
+                    const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                    const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
+
                 void remove_compiled_function(std::shared_ptr<Function> func) override;
                 std::shared_ptr<CPU_CallFrame> get_call_frame(std::shared_ptr<Function> func);
+                /// \brief Recompute the cached outputs of cacheable ops on the next call of
+                ///        func, e.g. after the data of one of its cacheable parameters changed.
+                void invalidate_cache(std::shared_ptr<Function> func);
 
                 void enable_performance_data(std::shared_ptr<Function> func, bool enable) override;
                 std::vector<PerformanceCounter>
@@ -68,6 +78,12 @@ namespace ngraph
                 };
 
                 std::map<std::shared_ptr<Function>, FunctionInstance> m_function_map;
+                // Guards m_function_map so that call() can run from multiple threads
+                mutable std::mutex m_function_map_mutex;
+                // Serializes compile() without holding m_function_map_mutex
+                std::mutex m_compile_mutex;
+                // Declared last so that queued calls drain before the functions are released
+                std::unique_ptr<CallQueue> m_call_queue;
             };
         }
     }
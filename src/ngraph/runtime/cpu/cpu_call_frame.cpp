@@ -15,6 +15,8 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <cstdlib>
+#include <thread>
 
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
@@ -30,21 +32,46 @@ using namespace std;
 using namespace ngraph;
 
 runtime::cpu::CPU_CallFrame::CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction> external_function,
-                                           EntryPoint compiled_function)
+                                           EntryPoint compiled_function,
+                                           size_t max_contexts)
     : m_external_function(external_function)
     , m_compiled_function(compiled_function)
+    , m_max_contexts(max_contexts)
+    , m_cache_generation(0)
 {
-    setup_runtime_context();
+    if (m_max_contexts == 0)
+    {
+        const auto env_concurrency = std::getenv("NGRAPH_CPU_CONCURRENCY");
+        if (env_concurrency != nullptr)
+        {
+            m_max_contexts = std::strtoul(env_concurrency, nullptr, 10);
+        }
+        else
+        {
+            m_max_contexts = std::thread::hardware_concurrency();
+        }
+        m_max_contexts = std::max<size_t>(m_max_contexts, 1);
+    }
+
+    // The first context is created eagerly so that the single-threaded case and the
+    // debugger always find one in the pool
+    auto ctx = setup_runtime_context();
+    m_contexts.push_back(ctx);
+    m_idle_contexts.push_back(ctx);
 }
 
 runtime::cpu::CPU_CallFrame::~CPU_CallFrame()
 {
-    cleanup_runtime_context();
+    for (auto ctx : m_contexts)
+    {
+        cleanup_runtime_context(ctx);
+    }
 }
 
 void runtime::cpu::CPU_CallFrame::inner_call(
     const std::vector<std::shared_ptr<runtime::Tensor>>& output_tvs,
-    const std::vector<std::shared_ptr<runtime::Tensor>>& input_tvs)
+    const std::vector<std::shared_ptr<runtime::Tensor>>& input_tvs,
+    CPURuntimeContext* ctx)
 {
     vector<void*> inputs;
     vector<void*> outputs;
@@ -63,9 +90,14 @@ void runtime::cpu::CPU_CallFrame::inner_call(
         outputs.push_back(tv->get_data_ptr());
     }
 
+    size_t cache_generation = m_cache_generation;
+    ctx->cache_invalid = ctx->cache_generation != cache_generation;
+    ctx->cache_generation = cache_generation;
+
     // Invoke compiled computation
     if (!m_external_function->is_direct_execution())
     {
+        std::lock_guard<std::mutex> lock(m_compiled_function_mutex);
         m_compiled_function(inputs.data(), outputs.data(), ctx);
     }
     else
@@ -75,6 +107,7 @@ void runtime::cpu::CPU_CallFrame::inner_call(
 
     if (runtime::cpu::IsTracingEnabled())
     {
+        std::lock_guard<std::mutex> lock(m_external_function->get_timeline_mutex());
         GenerateTimeline(m_external_function->get_op_attrs(),
                          ctx->op_durations,
                          m_external_function->get_function_name() + ".timeline.json");
@@ -85,9 +118,45 @@ void runtime::cpu::CPU_CallFrame::call(
     const std::vector<std::shared_ptr<runtime::Tensor>>& output_tvs,
     const std::vector<std::shared_ptr<runtime::Tensor>>& input_tvs)
 {
-    ctx->pc = 0;
     propagate_layouts(output_tvs, m_external_function->get_result_layout_descriptors());
-    inner_call(output_tvs, input_tvs);
+
+    auto ctx = acquire_runtime_context();
+    ctx->pc = 0;
+    try
+    {
+        inner_call(output_tvs, input_tvs, ctx);
+    }
+    catch (...)
+    {
+        release_runtime_context(ctx);
+        throw;
+    }
+    release_runtime_context(ctx);
+}
+
+runtime::cpu::CPURuntimeContext* runtime::cpu::CPU_CallFrame::acquire_runtime_context()
+{
+    std::unique_lock<std::mutex> lock(m_context_mutex);
+    if (m_idle_contexts.empty() && m_contexts.size() < m_max_contexts)
+    {
+        auto ctx = setup_runtime_context();
+        m_contexts.push_back(ctx);
+        return ctx;
+    }
+
+    m_context_available.wait(lock, [this] { return !m_idle_contexts.empty(); });
+    auto ctx = m_idle_contexts.back();
+    m_idle_contexts.pop_back();
+    return ctx;
+}
+
+void runtime::cpu::CPU_CallFrame::release_runtime_context(CPURuntimeContext* ctx)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_context_mutex);
+        m_idle_contexts.push_back(ctx);
+    }
+    m_context_available.notify_one();
 }
 
 void runtime::cpu::CPU_CallFrame::propagate_layouts(
@@ -110,9 +179,9 @@ void runtime::cpu::CPU_CallFrame::propagate_layouts(
     }
 }
 
-void runtime::cpu::CPU_CallFrame::setup_runtime_context()
+runtime::cpu::CPURuntimeContext* runtime::cpu::CPU_CallFrame::setup_runtime_context()
 {
-    ctx = new CPURuntimeContext;
+    auto ctx = new CPURuntimeContext;
 
     ctx->pc = 0;
     ctx->op_durations = nullptr;
@@ -123,6 +192,12 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context()
     ctx->p_en = new bool[m_external_function->get_parameter_layout_descriptors().size()];
 
     ctx->first_iteration = true;
+    ctx->cache_invalid = false;
+    ctx->cache_generation = m_cache_generation;
+
+    auto buffer_count = m_external_function->get_buffer_count();
+    ctx->buffer_data = new void*[buffer_count]();
+    ctx->buffer_stale = new bool[buffer_count]();
 
     // Create temporary buffer pools
     size_t alignment = runtime::cpu::CPU_ExternalFunction::s_memory_pool_alignment;
@@ -149,12 +224,15 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context()
     ctx->mlsl_env = &MLSL::Environment::GetEnv();
     ctx->mlsl_dist = ctx->mlsl_env->CreateDistribution(ctx->mlsl_env->GetProcessCount(), 1);
 #endif
+    return ctx;
 }
 
-void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
+void runtime::cpu::CPU_CallFrame::cleanup_runtime_context(CPURuntimeContext* ctx)
 {
     delete[] ctx->op_durations;
     delete[] ctx->p_en;
+    delete[] ctx->buffer_data;
+    delete[] ctx->buffer_stale;
     for (auto buffer : ctx->memory_buffers)
     {
         delete buffer;
@@ -16,8 +16,11 @@
 
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -41,26 +44,48 @@ namespace ngraph
             using EntryPoint = std::function<EntryPoint_t>;
 
             // Compile and execute graphs
+            //
+            // A call frame owns a pool of runtime contexts. Every call checks out a
+            // context holding its own tensor pointer table and intermediate buffers,
+            // so concurrent calls on the same frame share only the compiled functors
+            // and constants.
             class CPU_CallFrame
             {
             public:
                 friend class CPU_Debugger;
 
+                /// \param max_contexts Upper bound on the number of runtime contexts, and
+                ///        therefore concurrent calls. Contexts are created on demand; callers
+                ///        block once the bound is reached. 0 selects the value of the
+                ///        NGRAPH_CPU_CONCURRENCY environment variable, or the number of
+                ///        hardware threads if it is unset.
                 CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction> external_function,
-                              EntryPoint compiled_function);
+                              EntryPoint compiled_function,
+                              size_t max_contexts = 0);
                 ~CPU_CallFrame();
 
                 /// \brief Invoke the function with values matching the signature of the function.
                 ///
                 /// Tuples will be expanded into their tensor views to build the call frame.
+                /// Safe to invoke from multiple threads.
                 void call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                           const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
 
                 void propagate_layouts(const std::vector<std::shared_ptr<runtime::Tensor>>& tvs,
                                        const LayoutDescriptorPtrs& layouts) const;
 
-                void setup_runtime_context();
-                void cleanup_runtime_context();
+                CPURuntimeContext* setup_runtime_context();
+                void cleanup_runtime_context(CPURuntimeContext* ctx);
+
+                /// \brief Take an idle runtime context from the pool, creating one if the
+                ///        pool is not full, or wait for another call to return one.
+                CPURuntimeContext* acquire_runtime_context();
+                void release_runtime_context(CPURuntimeContext* ctx);
+
+                size_t get_max_contexts() const { return m_max_contexts; }
+                /// \brief Recompute the outputs of cacheable ops on the next call of every
+                ///        runtime context, e.g. after the data of a cacheable parameter changed.
+                void invalidate_cache() { m_cache_generation++; }
 
             protected:
                 CPU_CallFrame(const CPU_CallFrame&) = delete;
@@ -68,11 +93,21 @@ namespace ngraph
                 CPU_CallFrame& operator=(const CPU_CallFrame&) = delete;
 
                 void inner_call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
-                                const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+                                const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+                                CPURuntimeContext* ctx);
 
                 std::shared_ptr<CPU_ExternalFunction> m_external_function;
                 EntryPoint m_compiled_function;
-                CPURuntimeContext* ctx;
+
+                size_t m_max_contexts;
+                std::vector<CPURuntimeContext*> m_contexts;
+                std::vector<CPURuntimeContext*> m_idle_contexts;
+                std::mutex m_context_mutex;
+                std::condition_variable m_context_available;
+                std::atomic<size_t> m_cache_generation;
+                // Generated code keeps its tensor pointers and staleness flags in
+                // globals, so compiled (non-DEX) functions run one call at a time
+                std::mutex m_compiled_function_mutex;
             };
         }
     }
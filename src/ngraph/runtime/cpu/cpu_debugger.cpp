@@ -41,40 +41,40 @@ void runtime::cpu::CPU_CountTracepoint::operator()(void** outputs, const std::st
 
 runtime::cpu::CPU_Debugger::CPU_Debugger(ngraph::runtime::cpu::CPU_CallFrame& callframe)
     : m_callframe(callframe)
+    , m_ctx(callframe.acquire_runtime_context())
 {
 }
 
 runtime::cpu::CPU_Debugger::~CPU_Debugger()
 {
+    m_callframe.release_runtime_context(m_ctx);
 }
 
 bool runtime::cpu::CPU_Debugger::step()
 {
-    auto ctx = m_callframe.ctx;
-    if (ctx->pc >= m_callframe.m_external_function->op_names.size())
+    if (m_ctx->pc >= m_callframe.m_external_function->op_names.size())
     {
         return false;
     }
 
-    bool is_set = ctx->breakpoints.count(ctx->pc + 1) != 0;
-    ctx->breakpoints.insert(ctx->pc + 1);
-    m_callframe.inner_call(m_outputs, m_inputs);
+    bool is_set = m_ctx->breakpoints.count(m_ctx->pc + 1) != 0;
+    m_ctx->breakpoints.insert(m_ctx->pc + 1);
+    m_callframe.inner_call(m_outputs, m_inputs, m_ctx);
     if (!is_set)
     {
-        ctx->breakpoints.erase(ctx->pc);
+        m_ctx->breakpoints.erase(m_ctx->pc);
     }
     return true;
 }
 
 void runtime::cpu::CPU_Debugger::resume()
 {
-    auto ctx = m_callframe.ctx;
-    if (ctx->pc >= m_callframe.m_external_function->op_names.size())
+    if (m_ctx->pc >= m_callframe.m_external_function->op_names.size())
     {
         return;
     }
 
-    m_callframe.inner_call(m_outputs, m_inputs);
+    m_callframe.inner_call(m_outputs, m_inputs, m_ctx);
     return;
 }
 
@@ -83,8 +83,8 @@ void runtime::cpu::CPU_Debugger::call(const std::vector<std::shared_ptr<runtime:
 {
     m_outputs.assign(outputs.begin(), outputs.end());
     m_inputs.assign(inputs.begin(), inputs.end());
-    m_callframe.ctx->pc = 0;
-    m_callframe.inner_call(m_outputs, m_inputs);
+    m_ctx->pc = 0;
+    m_callframe.inner_call(m_outputs, m_inputs, m_ctx);
 }
 
 std::tuple<bool, size_t> runtime::cpu::CPU_Debugger::find_pc_for_node(std::shared_ptr<Node> op)
@@ -108,7 +108,7 @@ bool runtime::cpu::CPU_Debugger::add_breakpoint(std::shared_ptr<Node> op)
     std::tie(found, pc) = find_pc_for_node(op);
     if (found)
     {
-        m_callframe.ctx->breakpoints.insert(pc);
+        m_ctx->breakpoints.insert(pc);
         return true;
     }
     return false;
@@ -121,7 +121,7 @@ bool runtime::cpu::CPU_Debugger::delete_breakpoint(std::shared_ptr<Node> op)
     std::tie(found, pc) = find_pc_for_node(op);
     if (found)
     {
-        m_callframe.ctx->breakpoints.erase(pc);
+        m_ctx->breakpoints.erase(pc);
         return true;
     }
     return false;
@@ -129,8 +129,23 @@ bool runtime::cpu::CPU_Debugger::delete_breakpoint(std::shared_ptr<Node> op)
 
 void* runtime::cpu::CPU_Debugger::inspect(std::shared_ptr<Node> op, size_t output_index)
 {
-    return m_callframe.m_external_function->tensor_data.at(op->get_name() + "_" +
-                                                           to_string(output_index));
+    auto external_function = m_callframe.m_external_function;
+    auto buffer_index =
+        external_function->m_buffer_indices.at(op->get_name() + "_" + to_string(output_index));
+    return m_ctx->buffer_data[buffer_index];
+}
+
+bool runtime::cpu::CPU_Debugger::replace_functor(size_t pc, const CPUKernelFunctor& functor)
+{
+    // Every runtime context runs the same functors. Holding the pool lock keeps new calls
+    // out, and the swap is refused while a call other than the debugger's own is running.
+    std::lock_guard<std::mutex> lock(m_callframe.m_context_mutex);
+    if (m_callframe.m_contexts.size() - m_callframe.m_idle_contexts.size() > 1)
+    {
+        return false;
+    }
+    m_callframe.m_external_function->functors.at(pc) = functor;
+    return true;
 }
 
 bool runtime::cpu::CPU_Debugger::add_tracepoint(
@@ -148,10 +163,10 @@ bool runtime::cpu::CPU_Debugger::add_tracepoint(
         }
 
         auto op_name = op->get_name();
-        std::vector<void**> poutputs;
+        std::vector<size_t> poutputs;
         for (size_t i = 0; i < op->get_outputs().size(); i++)
         {
-            poutputs.push_back(&external_function->get_tensor_data(op_name + "_" + to_string(i)));
+            poutputs.push_back(external_function->get_buffer_index(op_name + "_" + to_string(i)));
         }
 
         auto original_functor = external_function->functors.at(pc);
@@ -164,13 +179,16 @@ bool runtime::cpu::CPU_Debugger::add_tracepoint(
             std::vector<void*> outputs;
             for (auto pout : poutputs)
             {
-                outputs.push_back(*pout);
+                outputs.push_back(ctx->buffer_data[pout]);
             }
 
             callback(outputs.data(), op_name);
         };
+        if (!replace_functor(pc, trace_functor))
+        {
+            return false;
+        }
         replaced_functors[pc] = original_functor;
-        external_function->functors.at(pc) = trace_functor;
         return true;
     }
 
@@ -184,7 +202,12 @@ bool runtime::cpu::CPU_Debugger::delete_tracepoint(std::shared_ptr<Node> op)
     std::tie(found, pc) = find_pc_for_node(op);
     if (found)
     {
-        m_callframe.m_external_function->functors.at(pc) = replaced_functors.at(pc);
+        auto it = replaced_functors.find(pc);
+        if (it == replaced_functors.end() || !replace_functor(pc, it->second))
+        {
+            return false;
+        }
+        replaced_functors.erase(it);
         return true;
     }
 
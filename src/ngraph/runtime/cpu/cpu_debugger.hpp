@@ -59,6 +59,9 @@ namespace ngraph
             class CPU_Debugger
             {
             public:
+                /// \brief Holds a runtime context of callframe until destroyed, so the
+                ///        breakpoints and buffers it inspects are not shared with concurrent
+                ///        calls of the call frame.
                 CPU_Debugger(CPU_CallFrame& callframe);
                 ~CPU_Debugger();
 
@@ -80,6 +83,9 @@ namespace ngraph
                 bool delete_breakpoint(std::shared_ptr<Node> op);
 
                 /// \brief Add a tracepoint to a node
+                ///
+                /// Tracepoints apply to every call of the call frame. They can only be added
+                /// or removed while no other call is running; false is returned otherwise.
                 bool
                     add_tracepoint(std::shared_ptr<Node> op,
                                    const std::function<void(void**, const std::string&)>& callback);
@@ -91,11 +97,14 @@ namespace ngraph
             protected:
                 // Returns a tuple with the following items <found, pc>
                 std::tuple<bool, size_t> find_pc_for_node(std::shared_ptr<Node> op);
+                // Swaps the functor at pc unless another call of the call frame is running
+                bool replace_functor(size_t pc, const CPUKernelFunctor& functor);
                 CPU_Debugger(const CPU_Debugger&) = delete;
                 CPU_Debugger(CPU_Debugger&&) = delete;
                 CPU_Debugger& operator=(const CPU_Debugger&) = delete;
                 std::map<size_t, CPUKernelFunctor> replaced_functors;
                 CPU_CallFrame& m_callframe;
+                CPURuntimeContext* m_ctx;
                 std::vector<std::shared_ptr<runtime::Tensor>> m_inputs;
                 std::vector<std::shared_ptr<runtime::Tensor>> m_outputs;
             };
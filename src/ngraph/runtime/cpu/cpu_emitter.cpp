@@ -17,6 +17,7 @@
 #include "ngraph/runtime/cpu/cpu_emitter.hpp"
 #include <algorithm>
 #include <cmath>
+#include <iomanip>
 #include <numeric>
 #include <string>
 #include <typeindex>
@@ -52,9 +53,11 @@
 #include "ngraph/op/experimental/quantized_avg_pool.hpp"
 #include "ngraph/op/experimental/quantized_conv_bias.hpp"
 #include "ngraph/op/experimental/quantized_conv_relu.hpp"
+#include "ngraph/op/experimental/quantized_dot.hpp"
 #include "ngraph/op/experimental/quantized_max_pool.hpp"
 #include "ngraph/op/floor.hpp"
 #include "ngraph/op/function_call.hpp"
+#include "ngraph/op/gather.hpp"
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/greater.hpp"
 #include "ngraph/op/greater_eq.hpp"
@@ -87,6 +90,7 @@
 #include "ngraph/op/result.hpp"
 #include "ngraph/op/reverse.hpp"
 #include "ngraph/op/reverse_sequence.hpp"
+#include "ngraph/op/scatter_add.hpp"
 #include "ngraph/op/select.hpp"
 #include "ngraph/op/select_and_scatter.hpp"
 #include "ngraph/op/sign.hpp"
@@ -100,10 +104,12 @@
 #include "ngraph/op/tan.hpp"
 #include "ngraph/op/tanh.hpp"
 #include "ngraph/op/topk.hpp"
+#include "ngraph/op/util/reducer.hpp"
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_kernel_emitters.hpp"
 #include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
+#include "ngraph/runtime/cpu/op/attention.hpp"
 #include "ngraph/runtime/cpu/op/batch_dot.hpp"
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
 #include "ngraph/runtime/cpu/op/bounded_relu.hpp"
@@ -111,8 +117,10 @@
 #include "ngraph/runtime/cpu/op/conv_bias.hpp"
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
+#include "ngraph/runtime/cpu/op/gelu.hpp"
 #include "ngraph/runtime/cpu/op/group_conv.hpp"
 #include "ngraph/runtime/cpu/op/group_conv_bias.hpp"
+#include "ngraph/runtime/cpu/op/layer_norm.hpp"
 #include "ngraph/runtime/cpu/op/leaky_relu.hpp"
 #include "ngraph/runtime/cpu/op/loop_kernel.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
@@ -1465,6 +1473,42 @@ namespace ngraph
                 writer.block_end();
             }
 
+            // Emits `f`, the scalar reduction function of Reduce and ReduceWindow. Standard
+            // monoids are inlined instead of calling the compiled function per element.
+            static void emit_reduction_lambda(codegen::CodeWriter& writer,
+                                              const shared_ptr<Function>& reduction_function,
+                                              const string& type)
+            {
+                string expression;
+                switch (ngraph::op::util::get_reducer_kind(reduction_function))
+                {
+                case ngraph::op::util::ReducerKind::Add: expression = "x + y"; break;
+                case ngraph::op::util::ReducerKind::Multiply: expression = "x * y"; break;
+                case ngraph::op::util::ReducerKind::Maximum: expression = "x > y ? x : y"; break;
+                case ngraph::op::util::ReducerKind::Minimum: expression = "x < y ? x : y"; break;
+                case ngraph::op::util::ReducerKind::And: expression = "x && y"; break;
+                case ngraph::op::util::ReducerKind::Or: expression = "x || y"; break;
+                case ngraph::op::util::ReducerKind::Unknown: break;
+                }
+
+                writer << "auto f = [&](" << type << " x, " << type << " y) -> " << type << " {\n";
+                writer.indent++;
+                if (!expression.empty())
+                {
+                    writer << "return " << expression << ";\n";
+                }
+                else
+                {
+                    writer << type << " result;\n";
+                    writer << "void* args[] = {&x, &y};\n";
+                    writer << "void* out[] = {&result};\n";
+                    writer << reduction_function->get_name() << "(args, out, ctx);\n";
+                    writer << "return result;\n";
+                }
+                writer.indent--;
+                writer << "};\n";
+            }
+
             // TODO: This and other ops include comments/notes that
             // we don't want to just copy-paste here. Figure out a better way
             // or just point to ngvm/external_function.cpp with a note that
@@ -1486,15 +1530,7 @@ namespace ngraph
 
                 string type = f_result_element_type.c_type_string();
 
-                writer << "auto f = [&](" << type << " x, " << type << " y) -> " << type << " {\n";
-                writer.indent++;
-                writer << type << " result;\n";
-                writer << "void* args[] = {&x, &y};\n";
-                writer << "void* out[] = {&result};\n";
-                writer << reduction_function->get_name() << "(args, out, ctx);\n";
-                writer << "return result;\n";
-                writer.indent--;
-                writer << "};\n";
+                emit_reduction_lambda(writer, reduction_function, type);
 
                 kernel::emit_reduce(writer,
                                     args[0].get_element_type().c_type_string(),
@@ -1685,6 +1721,39 @@ namespace ngraph
                 writer.block_end();
             }
 
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::ScatterAdd)
+            {
+                writer.block_begin();
+                auto index_type_name = args[1].get_element_type().c_type_string();
+                auto type_name = out[0].get_element_type().c_type_string();
+                writer << "reference::scatter_add<" << type_name << "," << index_type_name << ">(";
+                writer << "            " << args[0].get_name() << ",\n";
+                writer << "            " << args[1].get_name() << ",\n";
+                writer << "            " << args[2].get_name() << ",\n";
+                writer << "            " << out[0].get_name() << ",\n";
+                writer << "            {" << join(args[0].get_shape()) << "},\n";
+                writer << "            " << args[1].get_size() << ");\n";
+                writer.block_end();
+            }
+
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::Gather)
+            {
+                writer.block_begin();
+                auto gather = static_cast<const ngraph::op::Gather*>(node);
+                auto index_type_name = args[1].get_element_type().c_type_string();
+                auto type_name = out[0].get_element_type().c_type_string();
+                writer << "reference::gather<" << type_name << "," << index_type_name << ">(";
+                writer << "            " << args[0].get_name() << ",\n";
+                writer << "            " << args[1].get_name() << ",\n";
+                writer << "            " << out[0].get_name() << ",\n";
+                writer << "            {" << join(args[0].get_shape()) << "},\n";
+                writer << "            " << args[1].get_size() << ",\n";
+                writer << "            " << gather->get_axis() << ");\n";
+                writer.block_end();
+            }
+
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::Sin)
             {
@@ -2722,6 +2791,25 @@ namespace ngraph
                 }
             }
 
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::QuantizedDot)
+            {
+                auto& data_shape = args[0].get_shape();
+                auto& weights_shape = args[1].get_shape();
+                writer << "cpu::kernel::quantized_dot<"
+                       << args[0].get_element_type().c_type_string() << ", "
+                       << args[1].get_element_type().c_type_string() << ", "
+                       << out[0].get_element_type().c_type_string() << ">("
+                       << args[0].get_name() << ",\n";
+                writer << "                                " << args[1].get_name() << ",\n";
+                writer << "                                " << args[2].get_name() << ",\n";
+                writer << "                                " << out[0].get_name() << ",\n";
+                writer << "                                " << data_shape[0] << ",\n";
+                writer << "                                " << data_shape[1] << ",\n";
+                writer << "                                " << weights_shape[1] << ",\n";
+                writer << "                                0);\n";
+            }
+
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::MaxPoolWithIndices)
             {
@@ -2864,15 +2952,7 @@ namespace ngraph
                 writer.block_begin();
 
                 string type = f_result_element_type.c_type_string();
-                writer << "auto f = [&](" << type << " x, " << type << " y) -> " << type << " {\n";
-                writer.indent++;
-                writer << type << " result;\n";
-                writer << "void* args[] = {&x, &y};\n";
-                writer << "void* out[] = {&result};\n";
-                writer << reduction_function->get_name() << "(args, out, ctx);\n";
-                writer << "return result;\n";
-                writer.indent--;
-                writer << "};\n";
+                emit_reduction_lambda(writer, reduction_function, type);
 
                 writer << "reference::reduce_window<" << out[0].get_type() << ">("
                        << args[0].get_name() << ",\n";
@@ -3434,6 +3514,60 @@ namespace ngraph
                 }
             }
 
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::LayerNorm)
+            {
+                auto layer_norm = static_cast<const ngraph::op::LayerNorm*>(node);
+                auto& data_shape = args[0].get_shape();
+                std::stringstream epsilon;
+                epsilon << std::setprecision(17) << layer_norm->get_epsilon();
+                size_t width = data_shape.back();
+                size_t rows = width == 0 ? 0 : shape_size(data_shape) / width;
+                writer << "cpu::kernel::layer_norm<" << out[0].get_element_type().c_type_string()
+                       << ">(" << args[0].get_name() << ",\n";
+                writer << "                            " << args[1].get_name() << ",\n";
+                writer << "                            " << args[2].get_name() << ",\n";
+                writer << "                            " << out[0].get_name() << ",\n";
+                writer << "                            " << rows << ",\n";
+                writer << "                            " << width << ",\n";
+                writer << "                            " << epsilon.str() << ",\n";
+                writer << "                            0);\n";
+            }
+
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::Gelu)
+            {
+                writer << "cpu::kernel::gelu<" << out[0].get_element_type().c_type_string() << ">("
+                       << args[0].get_name() << ", " << out[0].get_name() << ", "
+                       << out[0].get_size() << ", 0);\n";
+            }
+
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::ScaledDotProductAttention)
+            {
+                auto attention = static_cast<const ngraph::op::ScaledDotProductAttention*>(node);
+                auto& query_shape = args[0].get_shape();
+                auto& key_shape = args[1].get_shape();
+                auto& value_shape = args[2].get_shape();
+                size_t rank = query_shape.size();
+                std::stringstream scale;
+                scale << std::setprecision(17) << attention->get_scale();
+                writer << "cpu::kernel::scaled_dot_product_attention<"
+                       << out[0].get_element_type().c_type_string() << ">("
+                       << args[0].get_name() << ",\n";
+                writer << "                            " << args[1].get_name() << ",\n";
+                writer << "                            " << args[2].get_name() << ",\n";
+                writer << "                            " << out[0].get_name() << ",\n";
+                writer << "                            " << (rank == 3 ? query_shape[0] : 1)
+                       << ",\n";
+                writer << "                            " << query_shape[rank - 2] << ",\n";
+                writer << "                            " << key_shape[rank - 2] << ",\n";
+                writer << "                            " << query_shape[rank - 1] << ",\n";
+                writer << "                            " << value_shape[rank - 1] << ",\n";
+                writer << "                            " << scale.str() << ",\n";
+                writer << "                            0);\n";
+            }
+
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::Sigmoid)
             {
@@ -3927,6 +4061,8 @@ namespace ngraph
                 auto nege =
                     std::bind(emit_prefix_operator, std::string("-"), std::placeholders::_1);
                 auto sube = std::bind(emit_infix_operator, std::string("-"), std::placeholders::_1);
+                auto mule = std::bind(emit_infix_operator, std::string("*"), std::placeholders::_1);
+                auto dive = std::bind(emit_infix_operator, std::string("/"), std::placeholders::_1);
 
                 return std::unordered_map<
                     std::type_index,
@@ -3938,6 +4074,8 @@ namespace ngraph
                     {TI(ngraph::op::Add), adde},
                     {TI(ngraph::op::Negative), nege},
                     {TI(ngraph::op::Subtract), sube},
+                    {TI(ngraph::op::Multiply), mule},
+                    {TI(ngraph::op::Divide), dive},
                 };
             }
 
@@ -3974,7 +4112,17 @@ namespace ngraph
 
                 for (size_t i = 0; i < args.size(); i++)
                 {
-                    std::string sname = std::string(args[i].get_name()) + "[i]";
+                    // single-element inputs are broadcast, the index into the inputs of other
+                    // broadcasts is added where they are used
+                    std::string sname = args[i].get_name();
+                    if (args[i].get_size() == 1)
+                    {
+                        sname += "[0]";
+                    }
+                    else if (args[i].get_size() == out[0].get_size())
+                    {
+                        sname += "[i]";
+                    }
                     auto entry = std::make_pair(&clk->get_inputs().at(i).get_output(), sname);
                     loop_symbol_table.insert(entry);
                 }
@@ -3999,6 +4147,28 @@ namespace ngraph
                 {
                     auto op_node = node_list[i];
                     auto op = &op_node->get_outputs().at(0);
+                    if (auto broadcast =
+                            std::dynamic_pointer_cast<ngraph::op::Broadcast>(op_node))
+                    {
+                        auto source = loop_symbol_table.at(
+                            get_goe_input_output(&op_node->get_inputs().at(0).get_output()));
+                        auto pattern = runtime::cpu::op::get_loop_broadcast(*broadcast);
+                        if (pattern.period != 1 &&
+                            shape_size(op_node->get_input_shape(0)) != out[0].get_size())
+                        {
+                            source += (pattern.tile ? "[i % " : "[i / ") +
+                                      std::to_string(pattern.period) + "]";
+                        }
+                        if (loop_symbol_table.count(op) == 0)
+                        {
+                            loop_symbol_table.insert(std::make_pair(op, source));
+                        }
+                        else
+                        {
+                            writer << loop_symbol_table.at(op) << " = " << source << ";\n";
+                        }
+                        continue;
+                    }
                     std::string tmp;
                     if (loop_symbol_table.count(op) == 0)
                     {
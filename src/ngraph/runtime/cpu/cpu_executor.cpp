@@ -60,8 +60,13 @@ namespace ngraph
         {
             namespace executor
             {
-                CPUExecutor::CPUExecutor(int num_thread_pools)
-                    : m_num_thread_pools(num_thread_pools)
+                CPUExecutor::CPUExecutor(int num_thread_pools,
+                                         std::chrono::milliseconds inter_op_idle_timeout)
+                    : m_num_inter_op_workers(0)
+                    , m_idle_inter_op_workers(0)
+                    , m_stopping(false)
+                    , m_inter_op_idle_timeout(inter_op_idle_timeout)
+                    , m_num_thread_pools(num_thread_pools)
                 {
                     for (int i = 0; i < num_thread_pools; i++)
                     {
@@ -79,6 +84,14 @@ namespace ngraph
                     }
                 }
 
+                CPUExecutor::~CPUExecutor()
+                {
+                    std::unique_lock<std::mutex> lock(m_inter_op_mutex);
+                    m_stopping = true;
+                    m_inter_op_ready.notify_all();
+                    m_inter_op_exited.wait(lock, [this] { return m_num_inter_op_workers == 0; });
+                }
+
                 void CPUExecutor::execute(CPUKernelFunctor& f,
                                           CPURuntimeContext* ctx,
                                           CPUExecutionContext* ectx,
@@ -95,6 +108,56 @@ namespace ngraph
                     }
                 }
 
+                void CPUExecutor::schedule(std::function<void()> f)
+                {
+                    std::lock_guard<std::mutex> lock(m_inter_op_mutex);
+                    m_inter_op_tasks.push_back(std::move(f));
+                    if (m_inter_op_tasks.size() > m_idle_inter_op_workers)
+                    {
+                        std::thread(&CPUExecutor::inter_op_worker_loop, this).detach();
+                        m_num_inter_op_workers++;
+                    }
+                    else
+                    {
+                        m_inter_op_ready.notify_one();
+                    }
+                }
+
+                size_t CPUExecutor::get_num_inter_op_workers()
+                {
+                    std::lock_guard<std::mutex> lock(m_inter_op_mutex);
+                    return m_num_inter_op_workers;
+                }
+
+                void CPUExecutor::inter_op_worker_loop()
+                {
+                    std::unique_lock<std::mutex> lock(m_inter_op_mutex);
+                    while (true)
+                    {
+                        m_idle_inter_op_workers++;
+                        m_inter_op_ready.wait_for(lock, m_inter_op_idle_timeout, [this] {
+                            return m_stopping || !m_inter_op_tasks.empty();
+                        });
+                        m_idle_inter_op_workers--;
+                        if (m_inter_op_tasks.empty())
+                        {
+                            // Idle for too long, or the executor is being destroyed. The
+                            // notification is sent with the lock held, so the destructor only
+                            // returns once this thread no longer touches the executor.
+                            m_num_inter_op_workers--;
+                            m_inter_op_exited.notify_all();
+                            return;
+                        }
+                        {
+                            auto f = std::move(m_inter_op_tasks.front());
+                            m_inter_op_tasks.pop_front();
+                            lock.unlock();
+                            f();
+                        }
+                        lock.lock();
+                    }
+                }
+
                 CPUExecutor& GetCPUExecutor()
                 {
                     static int num_thread_pools = GetNumThreadPools();
@@ -16,7 +16,11 @@
 
 #pragma once
 
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <functional>
+#include <mutex>
 #include <thread>
 
 #include <mkldnn.hpp>
@@ -42,7 +46,12 @@ namespace ngraph
                 class CPUExecutor
                 {
                 public:
-                    explicit CPUExecutor(int num_thread_pools);
+                    /// \param inter_op_idle_timeout How long an inter-op worker waits for a
+                    ///        new task before it exits.
+                    explicit CPUExecutor(int num_thread_pools,
+                                         std::chrono::milliseconds inter_op_idle_timeout =
+                                             std::chrono::seconds(1));
+                    ~CPUExecutor();
 
                     Eigen::ThreadPoolDevice& get_device(int id)
                     {
@@ -53,9 +62,33 @@ namespace ngraph
                                  CPURuntimeContext* ctx,
                                  CPUExecutionContext* ectx,
                                  bool use_tbb = false);
+
+                    /// \brief Runs `f` asynchronously on an inter-op worker thread. A new worker
+                    ///        is started whenever none is idle, so `f` never waits behind work
+                    ///        scheduled by a concurrent call.
+                    void schedule(std::function<void()> f);
+
+                    /// \brief The number of inter-op worker threads currently running.
+                    size_t get_num_inter_op_workers();
+
                     int get_num_thread_pools() { return m_num_thread_pools; }
                 private:
+                    void inter_op_worker_loop();
+
                     std::vector<std::unique_ptr<Eigen::ThreadPool>> m_thread_pools;
+                    // Detached threads that run the streams of kernels of a call, each of which
+                    // uses its own thread pool for intra-op parallelism. Streams of the same call
+                    // wait on each other, so they must not queue behind another call's. Workers
+                    // left idle for `m_inter_op_idle_timeout` exit, so the threads started for
+                    // a burst of concurrent calls do not outlive it.
+                    std::deque<std::function<void()>> m_inter_op_tasks;
+                    size_t m_num_inter_op_workers;
+                    size_t m_idle_inter_op_workers;
+                    bool m_stopping;
+                    std::chrono::milliseconds m_inter_op_idle_timeout;
+                    std::mutex m_inter_op_mutex;
+                    std::condition_variable m_inter_op_ready;
+                    std::condition_variable m_inter_op_exited;
                     std::vector<std::unique_ptr<Eigen::ThreadPoolDevice>> m_thread_pool_devices;
                     std::vector<tbb::task_arena> m_tbb_arenas;
                     int m_num_thread_pools;
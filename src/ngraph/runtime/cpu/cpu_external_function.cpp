@@ -69,9 +69,11 @@
 #include "ngraph/op/experimental/quantized_conv.hpp"
 #include "ngraph/op/experimental/quantized_conv_bias.hpp"
 #include "ngraph/op/experimental/quantized_conv_relu.hpp"
+#include "ngraph/op/experimental/quantized_dot.hpp"
 #include "ngraph/op/experimental/quantized_max_pool.hpp"
 #include "ngraph/op/floor.hpp"
 #include "ngraph/op/function_call.hpp"
+#include "ngraph/op/gather.hpp"
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/greater.hpp"
 #include "ngraph/op/greater_eq.hpp"
@@ -104,6 +106,7 @@
 #include "ngraph/op/result.hpp"
 #include "ngraph/op/reverse.hpp"
 #include "ngraph/op/reverse_sequence.hpp"
+#include "ngraph/op/scatter_add.hpp"
 #include "ngraph/op/select.hpp"
 #include "ngraph/op/select_and_scatter.hpp"
 #include "ngraph/op/sign.hpp"
@@ -147,6 +150,7 @@
 #include "ngraph/runtime/cpu/cpu_tracing.hpp"
 #include "ngraph/runtime/cpu/cpu_visualize_tree.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
+#include "ngraph/runtime/cpu/op/attention.hpp"
 #include "ngraph/runtime/cpu/op/batch_dot.hpp"
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
 #include "ngraph/runtime/cpu/op/bounded_relu.hpp"
@@ -154,8 +158,10 @@
 #include "ngraph/runtime/cpu/op/conv_bias.hpp"
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
+#include "ngraph/runtime/cpu/op/gelu.hpp"
 #include "ngraph/runtime/cpu/op/group_conv.hpp"
 #include "ngraph/runtime/cpu/op/group_conv_bias.hpp"
+#include "ngraph/runtime/cpu/op/layer_norm.hpp"
 #include "ngraph/runtime/cpu/op/leaky_relu.hpp"
 #include "ngraph/runtime/cpu/op/loop_kernel.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
@@ -170,6 +176,7 @@
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_horizontal_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_layout.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_loop_kernel_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_mat_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_memory_optimization.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_post_layout_optimizations.hpp"
@@ -218,6 +225,7 @@ runtime::cpu::CPU_ExternalFunction::CPU_ExternalFunction(
     , m_release_function(release_function)
     , m_emit_timing(false)
     , m_use_tbb(std::getenv("NGRAPH_CPU_USE_TBB") != nullptr)
+    , m_pack_memory(std::getenv("NGRAPH_CPU_MEMORY_PACKING") != nullptr && !m_use_tbb)
 #if !defined(NGRAPH_DEX_ONLY)
     , m_is_compiled(false)
     , m_direct_execution(!std::getenv("NGRAPH_CODEGEN"))
@@ -226,6 +234,7 @@ runtime::cpu::CPU_ExternalFunction::CPU_ExternalFunction(
 #endif
     , m_compiled_function(nullptr)
     , m_function_name(function->get_name())
+    , m_cache_buffer_index(0)
     , m_is_built(false)
 {
 }
@@ -321,6 +330,8 @@ static const runtime::cpu::OpMap dispatcher{
     {TI(ngraph::op::Slice), &runtime::cpu::CPU_Emitter::emit<op::Slice>},
     {TI(ngraph::op::Sum), &runtime::cpu::CPU_Emitter::emit<op::Sum>},
     {TI(ngraph::op::EmbeddingLookup), &runtime::cpu::CPU_Emitter::emit<op::EmbeddingLookup>},
+    {TI(ngraph::op::ScatterAdd), &runtime::cpu::CPU_Emitter::emit<op::ScatterAdd>},
+    {TI(ngraph::op::Gather), &runtime::cpu::CPU_Emitter::emit<op::Gather>},
     {TI(ngraph::op::Exp), &runtime::cpu::CPU_Emitter::emit<op::Exp>},
     {TI(ngraph::op::Sin), &runtime::cpu::CPU_Emitter::emit<op::Sin>},
     {TI(ngraph::op::Sinh), &runtime::cpu::CPU_Emitter::emit<op::Sinh>},
@@ -368,6 +379,7 @@ static const runtime::cpu::OpMap dispatcher{
     {TI(ngraph::op::MaxPool), &runtime::cpu::CPU_Emitter::emit<op::MaxPool>},
     {TI(ngraph::op::QuantizedMaxPool), &runtime::cpu::CPU_Emitter::emit<op::QuantizedMaxPool>},
     {TI(ngraph::op::QuantizedAvgPool), &runtime::cpu::CPU_Emitter::emit<op::QuantizedAvgPool>},
+    {TI(ngraph::op::QuantizedDot), &runtime::cpu::CPU_Emitter::emit<op::QuantizedDot>},
     {TI(ngraph::op::MaxPoolWithIndices), &runtime::cpu::CPU_Emitter::emit<op::MaxPoolWithIndices>},
     {TI(ngraph::op::Reverse), &runtime::cpu::CPU_Emitter::emit<op::Reverse>},
     {TI(ngraph::op::ReverseSequence), &runtime::cpu::CPU_Emitter::emit<op::ReverseSequence>},
@@ -405,6 +417,10 @@ static const runtime::cpu::OpMap dispatcher{
     {TI(ngraph::op::And), &runtime::cpu::CPU_Emitter::emit<op::And>},
     {TI(ngraph::op::Or), &runtime::cpu::CPU_Emitter::emit<op::Or>},
     {TI(ngraph::op::LeakyRelu), &runtime::cpu::CPU_Emitter::emit<op::LeakyRelu>},
+    {TI(ngraph::op::LayerNorm), &runtime::cpu::CPU_Emitter::emit<op::LayerNorm>},
+    {TI(ngraph::op::Gelu), &runtime::cpu::CPU_Emitter::emit<op::Gelu>},
+    {TI(ngraph::op::ScaledDotProductAttention),
+     &runtime::cpu::CPU_Emitter::emit<op::ScaledDotProductAttention>},
     {TI(ngraph::runtime::cpu::op::LoopKernel),
      &runtime::cpu::CPU_Emitter::emit<runtime::cpu::op::LoopKernel>},
     {TI(ngraph::op::LRN), &runtime::cpu::CPU_Emitter::emit<ngraph::op::LRN>},
@@ -453,7 +469,8 @@ void runtime::cpu::CPU_ExternalFunction::compile()
     pass_manager.register_pass<ngraph::pass::Liveness>();
     pass_manager.register_pass<ngraph::pass::PropagateCacheability>(
         runtime::cpu::get_annotations_factory());
-    pass_manager.register_pass<ngraph::pass::MemoryLayout>(size_t(s_memory_pool_alignment), true);
+    pass_manager.register_pass<ngraph::pass::MemoryLayout>(
+        size_t(s_memory_pool_alignment), true, m_pack_memory);
     pass_manager.run_passes(m_function);
 
     unordered_map<shared_ptr<Function>, list<shared_ptr<Node>>> function_ordered_ops;
@@ -501,6 +518,7 @@ void runtime::cpu::CPU_ExternalFunction::compile()
 #include "ngraph/runtime/reference/dequantize.hpp"
 #include "ngraph/runtime/reference/dot.hpp"
 #include "ngraph/runtime/reference/embedding_lookup.hpp"
+#include "ngraph/runtime/reference/gather.hpp"
 #include "ngraph/runtime/reference/generate_mask.hpp"
 #include "ngraph/runtime/reference/lrn.hpp"
 #include "ngraph/runtime/reference/max.hpp"
@@ -520,6 +538,7 @@ void runtime::cpu::CPU_ExternalFunction::compile()
 #include "ngraph/runtime/reference/result.hpp"
 #include "ngraph/runtime/reference/reverse.hpp"
 #include "ngraph/runtime/reference/reverse_sequence.hpp"
+#include "ngraph/runtime/reference/scatter_add.hpp"
 #include "ngraph/runtime/reference/select_and_scatter.hpp"
 #include "ngraph/runtime/reference/slice.hpp"
 #include "ngraph/runtime/reference/sum.hpp"
@@ -865,7 +884,7 @@ using namespace ngraph::runtime;
             // Op Control
             if (!node->is_parameter() && !node->is_constant())
             {
-                writer << "if (ctx->first_iteration ";
+                writer << "if (ctx->first_iteration || ctx->cache_invalid ";
                 for (const descriptor::Input& input : node->get_inputs())
                 {
                     const descriptor::Output& output = input.get_output();
@@ -883,8 +902,9 @@ using namespace ngraph::runtime;
                 }
 
                 // Always enable nodes computing output tensors or nodes whose outputs might get
-                // overwritten due to inplace kernels
-                if (computes_result(node.get()) || possibly_overwritten(node.get()))
+                // overwritten due to inplace kernels or memory packing
+                if (m_pack_memory || computes_result(node.get()) ||
+                    possibly_overwritten(node.get()))
                 {
                     writer << " || 1";
                 }
@@ -1099,6 +1119,7 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(ngraph::pass::Ma
     REGISTER_KNOBBED_PASS(CPUFusion, true, runtime::cpu::pass);
     REGISTER_KNOBBED_PASS(CPUHorizontalFusion, true, runtime::cpu::pass);
     REGISTER_KNOBBED_PASS(CPUCollapseDims, true, runtime::cpu::pass);
+    REGISTER_KNOBBED_PASS(CPULoopKernelFusion, false, runtime::cpu::pass);
 #if defined(NGRAPH_HALIDE)
     REGISTER_KNOBBED_PASS(HalideSubgraphExtraction, true, ngraph::runtime::cpu::pass);
 #endif
@@ -1130,6 +1151,16 @@ bool runtime::cpu::CPU_ExternalFunction::computes_result(Node* node)
     return false;
 }
 
+bool runtime::cpu::CPU_ExternalFunction::is_cached(const Node* node) const
+{
+    if (!node->is_op())
+    {
+        return false;
+    }
+    auto op_annotations = static_cast<const ngraph::op::Op*>(node)->get_op_annotations();
+    return op_annotations && op_annotations->is_cacheable();
+}
+
 void runtime::cpu::CPU_ExternalFunction::propagate_in_place_input(
     ngraph::descriptor::Output* output, std::string input_name, bool dex)
 {
@@ -1298,6 +1329,12 @@ void runtime::cpu::CPU_ExternalFunction::process_in_place_concat(
                     for (auto arg : concat->get_arguments())
                     {
                         auto input_tensor = &arg->get_output_tensor();
+                        // An argument in the other pool is copied by the concat kernel
+                        if (is_cached(arg.get()) != is_cached(concat.get()))
+                        {
+                            offset += input_tensor->size();
+                            continue;
+                        }
                         auto old_offset = input_tensor->get_pool_offset();
                         input_tensor->set_pool_offset(offset);
                         NGRAPH_DEBUG << "cpu_external_function: change offset, old offset is "
@@ -1329,6 +1366,10 @@ void runtime::cpu::CPU_ExternalFunction::process_in_place_concat(
                         {
                             if (auto arg_concat = dynamic_pointer_cast<ngraph::op::Concat>(arg))
                             {
+                                if (is_cached(arg.get()) != is_cached(concat.get()))
+                                {
+                                    continue;
+                                }
                                 NGRAPH_DEBUG
                                     << "cpu_external_function: call propagate_in_place_concat for "
                                     << arg->get_name() << std::endl;
@@ -1362,6 +1403,11 @@ void runtime::cpu::CPU_ExternalFunction::propagate_in_place_concat(
                 for (auto arg : it->get_arguments())
                 {
                     auto input_tensor = &arg->get_output_tensor();
+                    if (is_cached(arg.get()) != is_cached(it.get()))
+                    {
+                        offset += input_tensor->size();
+                        continue;
+                    }
                     auto old_offset = input_tensor->get_pool_offset();
                     input_tensor->set_pool_offset(offset);
                     NGRAPH_DEBUG
@@ -1442,12 +1488,16 @@ void runtime::cpu::CPU_ExternalFunction::build()
     static const string s_debug_dir = "cpu_codegen";
     static StaticInitializers s_static_initializers(s_debug_dir);
     m_mkldnn_emitter.reset(new MKLDNNEmitter());
+    // TODO: The codegen cache (NGRAPH_CODEGEN_CACHE_DIR) only skips clang, DEX still runs
+    // every pass on each build. Caching the optimized graph needs a serialized form of the
+    // CPU fused ops and their layout annotations, which the serializer does not have yet.
     ngraph::pass::Manager pass_manager;
     register_common_passes(pass_manager);
     pass_manager.register_pass<ngraph::pass::Liveness>();
     pass_manager.register_pass<ngraph::pass::PropagateCacheability>(
         runtime::cpu::get_annotations_factory());
-    pass_manager.register_pass<ngraph::pass::MemoryLayout>(size_t(s_memory_pool_alignment), true);
+    pass_manager.register_pass<ngraph::pass::MemoryLayout>(
+        size_t(s_memory_pool_alignment), true, m_pack_memory, true);
     pass_manager.run_passes(m_function, false);
 
     // Store layouts assigned for arguments
@@ -1497,8 +1547,9 @@ void runtime::cpu::CPU_ExternalFunction::build()
         if (node->is_constant())
         {
             auto tv = node->get_outputs()[0].get_tensor_ptr();
-            tensor_data[tv->get_name()] =
-                const_cast<void*>(static_pointer_cast<ngraph::op::Constant>(node)->get_data_ptr());
+            constant_tensor_data.emplace_back(
+                get_raw_buffer_index(tv->get_name()),
+                const_cast<void*>(static_pointer_cast<ngraph::op::Constant>(node)->get_data_ptr()));
             m_tensor_roles[tv->get_name()] = CPUTensorRole::CONSTANT;
             propagate_in_place_constant(&node->get_outputs().at(0), tv->get_name(), true);
         }
@@ -1511,8 +1562,7 @@ void runtime::cpu::CPU_ExternalFunction::build()
         for (size_t i = 0; i < param->get_output_size(); ++i)
         {
             shared_ptr<descriptor::Tensor> tv = param->get_output_tensor_ptr(i);
-            function_input_index.emplace_back(
-                tensor_data[tv->get_name()], arg_index, tensor_stale[tv->get_name()]);
+            function_input_index.emplace_back(get_raw_buffer_index(tv->get_name()), arg_index);
             m_tensor_roles[tv->get_name()] = CPUTensorRole::INPUT;
             propagate_in_place_input(&param->get_outputs().at(i), tv->get_name(), true);
             arg_index++;
@@ -1529,11 +1579,15 @@ void runtime::cpu::CPU_ExternalFunction::build()
 
         for (auto& node : m_function->get_ordered_ops())
         {
+            if (is_cached(node.get()))
+            {
+                continue;
+            }
             for (auto tensor : node->liveness_new_list)
             {
                 if (m_tensor_roles.find(tensor->get_name()) == m_tensor_roles.end())
                 {
-                    intermediates_offsets.emplace_back(tensor_data[tensor->get_name()],
+                    intermediates_offsets.emplace_back(get_raw_buffer_index(tensor->get_name()),
                                                        tensor->get_pool_offset());
                     m_tensor_roles[tensor->get_name()] = CPUTensorRole::INTERMEDIATE;
                 }
@@ -1541,12 +1595,37 @@ void runtime::cpu::CPU_ExternalFunction::build()
         }
     }
 
+    // Intermediates computed by cacheable ops, which every runtime context keeps until its
+    // cache is invalidated
+    if (m_function->get_cache_pool_size())
+    {
+        m_cache_buffer_index = m_memory_buffer_sizes.size();
+        m_memory_buffer_sizes.push_back(m_function->get_cache_pool_size());
+
+        for (auto& node : m_function->get_ordered_ops())
+        {
+            if (!is_cached(node.get()))
+            {
+                continue;
+            }
+            for (auto tensor : node->liveness_new_list)
+            {
+                if (m_tensor_roles.find(tensor->get_name()) == m_tensor_roles.end())
+                {
+                    cache_offsets.emplace_back(get_raw_buffer_index(tensor->get_name()),
+                                               tensor->get_pool_offset());
+                    m_tensor_roles[tensor->get_name()] = CPUTensorRole::INTERMEDIATE;
+                }
+            }
+        }
+    }
+
     // Outputs
     for (size_t i = 0; i < m_function->get_output_size(); ++i)
     {
         shared_ptr<Node> op = m_function->get_output_op(i);
         shared_ptr<descriptor::Tensor> tv = op->get_output_tensor_ptr();
-        function_output_index.emplace_back(tensor_data[tv->get_name()], i);
+        function_output_index.emplace_back(get_raw_buffer_index(tv->get_name()), i);
         m_tensor_roles[tv->get_name()] = CPUTensorRole::OUTPUT;
 
         //keep assigning different outputs to a result descriptor
@@ -1558,7 +1637,7 @@ void runtime::cpu::CPU_ExternalFunction::build()
         {
             shared_ptr<descriptor::Tensor> itv =
                 res->get_inputs().at(0).get_output().get_tensor_ptr();
-            function_output_index.emplace_back(tensor_data[itv->get_name()], i);
+            function_output_index.emplace_back(get_raw_buffer_index(itv->get_name()), i);
             m_tensor_roles[itv->get_name()] = CPUTensorRole::OUTPUT;
             tensor_alias[itv->get_name()] = tv->get_name();
             propagate_in_place_output(
@@ -1566,6 +1645,7 @@ void runtime::cpu::CPU_ExternalFunction::build()
         }
     }
 
+    unordered_map<Node*, size_t> functor_indices;
     for (shared_ptr<Node> node : m_function->get_ordered_ops())
     {
         if (node->is_parameter() || node->is_constant())
@@ -1600,53 +1680,111 @@ void runtime::cpu::CPU_ExternalFunction::build()
 
         m_op_attrs.emplace_back(node->description(), out_names, in_names);
         op_names.push_back(node->get_name());
+
+        auto primitive_count = m_mkldnn_emitter->get_mkldnn_primitives().size();
+        auto state_count = m_states.size();
+#if defined(NGRAPH_HALIDE)
+        auto halide_function_count = halide_functions.size();
+#endif
         handler->second(this, node.get(), in, out);
 
-        bool disable_caching = computes_result(node.get()) || possibly_overwritten(node.get());
+        // Kernels that keep mutable state outside of the runtime context (MKLDNN
+        // primitives, RNG states, Halide image params) are shared by every context
+        // and must not run concurrently
+        bool shared_state = m_mkldnn_emitter->get_mkldnn_primitives().size() != primitive_count ||
+                            m_states.size() != state_count;
+#if defined(NGRAPH_HALIDE)
+        shared_state = shared_state || halide_functions.size() != halide_function_count;
+#endif
+        if (shared_state)
+        {
+            auto op_mutex = make_shared<mutex>();
+            auto op_functor = functors.back();
+            functors.back() = [op_mutex, op_functor](CPURuntimeContext* ctx,
+                                                     CPUExecutionContext* ectx) {
+                lock_guard<mutex> lock(*op_mutex);
+                op_functor(ctx, ectx);
+            };
+        }
 
-        vector<reference_wrapper<bool>> in_stale, out_stale;
-        for (const auto& name : in_names)
+        vector<size_t> dependencies;
+        for (auto& arg : node->get_arguments())
         {
-            if (tensor_alias.count(name))
+            if (!arg->is_parameter() && !arg->is_constant())
             {
-                in_stale.emplace_back(tensor_stale[tensor_alias[name]]);
+                dependencies.push_back(functor_indices.at(arg.get()));
             }
-            else
+        }
+        // A destructive in-place kernel overwrites its input, so it also has to wait for
+        // every other reader of that input
+        auto op_annotations = node->is_op()
+                                  ? static_pointer_cast<ngraph::op::Op>(node)->get_op_annotations()
+                                  : nullptr;
+        if (op_annotations)
+        {
+            for (auto oi_pair : op_annotations->get_in_place_oi_pairs())
             {
-                in_stale.emplace_back(tensor_stale[name]);
+                if (!oi_pair.destructive)
+                {
+                    continue;
+                }
+                for (descriptor::Input* reader :
+                     node->get_inputs().at(oi_pair.input).get_output().get_inputs())
+                {
+                    auto reader_index = functor_indices.find(reader->get_node().get());
+                    if (reader_index != functor_indices.end())
+                    {
+                        dependencies.push_back(reader_index->second);
+                    }
+                }
             }
         }
+        functor_indices[node.get()] = functor_dependencies.size();
+        functor_dependencies.push_back(dependencies);
+        functor_costs.push_back(estimate_op_cost(node.get()));
+
+        // Cached outputs have their own memory that nothing else writes to
+        bool cached = is_cached(node.get());
+        bool disable_caching =
+            computes_result(node.get()) ||
+            (!cached && (m_pack_memory || possibly_overwritten(node.get())));
+
+        vector<size_t> in_stale, out_stale;
+        for (const auto& name : in_names)
+        {
+            in_stale.emplace_back(get_buffer_index(name));
+        }
         for (const auto& name : out_names)
         {
-            out_stale.emplace_back(tensor_stale[name]);
+            out_stale.emplace_back(get_raw_buffer_index(name));
         }
 
         function<bool(CPURuntimeContext*)> enable;
         if (disable_caching)
         {
             enable = [in_stale, out_stale](CPURuntimeContext* ctx) -> bool {
-                for (auto& stale : out_stale)
+                for (auto index : out_stale)
                 {
-                    stale.get() = true;
+                    ctx->buffer_stale[index] = true;
                 }
                 return true;
             };
         }
         else
         {
-            enable = [in_stale, out_stale](CPURuntimeContext* ctx) -> bool {
-                bool en = false;
-                for (const auto& stale : in_stale)
+            enable = [in_stale, out_stale, cached](CPURuntimeContext* ctx) -> bool {
+                bool en = cached && ctx->cache_invalid;
+                for (auto index : in_stale)
                 {
-                    if (stale)
+                    if (ctx->buffer_stale[index])
                     {
                         en = true;
                         break;
                     }
                 }
-                for (auto& stale : out_stale)
+                for (auto index : out_stale)
                 {
-                    stale.get() = en;
+                    ctx->buffer_stale[index] = en;
                 }
                 return en;
             };
@@ -1657,6 +1795,8 @@ void runtime::cpu::CPU_ExternalFunction::build()
 
         m_perf_counters.emplace_back(node->get_name().c_str(), 0, 0);
     }
+    m_op_microseconds = vector<atomic<size_t>>(m_perf_counters.size());
+    m_op_call_counts = vector<atomic<size_t>>(m_perf_counters.size());
 
     if ((std::getenv("NGRAPH_DEX_DEBUG") != nullptr))
     {
@@ -1682,8 +1822,8 @@ void runtime::cpu::CPU_ExternalFunction::build()
         write_to_file(strm.str(), s_debug_dir, filename);
         strm.str("");
 
-        //dump the op's order of execution along with the address of
-        //tensor_data which holds the base address of each tensor.
+        //dump the op's order of execution along with the index of
+        //the buffer_data slot which holds the base address of each tensor.
         for (shared_ptr<Node> node : m_function->get_ordered_ops())
         {
             std::vector<string> node_inputs;
@@ -1697,7 +1837,7 @@ void runtime::cpu::CPU_ExternalFunction::build()
             {
                 const descriptor::Output& output = input.get_output();
                 shared_ptr<descriptor::Tensor> tv = output.get_tensor_ptr();
-                temp << &tensor_data[tv->get_name()];
+                temp << get_buffer_index(tv->get_name());
                 node_inputs.push_back(tv->get_name() + "(" + temp.str() + ")");
                 temp.str("");
             }
@@ -1705,7 +1845,7 @@ void runtime::cpu::CPU_ExternalFunction::build()
             for (const descriptor::Output& output : node->get_outputs())
             {
                 shared_ptr<descriptor::Tensor> tv = output.get_tensor_ptr();
-                temp << &tensor_data[tv->get_name()];
+                temp << get_buffer_index(tv->get_name());
                 node_outputs.push_back(tv->get_name() + "(" + temp.str() + ")");
                 temp.str("");
             }
@@ -1721,27 +1861,43 @@ void runtime::cpu::CPU_ExternalFunction::build()
     //This check ensures we have exactly one functor for Op.
     assert(m_op_attrs.size() == functors.size());
 
+    // Packed temporaries may reuse memory across independent branches, so those cannot overlap
+    m_schedule.reset(new CPUSchedule(
+        functor_dependencies,
+        functor_costs,
+        m_pack_memory ? 1 : executor::GetCPUExecutor().get_num_thread_pools()));
+
     executor = [&](CPURuntimeContext* ctx, vector<void*>& inputs, vector<void*>& outputs) {
-        cpu::Timestamp start_ts, end_ts;
         int profiler_count = 0;
 
         if (ctx->first_iteration)
         {
-            for (auto& p : intermediates_offsets)
+            for (const auto& p : constant_tensor_data)
+            {
+                ctx->buffer_data[p.first] = p.second;
+            }
+            for (const auto& p : intermediates_offsets)
             {
-                p.first.get() = static_cast<uint8_t*>(ctx->memory_buffers[0]->get_ptr()) + p.second;
+                ctx->buffer_data[p.first] =
+                    static_cast<uint8_t*>(ctx->memory_buffers[0]->get_ptr()) + p.second;
+            }
+            for (const auto& p : cache_offsets)
+            {
+                ctx->buffer_data[p.first] =
+                    static_cast<uint8_t*>(ctx->memory_buffers[m_cache_buffer_index]->get_ptr()) +
+                    p.second;
             }
         }
 
         for (const auto& p : function_input_index)
         {
-            get<0>(p).get() = inputs[get<1>(p)];
-            get<2>(p).get() = ctx->p_en[get<1>(p)];
+            ctx->buffer_data[p.first] = inputs[p.second];
+            ctx->buffer_stale[p.first] = ctx->p_en[p.second];
         }
 
         for (const auto& p : function_output_index)
         {
-            p.first.get() = outputs[p.second];
+            ctx->buffer_data[p.first] = outputs[p.second];
         }
 
         auto functor = functors.begin();
@@ -1750,8 +1906,7 @@ void runtime::cpu::CPU_ExternalFunction::build()
             // Build the flow graph
             if (ctx->first_iteration)
             {
-                std::unordered_map<std::string, tbb::flow::continue_node<tbb::flow::continue_msg>*>
-                    nodename_tbbnode_map;
+                std::vector<tbb::flow::continue_node<tbb::flow::continue_msg>*> flowgraph_nodes;
                 tbb::flow::continue_node<tbb::flow::continue_msg>* flowgraph_node_start =
                     new tbb::flow::continue_node<tbb::flow::continue_msg>(
                         *(ctx->G), [&](const tbb::flow::continue_msg& msg) {});
@@ -1761,14 +1916,18 @@ void runtime::cpu::CPU_ExternalFunction::build()
                     auto index = profiler_count++;
                     tbb::flow::continue_node<tbb::flow::continue_msg>* flowgraph_node =
                         new tbb::flow::continue_node<tbb::flow::continue_msg>(
-                            *(ctx->G), [&, functor, index](const tbb::flow::continue_msg& msg) {
+                            *(ctx->G),
+                            [&, ctx, functor, index](const tbb::flow::continue_msg& msg) {
+                                cpu::Timestamp start_ts, end_ts;
                                 if (p(ctx) || ctx->first_iteration)
                                 {
                                     if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
                                     {
                                         start_ts = cpu::Clock::now();
                                     }
-                                    CPUExecutionContext ectx{0};
+                                    // Keep each branch of the graph in its own arena
+                                    CPUExecutionContext ectx{
+                                        static_cast<int>(m_schedule->get_kernel_stream(index))};
                                     executor::GetCPUExecutor().execute(*functor, ctx, &ectx, true);
                                     if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
                                     {
@@ -1783,11 +1942,11 @@ void runtime::cpu::CPU_ExternalFunction::build()
                                         }
                                         if (m_emit_timing)
                                         {
-                                            m_perf_counters[index].m_total_microseconds +=
+                                            m_op_microseconds[index] +=
                                                 std::chrono::duration_cast<
                                                     std::chrono::microseconds>(end_ts - start_ts)
                                                     .count();
-                                            m_perf_counters[index].m_call_count++;
+                                            m_op_call_counts[index]++;
                                         }
                                     }
                                 }
@@ -1799,7 +1958,7 @@ void runtime::cpu::CPU_ExternalFunction::build()
                                     }
                                     if (m_emit_timing)
                                     {
-                                        m_perf_counters[index].m_call_count++;
+                                        m_op_call_counts[index]++;
                                     }
                                 }
                             });
@@ -1807,35 +1966,20 @@ void runtime::cpu::CPU_ExternalFunction::build()
                     flowgraph_node->set_name(it->second.c_str());
 #endif
                     std::advance(functor, 1);
-                    nodename_tbbnode_map.insert({it->second, flowgraph_node});
+                    flowgraph_nodes.push_back(flowgraph_node);
                     it++;
                 }
 
-                traverse_nodes(
-                    m_function, [&flowgraph_node_start, &nodename_tbbnode_map](shared_ptr<Node> n) {
-                        if (!n->is_parameter() && !n->is_constant())
-                        {
-                            bool is_head = true;
-                            for (auto arg : n->get_arguments())
-                            {
-                                if (!arg->is_parameter() && !arg->is_constant())
-                                {
-                                    is_head = false;
-                                    tbb::flow::make_edge(*(nodename_tbbnode_map[arg->get_name()]),
-                                                         *(nodename_tbbnode_map[n->get_name()]));
-                                }
-                            }
-                            if (is_head)
-                            {
-                                tbb::flow::make_edge(*flowgraph_node_start,
-                                                     *(nodename_tbbnode_map[n->get_name()]));
-                            }
-                        }
-                    });
-
-                if (m_release_function)
+                for (size_t i = 0; i < flowgraph_nodes.size(); i++)
                 {
-                    release_function();
+                    if (functor_dependencies[i].empty())
+                    {
+                        tbb::flow::make_edge(*flowgraph_node_start, *flowgraph_nodes[i]);
+                    }
+                    for (auto dependency : functor_dependencies[i])
+                    {
+                        tbb::flow::make_edge(*flowgraph_nodes[dependency], *flowgraph_nodes[i]);
+                    }
                 }
             }
             // Execute the flow graph
@@ -1867,18 +2011,76 @@ void runtime::cpu::CPU_ExternalFunction::build()
                         ss << op_names.at(i) << "will be executed with the following inputs:\n";
                         for (auto is : this->m_op_attrs.at(i).Inputs)
                         {
-                            ss << "\t" << is << " = " << this->get_tensor_data(is) << std::endl;
+                            ss << "\t" << is << " = "
+                               << ctx->buffer_data[this->get_buffer_index(is)] << std::endl;
                         }
                         ss << "and outputs :\n";
                         for (auto os : this->m_op_attrs.at(i).Outputs)
                         {
-                            ss << "\t" << os << " = " << this->get_tensor_data(os) << std::endl;
+                            ss << "\t" << os << " = "
+                               << ctx->buffer_data[this->get_buffer_index(os)] << std::endl;
                         }
                     }
                     write_to_file(ss.str(), s_debug_dir, filename);
                 }
             }
 
+            // Spread independent branches over the executor's thread pools, unless the
+            // debugger is stepping through the functors one by one
+            if (m_schedule->get_num_streams() > 1 && ctx->pc == 0 && ctx->breakpoints.empty())
+            {
+                auto run = [&](size_t index, size_t stream) {
+                    cpu::Timestamp op_start_ts, op_end_ts;
+                    if ((enables.at(index))(ctx) || ctx->first_iteration)
+                    {
+                        if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
+                        {
+                            op_start_ts = cpu::Clock::now();
+                        }
+                        CPUExecutionContext ectx{static_cast<int>(stream)};
+                        executor::GetCPUExecutor().execute(functors.at(index), ctx, &ectx);
+                        if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
+                        {
+                            op_end_ts = cpu::Clock::now();
+
+                            if (runtime::cpu::IsTracingEnabled())
+                            {
+                                ctx->op_durations[index] =
+                                    (std::chrono::duration_cast<cpu::Timescale>(op_end_ts -
+                                                                                op_start_ts))
+                                        .count();
+                            }
+                            if (m_emit_timing)
+                            {
+                                m_op_microseconds[index] +=
+                                    std::chrono::duration_cast<std::chrono::microseconds>(
+                                        op_end_ts - op_start_ts)
+                                        .count();
+                                m_op_call_counts[index]++;
+                            }
+                        }
+                    }
+                    else
+                    {
+                        if (runtime::cpu::IsTracingEnabled())
+                        {
+                            ctx->op_durations[index] = 0;
+                        }
+                        if (m_emit_timing)
+                        {
+                            m_op_call_counts[index]++;
+                        }
+                    }
+                };
+                auto spawn = [](size_t, function<void()> f) {
+                    executor::GetCPUExecutor().schedule(move(f));
+                };
+                m_schedule->execute(run, spawn);
+                profiler_count = static_cast<int>(functors.size());
+                ctx->pc = functors.size();
+            }
+
+            cpu::Timestamp start_ts, end_ts;
             for (; ctx->pc < functors.size(); ctx->pc++)
             {
                 auto index = profiler_count++;
@@ -1910,11 +2112,11 @@ void runtime::cpu::CPU_ExternalFunction::build()
                         }
                         if (m_emit_timing)
                         {
-                            m_perf_counters[index].m_total_microseconds +=
+                            m_op_microseconds[index] +=
                                 std::chrono::duration_cast<std::chrono::microseconds>(end_ts -
                                                                                       start_ts)
                                     .count();
-                            m_perf_counters[index].m_call_count++;
+                            m_op_call_counts[index]++;
                         }
                     }
                 }
@@ -1926,7 +2128,7 @@ void runtime::cpu::CPU_ExternalFunction::build()
                     }
                     if (m_emit_timing)
                     {
-                        m_perf_counters[index].m_call_count++;
+                        m_op_call_counts[index]++;
                     }
                 }
             }
@@ -1941,27 +2143,38 @@ void runtime::cpu::CPU_ExternalFunction::build()
 
     m_is_built = true;
 
-    if (m_release_function && !m_use_tbb)
+    if (m_release_function)
     {
         release_function();
     }
 }
 
-void*& runtime::cpu::CPU_ExternalFunction::get_tensor_data(const std::string& name)
+size_t runtime::cpu::CPU_ExternalFunction::get_buffer_index(const std::string& name)
 {
     if (tensor_alias.count(name))
     {
-        return tensor_data[tensor_alias[name]];
+        return get_raw_buffer_index(tensor_alias[name]);
     }
     else
     {
-        return tensor_data[name];
+        return get_raw_buffer_index(name);
+    }
+}
+
+size_t runtime::cpu::CPU_ExternalFunction::get_raw_buffer_index(const std::string& name)
+{
+    auto it = m_buffer_indices.find(name);
+    if (it == m_buffer_indices.end())
+    {
+        it = m_buffer_indices.emplace(name, m_buffer_indices.size()).first;
     }
+    return it->second;
 }
 
 shared_ptr<ngraph::runtime::cpu::CPU_CallFrame>
     runtime::cpu::CPU_ExternalFunction::make_call_frame()
 {
+    std::lock_guard<std::mutex> lock(m_build_mutex);
 #if !defined(NGRAPH_DEX_ONLY)
     if (!m_is_compiled && !m_direct_execution)
     {
@@ -1990,12 +2203,13 @@ const runtime::cpu::LayoutDescriptorPtrs&
     return result_layout_descriptors;
 }
 
-const vector<runtime::PerformanceCounter>& runtime::cpu::CPU_ExternalFunction::get_perf_counters()
+vector<runtime::PerformanceCounter> runtime::cpu::CPU_ExternalFunction::get_perf_counters()
 {
 #if !defined(NGRAPH_DEX_ONLY)
     // Codegen. Retrieve perf counters from compiled module
     if (m_execution_engine)
     {
+        vector<runtime::PerformanceCounter> rc;
         auto get_count = m_execution_engine->find_function<size_t()>("get_debug_timer_count");
         auto get_name =
             m_execution_engine->find_function<const char*(size_t)>("get_debug_timer_name");
@@ -2007,26 +2221,22 @@ const vector<runtime::PerformanceCounter>& runtime::cpu::CPU_ExternalFunction::g
         if (get_count && get_name && get_microseconds && get_call_count)
         {
             size_t count = get_count();
-            if (m_perf_counters.size() == 0)
-            {
-                for (size_t i = 0; i < count; i++)
-                {
-                    m_perf_counters.push_back(
-                        {get_name(i), get_microseconds(i), get_call_count(i)});
-                }
-            }
-            else
+            for (size_t i = 0; i < count; i++)
             {
-                for (size_t i = 0; i < count; i++)
-                {
-                    m_perf_counters[i].m_total_microseconds = get_microseconds(i);
-                    m_perf_counters[i].m_call_count = get_call_count(i);
-                }
+                rc.push_back({get_name(i), get_microseconds(i), get_call_count(i)});
             }
         }
+        return rc;
     }
 #endif
-    return m_perf_counters;
+    // DEX. Concurrent calls add to the atomic totals, so return a snapshot of them
+    vector<runtime::PerformanceCounter> rc = m_perf_counters;
+    for (size_t i = 0; i < rc.size(); i++)
+    {
+        rc[i].m_total_microseconds = m_op_microseconds[i];
+        rc[i].m_call_count = m_op_call_counts[i];
+    }
+    return rc;
 }
 
 void runtime::cpu::CPU_ExternalFunction::write_to_file(const std::string& code,
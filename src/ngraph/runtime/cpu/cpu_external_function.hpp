@@ -16,10 +16,12 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <typeindex>
 #include <typeinfo>
@@ -45,6 +47,7 @@
 #include "ngraph/pass/pass_config.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
+#include "ngraph/runtime/cpu/cpu_schedule.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view_wrapper.hpp"
 #include "ngraph/runtime/cpu/mkldnn_emitter.hpp"
 #include "ngraph/runtime/performance_counter.hpp"
@@ -126,13 +129,18 @@ namespace ngraph
                 }
 
                 const std::string& get_function_name() const { return m_function_name; }
+                /// \brief Held while a call writes the function's timeline file, so
+                ///        concurrent calls do not interleave their traces.
+                std::mutex& get_timeline_mutex() { return m_timeline_mutex; }
                 const std::shared_ptr<ngraph::Function> get_function() { return m_function; }
                 // Temporary Memory Pool alignment
                 static constexpr size_t s_memory_pool_alignment = 4096;
 
                 std::vector<CPUKernelFunctor>& get_functors() { return functors; }
-                std::unordered_map<std::string, void*>& get_tensor_data() { return tensor_data; }
-                void*& get_tensor_data(const std::string& name);
+                // Returns the slot in CPURuntimeContext::buffer_data that holds the
+                // base address of the named tensor, following in-place aliases
+                size_t get_buffer_index(const std::string& name);
+                size_t get_buffer_count() const { return m_buffer_indices.size(); }
                 std::function<void(CPURuntimeContext*, std::vector<void*>&, std::vector<void*>&)>&
                     get_executor()
                 {
@@ -148,7 +156,7 @@ namespace ngraph
                                    const std::string& directory,
                                    const std::string& filename);
 
-                const std::vector<PerformanceCounter>& get_perf_counters();
+                std::vector<PerformanceCounter> get_perf_counters();
 
 #if defined(NGRAPH_HALIDE)
                 std::unordered_map<std::string, Halide::Func>& get_halide_functions()
@@ -163,10 +171,9 @@ namespace ngraph
                 {
                     return subgraph_param_sizes;
                 }
-                std::unordered_map<std::string, std::reference_wrapper<void*>>&
-                    get_subgraph_param_ptrs()
+                std::unordered_map<std::string, size_t>& get_subgraph_param_indices()
                 {
-                    return subgraph_param_ptrs;
+                    return subgraph_param_indices;
                 }
 #endif
 
@@ -211,6 +218,9 @@ namespace ngraph
                 void process_in_place_slice(std::list<std::shared_ptr<Node>> nodes);
 
                 bool computes_result(Node* node);
+                // Outputs of cacheable ops are kept across calls in a pool of their own
+                bool is_cached(const Node* node) const;
+                size_t get_raw_buffer_index(const std::string& name);
                 void release_function() { m_function = nullptr; }
 #if !defined(NGRAPH_DEX_ONLY)
                 void emit_debug_function_entry(codegen::CodeWriter& writer,
@@ -249,6 +259,9 @@ namespace ngraph
                 bool m_emit_timing;
 
                 bool m_use_tbb;
+                // Temporaries share memory according to their lifetimes, so kernels run in
+                // order and never skip recomputing an output
+                bool m_pack_memory;
 #if !defined(NGRAPH_DEX_ONLY)
                 bool m_is_compiled;
 #endif
@@ -274,23 +287,35 @@ namespace ngraph
                     enable_nodename_list;
                 std::function<void(CPURuntimeContext*, std::vector<void*>&, std::vector<void*>&)>
                     executor;
-                std::unordered_map<std::string, void*> tensor_data;
-                std::unordered_map<std::string, bool> tensor_stale;
+                std::unordered_map<std::string, size_t> m_buffer_indices;
                 std::unordered_map<std::string, std::string> tensor_alias;
-                std::list<std::pair<std::reference_wrapper<void*>, size_t>> intermediates_offsets;
-                std::list<
-                    std::tuple<std::reference_wrapper<void*>, size_t, std::reference_wrapper<bool>>>
-                    function_input_index;
-                std::list<std::pair<std::reference_wrapper<void*>, size_t>> function_output_index;
+                std::list<std::pair<size_t, void*>> constant_tensor_data;
+                std::list<std::pair<size_t, size_t>> intermediates_offsets;
+                std::list<std::pair<size_t, size_t>> cache_offsets;
+                size_t m_cache_buffer_index;
+                std::list<std::pair<size_t, size_t>> function_input_index;
+                std::list<std::pair<size_t, size_t>> function_output_index;
+                // Indices of the functors each functor depends on; used to build
+                // the TBB flow graph of every runtime context and the inter-op schedule
+                std::vector<std::vector<size_t>> functor_dependencies;
+                std::vector<size_t> functor_costs;
+                std::unique_ptr<CPUSchedule> m_schedule;
                 std::unordered_map<std::string, std::shared_ptr<CPU_ExternalFunction>> callees;
                 bool m_is_built;
+                // Serializes compile/build when call frames are requested concurrently
+                std::mutex m_build_mutex;
+                std::mutex m_timeline_mutex;
+                // Name of every functor's op. The timings are kept apart in atomics because
+                // calls on different runtime contexts and streams update them concurrently.
                 std::vector<runtime::PerformanceCounter> m_perf_counters;
+                std::vector<std::atomic<size_t>> m_op_microseconds;
+                std::vector<std::atomic<size_t>> m_op_call_counts;
 
 #if defined(NGRAPH_HALIDE)
                 std::unordered_map<std::string, Halide::Func> halide_functions;
                 std::unordered_map<std::string, Halide::ImageParam> subgraph_params;
                 std::unordered_map<std::string, int> subgraph_param_sizes;
-                std::unordered_map<std::string, std::reference_wrapper<void*>> subgraph_param_ptrs;
+                std::unordered_map<std::string, size_t> subgraph_param_indices;
 #endif
             };
         }
@@ -217,6 +217,42 @@ namespace ngraph
                                           const Coordinate& upper_bounds,
                                           const Strides& slice_strides,
                                           int arena);
+
+                template <typename DATA, typename WEIGHTS, typename OUT>
+                void quantized_dot(void* data,
+                                   void* weights,
+                                   void* scale,
+                                   void* output,
+                                   size_t m,
+                                   size_t k,
+                                   size_t n,
+                                   int arena);
+
+                template <typename ElementType>
+                void layer_norm(void* input,
+                                void* gamma,
+                                void* beta,
+                                void* output,
+                                size_t rows,
+                                size_t width,
+                                double epsilon,
+                                int arena);
+
+                template <typename ElementType>
+                void gelu(void* input0, void* output, size_t count, int arena);
+
+                template <typename ElementType>
+                void scaled_dot_product_attention(void* query,
+                                                  void* key,
+                                                  void* value,
+                                                  void* output,
+                                                  size_t batches,
+                                                  size_t query_length,
+                                                  size_t key_length,
+                                                  size_t depth,
+                                                  size_t value_depth,
+                                                  double scale,
+                                                  int arena);
             }
         }
     }
@@ -63,12 +63,18 @@ namespace ngraph
                 bool first_iteration;
                 mkldnn::primitive* const* mkldnn_primitives;
                 std::vector<AlignedBuffer*> memory_buffers;
+                void** buffer_data;
+                bool* buffer_stale;
                 char* const* mkldnn_workspaces;
                 tbb::flow::graph* G;
                 tbb::global_control* c;
                 State* const* states;
                 std::set<size_t> breakpoints;
                 size_t pc;
+                // Set for a call when the call frame's cache was invalidated since this
+                // context last ran, so cached outputs are recomputed
+                bool cache_invalid;
+                size_t cache_generation;
 #ifdef NGRAPH_DISTRIBUTED
                 MLSL::Environment* mlsl_env;
                 MLSL::Distribution* mlsl_dist;
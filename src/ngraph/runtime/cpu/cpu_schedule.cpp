@@ -0,0 +1,287 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <queue>
+#include <string>
+
+#include "ngraph/except.hpp"
+#include "ngraph/node.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/runtime/cpu/cpu_schedule.hpp"
+#include "ngraph/shape.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Set while a thread is running one of the streams of a schedule
+static thread_local bool s_running_stream = false;
+
+runtime::cpu::CPUSchedule::CPUSchedule(const vector<vector<size_t>>& dependencies,
+                                       const vector<size_t>& costs,
+                                       size_t num_streams)
+    : m_waits(dependencies.size())
+    , m_kernel_streams(dependencies.size())
+    , m_signals(dependencies.size(), false)
+{
+    size_t n = dependencies.size();
+    if (costs.size() != n)
+    {
+        throw ngraph_error("CPUSchedule needs one cost per kernel");
+    }
+    num_streams = max<size_t>(1, min(num_streams, n));
+
+    vector<vector<size_t>> successors(n);
+    vector<size_t> pending(n);
+    for (size_t i = 0; i < n; i++)
+    {
+        for (size_t dependency : dependencies[i])
+        {
+            if (dependency >= i)
+            {
+                throw ngraph_error("CPUSchedule dependencies must precede their users");
+            }
+            successors[dependency].push_back(i);
+        }
+        pending[i] = dependencies[i].size();
+    }
+
+    // Longest cost-weighted path from each kernel to the end of the graph
+    vector<size_t> bottom_level(n);
+    for (size_t i = n; i-- > 0;)
+    {
+        size_t longest_successor = 0;
+        for (size_t successor : successors[i])
+        {
+            longest_successor = max(longest_successor, bottom_level[successor]);
+        }
+        bottom_level[i] = costs[i] + 1 + longest_successor;
+    }
+
+    // Ready kernels, most critical first; ties go to the earlier kernel
+    auto less_critical = [&bottom_level](size_t a, size_t b) {
+        return bottom_level[a] != bottom_level[b] ? bottom_level[a] < bottom_level[b] : a > b;
+    };
+    priority_queue<size_t, vector<size_t>, decltype(less_critical)> ready(less_critical);
+    for (size_t i = 0; i < n; i++)
+    {
+        if (pending[i] == 0)
+        {
+            ready.push(i);
+        }
+    }
+
+    vector<vector<size_t>> streams(num_streams);
+    vector<size_t> stream_free(num_streams, 0);
+    vector<size_t> finish(n, 0);
+    vector<size_t> stream_of(n, 0);
+    while (!ready.empty())
+    {
+        size_t kernel = ready.top();
+        ready.pop();
+
+        // Prefer the stream that produced the latest input, so chains stay on one stream
+        size_t data_ready = 0;
+        size_t preferred = 0;
+        for (size_t dependency : dependencies[kernel])
+        {
+            if (finish[dependency] > data_ready)
+            {
+                data_ready = finish[dependency];
+                preferred = stream_of[dependency];
+            }
+        }
+
+        size_t best = preferred;
+        size_t best_start = max(stream_free[preferred], data_ready);
+        for (size_t stream = 0; stream < num_streams; stream++)
+        {
+            size_t start = max(stream_free[stream], data_ready);
+            if (start < best_start)
+            {
+                best = stream;
+                best_start = start;
+            }
+        }
+
+        finish[kernel] = best_start + costs[kernel] + 1;
+        stream_free[best] = finish[kernel];
+        stream_of[kernel] = best;
+        streams[best].push_back(kernel);
+        m_order.push_back(kernel);
+
+        for (size_t successor : successors[kernel])
+        {
+            if (--pending[successor] == 0)
+            {
+                ready.push(successor);
+            }
+        }
+    }
+
+    // Drop streams that got no kernels, keeping stream 0 for the calling thread
+    vector<size_t> stream_index(num_streams);
+    for (size_t stream = 0; stream < num_streams; stream++)
+    {
+        if (!streams[stream].empty() || m_streams.empty())
+        {
+            stream_index[stream] = m_streams.size();
+            m_streams.push_back(move(streams[stream]));
+        }
+    }
+
+    for (size_t i = 0; i < n; i++)
+    {
+        m_kernel_streams[i] = stream_index[stream_of[i]];
+        for (size_t dependency : dependencies[i])
+        {
+            if (stream_index[stream_of[dependency]] != stream_index[stream_of[i]] &&
+                find(m_waits[i].begin(), m_waits[i].end(), dependency) == m_waits[i].end())
+            {
+                m_waits[i].push_back(dependency);
+                m_signals[dependency] = true;
+            }
+        }
+    }
+}
+
+void runtime::cpu::CPUSchedule::execute(const function<void(size_t, size_t)>& run,
+                                        const function<void(size_t, function<void()>)>& spawn)
+    const
+{
+    if (m_streams.size() == 1 || s_running_stream)
+    {
+        for (size_t kernel : m_order)
+        {
+            run(kernel, 0);
+        }
+        return;
+    }
+
+    struct ExecutionState
+    {
+        mutex lock;
+        condition_variable changed;
+        vector<bool> done;
+        size_t running_streams;
+        exception_ptr error;
+    } state;
+    state.done.resize(m_signals.size(), false);
+    state.running_streams = m_streams.size();
+
+    // Streams only ever wait on kernels that come earlier in the schedule order, so they
+    // cannot deadlock on each other.
+    auto run_stream = [this, &run, &state](size_t stream) {
+        bool was_running_stream = s_running_stream;
+        s_running_stream = true;
+        try
+        {
+            for (size_t kernel : m_streams[stream])
+            {
+                const vector<size_t>& waits = m_waits[kernel];
+                if (!waits.empty())
+                {
+                    unique_lock<mutex> lock(state.lock);
+                    state.changed.wait(lock, [&state, &waits]() {
+                        return state.error ||
+                               all_of(waits.begin(), waits.end(), [&state](size_t w) {
+                                   return state.done[w];
+                               });
+                    });
+                    if (state.error)
+                    {
+                        break;
+                    }
+                }
+
+                run(kernel, stream);
+
+                if (m_signals[kernel])
+                {
+                    lock_guard<mutex> lock(state.lock);
+                    state.done[kernel] = true;
+                    state.changed.notify_all();
+                }
+            }
+        }
+        catch (...)
+        {
+            lock_guard<mutex> lock(state.lock);
+            if (!state.error)
+            {
+                state.error = current_exception();
+            }
+        }
+        s_running_stream = was_running_stream;
+
+        // Notify while holding the lock; once it is released the caller may return and
+        // destroy the state.
+        lock_guard<mutex> lock(state.lock);
+        state.running_streams--;
+        state.changed.notify_all();
+    };
+
+    for (size_t stream = 1; stream < m_streams.size(); stream++)
+    {
+        spawn(stream, [run_stream, stream]() { run_stream(stream); });
+    }
+    run_stream(0);
+
+    unique_lock<mutex> lock(state.lock);
+    state.changed.wait(lock, [&state]() { return state.running_streams == 0; });
+    if (state.error)
+    {
+        rethrow_exception(state.error);
+    }
+}
+
+size_t runtime::cpu::estimate_op_cost(const Node* node)
+{
+    size_t cost = 0;
+    for (size_t i = 0; i < node->get_input_size(); i++)
+    {
+        cost += shape_size(node->get_input_shape(i));
+    }
+    for (size_t i = 0; i < node->get_output_size(); i++)
+    {
+        cost += shape_size(node->get_output_shape(i));
+    }
+
+    // Forward convolutions (including the fused CPU variants) take filters as their second
+    // argument, laid out output channels first
+    const string& name = node->description();
+    if (name.compare(0, 11, "Convolution") == 0 && name.find("Backprop") == string::npos &&
+        node->get_input_size() >= 2 && node->get_output_size() >= 1)
+    {
+        const Shape& filters_shape = node->get_input_shape(1);
+        if (filters_shape.size() >= 3 && filters_shape[0] != 0)
+        {
+            cost += shape_size(node->get_output_shape(0)) * shape_size(filters_shape) /
+                    filters_shape[0];
+        }
+    }
+    else if (auto dot = dynamic_cast<const op::Dot*>(node))
+    {
+        const Shape& arg1_shape = node->get_input_shape(1);
+        size_t reduction_size = shape_size(
+            Shape(arg1_shape.begin(), arg1_shape.begin() + dot->get_reduction_axes_count()));
+        cost += shape_size(node->get_output_shape(0)) * reduction_size;
+    }
+    return cost;
+}
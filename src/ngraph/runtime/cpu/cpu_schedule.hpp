@@ -0,0 +1,90 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace ngraph
+{
+    class Node;
+
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief Static assignment of a function's kernels to inter-op streams.
+            ///
+            /// Kernels are list scheduled at compile time: whenever a kernel becomes ready, the
+            /// one with the longest cost-weighted path to the end of the graph is placed on the
+            /// stream where it can start earliest. Each stream runs its kernels in order on its
+            /// own thread pool, and only waits on kernels that were placed on other streams.
+            class CPUSchedule
+            {
+            public:
+                /// \param dependencies For each kernel, the kernels it must run after. Every
+                ///        dependency must have a smaller index than the kernel itself.
+                /// \param costs Estimated relative cost of each kernel.
+                /// \param num_streams Maximum number of streams to spread the kernels over.
+                CPUSchedule(const std::vector<std::vector<size_t>>& dependencies,
+                            const std::vector<size_t>& costs,
+                            size_t num_streams);
+
+                size_t get_num_streams() const { return m_streams.size(); }
+                /// \brief The kernels of `stream`, in the order that stream runs them.
+                const std::vector<size_t>& get_stream(size_t stream) const
+                {
+                    return m_streams.at(stream);
+                }
+                /// \brief The kernels on other streams that `kernel` has to wait for.
+                const std::vector<size_t>& get_waits(size_t kernel) const
+                {
+                    return m_waits.at(kernel);
+                }
+                /// \brief The stream `kernel` was placed on.
+                size_t get_kernel_stream(size_t kernel) const
+                {
+                    return m_kernel_streams.at(kernel);
+                }
+
+                /// \brief Runs every kernel by calling `run(kernel, stream)`. Stream 0 runs on the
+                ///        calling thread and every other stream is handed to `spawn`, which must
+                ///        start it on another thread without waiting for unrelated work, since
+                ///        the streams wait on each other. Returns once all streams have finished
+                ///        and rethrows the first exception thrown by `run`.
+                ///
+                /// If called from a thread that is itself running a stream, the kernels run
+                /// sequentially on that thread so nested functions cannot starve the workers.
+                void execute(const std::function<void(size_t, size_t)>& run,
+                             const std::function<void(size_t, std::function<void()>)>& spawn)
+                    const;
+
+            private:
+                std::vector<std::vector<size_t>> m_streams;
+                std::vector<std::vector<size_t>> m_waits;
+                std::vector<size_t> m_kernel_streams;
+                std::vector<bool> m_signals;
+                std::vector<size_t> m_order;
+            };
+
+            /// \brief Rough relative cost of running the kernel for `node`: the number of
+            ///        elements it touches, plus multiply-adds for convolutions and dots.
+            size_t estimate_op_cost(const Node* node);
+        }
+    }
+}
@@ -15,7 +15,9 @@
 //*****************************************************************************
 
 #include <cstring>
+#include <list>
 #include <memory>
+#include <mutex>
 
 #include "cpu_tensor_view.hpp"
 #include "ngraph/descriptor/layout/tensor_layout.hpp"
@@ -32,6 +34,96 @@ using namespace std;
 // TODO(jmenon): Refactor all the alignment specifications into
 // a single place and allow lower or no alignment when possible
 
+namespace
+{
+    // Building a reorder primitive costs far more than running it on a small tensor, so
+    // one is kept per (source, destination) layout pair and rebound to the buffers of
+    // each conversion
+    struct CachedReorder
+    {
+        CachedReorder(const memory::desc& input_desc, const memory::desc& output_desc)
+            : input({input_desc, runtime::cpu::executor::global_cpu_engine}, nullptr)
+            , output({output_desc, runtime::cpu::executor::global_cpu_engine}, nullptr)
+            , primitive(input, output)
+            , input_desc(input_desc)
+            , output_desc(output_desc)
+        {
+        }
+
+        memory input;
+        memory output;
+        reorder primitive;
+        memory::desc input_desc;
+        memory::desc output_desc;
+        std::mutex mutex;
+    };
+
+    const size_t s_max_cached_reorders = 64;
+
+    struct ReorderCache
+    {
+        std::mutex mutex;
+        list<shared_ptr<CachedReorder>> reorders;
+        size_t hits = 0;
+        size_t misses = 0;
+    };
+
+    // The cached primitives are bound to global_cpu_engine, whose destruction is unordered
+    // with respect to other globals, so the cache is deliberately never destroyed
+    ReorderCache& get_reorder_cache()
+    {
+        static ReorderCache* cache = new ReorderCache;
+        return *cache;
+    }
+
+    shared_ptr<CachedReorder> get_reorder(const memory::desc& input_desc,
+                                          const memory::desc& output_desc)
+    {
+        ReorderCache& cache = get_reorder_cache();
+        lock_guard<mutex> lock(cache.mutex);
+        for (auto it = cache.reorders.begin(); it != cache.reorders.end(); ++it)
+        {
+            if (runtime::cpu::mkldnn_utils::compare_mkldnn_mds((*it)->input_desc, input_desc) &&
+                runtime::cpu::mkldnn_utils::compare_mkldnn_mds((*it)->output_desc, output_desc))
+            {
+                cache.hits++;
+                cache.reorders.splice(cache.reorders.begin(), cache.reorders, it);
+                return cache.reorders.front();
+            }
+        }
+
+        cache.misses++;
+        cache.reorders.push_front(make_shared<CachedReorder>(input_desc, output_desc));
+        if (cache.reorders.size() > s_max_cached_reorders)
+        {
+            cache.reorders.pop_back();
+        }
+        return cache.reorders.front();
+    }
+
+    char* allocate_aligned(size_t size, char*& buffer)
+    {
+        size_t allocation_size = size + runtime::cpu::CPUTensorView::BufferAlignment;
+        auto ptr = malloc(allocation_size);
+        if (!ptr)
+        {
+            throw ngraph_error("Error allocating CPU Tensor View memory");
+        }
+        buffer = static_cast<char*>(ptr);
+
+// GCC major versions below 5 do not implement C++11 std::align
+#if !defined(__GNUC__) || __GNUC__ >= 5
+        std::align(runtime::cpu::CPUTensorView::BufferAlignment, size, ptr, allocation_size);
+#else
+        ptr = static_cast<char*>(ptr) + (runtime::cpu::CPUTensorView::BufferAlignment - 1);
+        ptr = reinterpret_cast<void*>(
+            reinterpret_cast<uintptr_t>(ptr) &
+            ~(uintptr_t(runtime::cpu::CPUTensorView::BufferAlignment - 1)));
+#endif
+        return static_cast<char*>(ptr);
+    }
+}
+
 runtime::cpu::CPUTensorView::CPUTensorView(const ngraph::element::Type& element_type,
                                            const Shape& shape,
                                            void* memory_pointer,
@@ -54,24 +146,7 @@ runtime::cpu::CPUTensorView::CPUTensorView(const ngraph::element::Type& element_
     }
     else if (buffer_size > 0)
     {
-        size_t allocation_size = buffer_size + BufferAlignment;
-        auto ptr = malloc(allocation_size);
-        if (!ptr)
-        {
-            throw ngraph_error("Error allocating CPU Tensor View memory");
-        }
-        buffer = static_cast<char*>(ptr);
-
-// GCC major versions below 5 do not implement C++11 std::align
-#if !defined(__GNUC__) || __GNUC__ >= 5
-        std::align(BufferAlignment, buffer_size, ptr, allocation_size);
-#else
-        ptr = static_cast<char*>(ptr) + (BufferAlignment - 1);
-        ptr = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(ptr) &
-                                      ~(uintptr_t(BufferAlignment - 1)));
-#endif
-
-        aligned_buffer = static_cast<char*>(ptr);
+        aligned_buffer = allocate_aligned(buffer_size, buffer);
     }
 }
 
@@ -103,6 +178,7 @@ void runtime::cpu::CPUTensorView::write(const void* source, size_t tensor_offset
     {
         throw out_of_range("write access past end of tensor");
     }
+    lock_guard<mutex> lock(m_layout_mutex);
     char* target = get_data_ptr();
     memcpy(&target[tensor_offset], source, n);
 }
@@ -114,47 +190,105 @@ void runtime::cpu::CPUTensorView::read(void* target, size_t tensor_offset, size_
         throw out_of_range("read access past end of tensor");
     }
 
-    auto tvl = this->get_tensor_layout();
-    auto cpu_tvl = dynamic_cast<runtime::cpu::LayoutDescriptor*>(tvl.get());
-
-    auto needs_conversion = [&]() {
-        if (!cpu_tvl)
-        {
-            return false;
-        }
-        if (!cpu_tvl->is_mkldnn_layout())
-        {
-            return false;
-        }
-        if (cpu_tvl->get_size() <= 1)
-        {
-            return false;
-        }
-        auto native_md = mkldnn_utils::create_blocked_mkldnn_md(
-            this->get_shape(), cpu_tvl->get_strides(), this->get_element_type());
-        if (mkldnn_utils::compare_mkldnn_mds(cpu_tvl->get_mkldnn_md(), native_md))
+    lock_guard<mutex> lock(m_layout_mutex);
+    if (needs_layout_conversion())
+    {
+        if (tensor_offset == 0 && n == buffer_size)
         {
-            return false;
+            convert_layout(target);
+            return;
         }
-        return true;
-    };
+        // Convert once for all partial reads instead of reordering the whole tensor for
+        // each of them. The contents are unchanged, only their layout.
+        const_cast<CPUTensorView*>(this)->convert_to_native_layout();
+    }
+    const char* source = get_data_ptr();
+    memcpy(target, &source[tensor_offset], n);
+}
 
-    if (needs_conversion())
+const void* runtime::cpu::CPUTensorView::get_native_data_ptr()
+{
+    lock_guard<mutex> lock(m_layout_mutex);
+    if (needs_layout_conversion())
     {
-        auto tensor_shape = this->get_shape();
-        auto input_desc = cpu_tvl->get_mkldnn_md();
-        auto output_desc = mkldnn_utils::create_blocked_mkldnn_md(
-            this->get_shape(), cpu_tvl->get_strides(), this->get_element_type());
+        convert_to_native_layout();
+    }
+    return aligned_buffer;
+}
 
-        memory input{{input_desc, executor::global_cpu_engine}, aligned_buffer};
-        memory output{{output_desc, executor::global_cpu_engine}, target};
-        reorder prim{input, output};
-        mkldnn::stream s(mkldnn::stream::kind::eager);
-        s.submit({prim}).wait();
+void runtime::cpu::CPUTensorView::convert_to_native_layout()
+{
+    char* converted_buffer;
+    char* converted = allocate_aligned(buffer_size, converted_buffer);
+    convert_layout(converted);
+    if (buffer)
+    {
+        // We own the storage, so the converted copy simply replaces it
+        free(buffer);
+        buffer = converted_buffer;
+        aligned_buffer = converted;
     }
     else
     {
-        const char* source = get_data_ptr();
-        memcpy(target, &source[tensor_offset], n);
+        memcpy(aligned_buffer, converted, buffer_size);
+        free(converted_buffer);
     }
+    m_descriptor->set_tensor_layout(
+        std::make_shared<runtime::cpu::LayoutDescriptor>(*m_descriptor));
+}
+
+size_t runtime::cpu::CPUTensorView::get_reorder_cache_hits()
+{
+    ReorderCache& cache = get_reorder_cache();
+    lock_guard<mutex> lock(cache.mutex);
+    return cache.hits;
+}
+
+size_t runtime::cpu::CPUTensorView::get_reorder_cache_misses()
+{
+    ReorderCache& cache = get_reorder_cache();
+    lock_guard<mutex> lock(cache.mutex);
+    return cache.misses;
+}
+
+bool runtime::cpu::CPUTensorView::needs_layout_conversion() const
+{
+    auto tvl = this->get_tensor_layout();
+    auto cpu_tvl = dynamic_cast<runtime::cpu::LayoutDescriptor*>(tvl.get());
+
+    if (!cpu_tvl)
+    {
+        return false;
+    }
+    if (!cpu_tvl->is_mkldnn_layout())
+    {
+        return false;
+    }
+    if (cpu_tvl->get_size() <= 1)
+    {
+        return false;
+    }
+    auto native_md = mkldnn_utils::create_blocked_mkldnn_md(
+        this->get_shape(), cpu_tvl->get_strides(), this->get_element_type());
+    if (mkldnn_utils::compare_mkldnn_mds(cpu_tvl->get_mkldnn_md(), native_md))
+    {
+        return false;
+    }
+    return true;
+}
+
+void runtime::cpu::CPUTensorView::convert_layout(void* target) const
+{
+    auto tvl = this->get_tensor_layout();
+    auto cpu_tvl = static_cast<runtime::cpu::LayoutDescriptor*>(tvl.get());
+    auto input_desc = cpu_tvl->get_mkldnn_md();
+    auto output_desc = mkldnn_utils::create_blocked_mkldnn_md(
+        this->get_shape(), cpu_tvl->get_strides(), this->get_element_type());
+
+    auto cached = get_reorder(input_desc, output_desc);
+    lock_guard<mutex> lock(cached->mutex);
+    cached->input.set_data_handle(aligned_buffer);
+    cached->output.set_data_handle(target);
+    mkldnn::stream s(mkldnn::stream::kind::eager);
+    s.submit({cached->primitive}).wait();
 }
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <mutex>
 #include <string>
 
 #include "ngraph/runtime/tensor.hpp"
@@ -57,6 +58,22 @@ namespace ngraph
                 /// \param n Number of bytes to read, must be integral number of elements.
                 void read(void* p, size_t tensor_offset, size_t n) const override;
 
+                /// \brief Returns the tensor data in its native (row-major) layout without a copy
+                ///
+                /// A tensor that holds an MKLDNN blocked layout, e.g. a result of a call, is
+                /// converted in place once. Later calls and reads are free until a call
+                /// writes the tensor again, which also invalidates the returned pointer.
+                /// A partial read() converts the tensor the same way.
+                ///
+                /// Safe to call concurrently with read() and write(), but not with a call
+                /// that writes the tensor.
+                const void* get_native_data_ptr();
+
+                /// \brief Number of layout conversions that reused a cached reorder primitive
+                static size_t get_reorder_cache_hits();
+                /// \brief Number of layout conversions that had to build a reorder primitive
+                static size_t get_reorder_cache_misses();
+
                 static constexpr int BufferAlignment = NGRAPH_CPU_ALIGNMENT;
 
             private:
@@ -64,9 +81,15 @@ namespace ngraph
                 CPUTensorView(CPUTensorView&&) = delete;
                 CPUTensorView& operator=(const CPUTensorView&) = delete;
 
+                bool needs_layout_conversion() const;
+                void convert_layout(void* target) const;
+                void convert_to_native_layout();
+
                 char* buffer;
                 char* aligned_buffer;
                 size_t buffer_size;
+                // Serializes the in-place layout conversion with reads and writes
+                mutable std::mutex m_layout_mutex;
             };
         }
     }
@@ -0,0 +1,115 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// \brief Scaled dot-product attention over `batches` independent problems.
+                ///
+                /// Tasks own whole query rows: a row of scores is computed, turned into
+                /// probabilities and applied to the values while it is still in cache, so the
+                /// [Lq, Lk] score matrix is never written to memory.
+                template <typename ElementType>
+                void scaled_dot_product_attention(void* query,
+                                                  void* key,
+                                                  void* value,
+                                                  void* output,
+                                                  size_t batches,
+                                                  size_t query_length,
+                                                  size_t key_length,
+                                                  size_t depth,
+                                                  size_t value_depth,
+                                                  double scale,
+                                                  int arena)
+                {
+                    auto q = static_cast<const ElementType*>(query);
+                    auto k = static_cast<const ElementType*>(key);
+                    auto v = static_cast<const ElementType*>(value);
+                    auto out = static_cast<ElementType*>(output);
+                    const ElementType s = static_cast<ElementType>(scale);
+
+                    auto attend = [&](Eigen::Index first, Eigen::Index last) {
+                        std::vector<ElementType> scores(key_length);
+                        for (Eigen::Index row = first; row < last; row++)
+                        {
+                            size_t batch = row / query_length;
+                            const ElementType* q_row = q + row * depth;
+                            const ElementType* k_batch = k + batch * key_length * depth;
+                            const ElementType* v_batch = v + batch * key_length * value_depth;
+                            ElementType* out_row = out + row * value_depth;
+
+                            ElementType max_score = std::numeric_limits<ElementType>::lowest();
+                            for (size_t j = 0; j < key_length; j++)
+                            {
+                                const ElementType* k_row = k_batch + j * depth;
+                                ElementType dot = 0;
+                                for (size_t d = 0; d < depth; d++)
+                                {
+                                    dot += q_row[d] * k_row[d];
+                                }
+                                scores[j] = dot * s;
+                                max_score = std::max(max_score, scores[j]);
+                            }
+
+                            ElementType sum = 0;
+                            for (size_t j = 0; j < key_length; j++)
+                            {
+                                scores[j] = std::exp(scores[j] - max_score);
+                                sum += scores[j];
+                            }
+
+                            std::fill(out_row, out_row + value_depth, ElementType(0));
+                            ElementType inv_sum = 1 / sum;
+                            for (size_t j = 0; j < key_length; j++)
+                            {
+                                ElementType p = scores[j] * inv_sum;
+                                const ElementType* v_row = v_batch + j * value_depth;
+                                for (size_t d = 0; d < value_depth; d++)
+                                {
+                                    out_row[d] += p * v_row[d];
+                                }
+                            }
+                        }
+                    };
+
+                    Eigen::TensorOpCost cost(
+                        key_length * (depth + value_depth) * sizeof(ElementType),
+                        value_depth * sizeof(ElementType),
+                        key_length * (2 * depth + 2 * value_depth + 10));
+                    executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        batches * query_length, cost, attend);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,101 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Rows looked up ahead of the one being copied
+                constexpr size_t embedding_prefetch_distance = 4;
+                // Leading bytes of a row to prefetch; the hardware prefetcher follows the rest
+                constexpr size_t embedding_prefetch_bytes = 512;
+
+                /// \brief Gathers rows of `row_bytes` bytes from a [vocab_size, ...] table.
+                ///        Rows of indices outside [0, vocab_size), including NaN, are zeroed.
+                template <typename IndexType>
+                void embedding_lookup(void* indices,
+                                      void* weights,
+                                      void* out,
+                                      size_t indices_count,
+                                      size_t vocab_size,
+                                      size_t row_bytes,
+                                      int arena)
+                {
+                    auto index_data = static_cast<const IndexType*>(indices);
+                    auto weight_data = static_cast<const char*>(weights);
+                    auto out_data = static_cast<char*>(out);
+
+                    auto row = [=](size_t i) -> const char* {
+                        auto index = index_data[i];
+                        if (!(index >= 0 &&
+                              static_cast<double>(index) < static_cast<double>(vocab_size)))
+                        {
+                            return nullptr;
+                        }
+                        return weight_data + static_cast<size_t>(index) * row_bytes;
+                    };
+
+                    auto lookup = [&](Eigen::Index first, Eigen::Index last) {
+                        size_t end = static_cast<size_t>(last);
+                        for (size_t i = static_cast<size_t>(first); i < end; i++)
+                        {
+                            if (i + embedding_prefetch_distance < end)
+                            {
+                                if (auto ahead = row(i + embedding_prefetch_distance))
+                                {
+                                    size_t prefetch_bytes =
+                                        std::min(row_bytes, embedding_prefetch_bytes);
+                                    for (size_t offset = 0; offset < prefetch_bytes; offset += 64)
+                                    {
+                                        __builtin_prefetch(ahead + offset, 0, 0);
+                                    }
+                                }
+                            }
+
+                            char* dst = out_data + i * row_bytes;
+                            if (auto src = row(i))
+                            {
+                                memcpy(dst, src, row_bytes);
+                            }
+                            else
+                            {
+                                memset(dst, 0, row_bytes);
+                            }
+                        }
+                    };
+
+                    Eigen::TensorOpCost cost(row_bytes, row_bytes, 0);
+                    ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        indices_count, cost, lookup);
+                }
+            }
+        }
+    }
+}
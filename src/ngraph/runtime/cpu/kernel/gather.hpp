@@ -0,0 +1,112 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstring>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// \brief Gathers slices of a [outer, axis_len, inner] tensor along its middle
+                ///        axis into a [outer, indices_count, inner] output.
+                ///
+                ///        Every output slice is an independent copy of `inner` elements, so the
+                ///        slices are split evenly across threads. Slices for indices outside
+                ///        [0, axis_len) are zero.
+                template <typename ElementType, typename IndexType>
+                void gather(void* data,
+                            void* indices,
+                            void* out,
+                            size_t indices_count,
+                            size_t outer,
+                            size_t axis_len,
+                            size_t inner,
+                            int arena)
+                {
+                    auto data_ptr = static_cast<const ElementType*>(data);
+                    auto index_data = static_cast<const IndexType*>(indices);
+                    auto out_data = static_cast<ElementType*>(out);
+
+                    auto copy_slices = [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index s = first; s < last; s++)
+                        {
+                            size_t o = static_cast<size_t>(s) / indices_count;
+                            IndexType index = index_data[static_cast<size_t>(s) % indices_count];
+                            ElementType* out_slice = out_data + static_cast<size_t>(s) * inner;
+                            if (index >= 0 && static_cast<size_t>(index) < axis_len)
+                            {
+                                memcpy(out_slice,
+                                       data_ptr +
+                                           (o * axis_len + static_cast<size_t>(index)) * inner,
+                                       inner * sizeof(ElementType));
+                            }
+                            else
+                            {
+                                memset(out_slice, 0, inner * sizeof(ElementType));
+                            }
+                        }
+                    };
+
+                    Eigen::TensorOpCost cost(inner * sizeof(ElementType) + sizeof(IndexType),
+                                             inner * sizeof(ElementType),
+                                             1);
+                    ngraph::runtime::cpu::executor::GetCPUExecutor()
+                        .get_device(arena)
+                        .parallelFor(outer * indices_count, cost, copy_slices);
+                }
+
+                template <typename ElementType>
+                void gather_i32(void* data,
+                                void* indices,
+                                void* out,
+                                size_t indices_count,
+                                size_t outer,
+                                size_t axis_len,
+                                size_t inner,
+                                int arena)
+                {
+                    gather<ElementType, int32_t>(
+                        data, indices, out, indices_count, outer, axis_len, inner, arena);
+                }
+
+                template <typename ElementType>
+                void gather_i64(void* data,
+                                void* indices,
+                                void* out,
+                                size_t indices_count,
+                                size_t outer,
+                                size_t axis_len,
+                                size_t inner,
+                                int arena)
+                {
+                    gather<ElementType, int64_t>(
+                        data, indices, out, indices_count, outer, axis_len, inner, arena);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,90 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// \brief Normalizes `rows` rows of `width` elements each. A task handles whole
+                ///        rows, so the statistics of a row are computed while it is in cache and
+                ///        no intermediate tensor is written.
+                template <typename ElementType>
+                void layer_norm(void* input,
+                                void* gamma,
+                                void* beta,
+                                void* output,
+                                size_t rows,
+                                size_t width,
+                                double epsilon,
+                                int arena)
+                {
+                    auto in = static_cast<const ElementType*>(input);
+                    auto g = static_cast<const ElementType*>(gamma);
+                    auto b = static_cast<const ElementType*>(beta);
+                    auto out = static_cast<ElementType*>(output);
+
+                    auto normalize_rows = [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index r = first; r < last; r++)
+                        {
+                            const ElementType* x = in + r * width;
+                            ElementType* y = out + r * width;
+
+                            ElementType sum = 0;
+                            for (size_t i = 0; i < width; i++)
+                            {
+                                sum += x[i];
+                            }
+                            ElementType mean = sum / width;
+
+                            ElementType square_sum = 0;
+                            for (size_t i = 0; i < width; i++)
+                            {
+                                ElementType d = x[i] - mean;
+                                square_sum += d * d;
+                            }
+                            ElementType inv_std = 1 / std::sqrt(square_sum / width +
+                                                                static_cast<ElementType>(epsilon));
+
+                            for (size_t i = 0; i < width; i++)
+                            {
+                                y[i] = (x[i] - mean) * inv_std * g[i] + b[i];
+                            }
+                        }
+                    };
+
+                    Eigen::TensorOpCost cost(
+                        width * sizeof(ElementType), width * sizeof(ElementType), 8 * width);
+                    executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        rows, cost, normalize_rows);
+                }
+            }
+        }
+    }
+}
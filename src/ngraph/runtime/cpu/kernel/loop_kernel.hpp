@@ -0,0 +1,255 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                namespace loop
+                {
+                    enum class Opcode
+                    {
+                        // register dst = input arg0
+                        Load,
+                        // register dst = input arg0 (a single element) repeated
+                        Splat,
+                        // element i of register dst = element i % arg1 of input arg0
+                        Tile,
+                        // element i of register dst = element i / arg1 of input arg0
+                        Repeat,
+                        // output dst = register arg0
+                        Store,
+                        Add,
+                        Subtract,
+                        Multiply,
+                        Divide,
+                        Minimum,
+                        Maximum,
+                        Negative,
+                        Abs,
+                        Relu
+                    };
+
+                    struct Instruction
+                    {
+                        Opcode opcode;
+                        size_t dst;
+                        size_t arg0;
+                        size_t arg1;
+                    };
+
+                    /// \brief A fused elementwise computation. Every register holds one block
+                    ///        of elements, so each instruction is a short loop the compiler
+                    ///        can vectorise, and intermediate values never leave the cache.
+                    struct Program
+                    {
+                        std::vector<Instruction> instructions;
+                        size_t num_registers;
+                    };
+
+                    // Elements per register; small enough that all registers of a typical
+                    // kernel stay in L1
+                    constexpr size_t block_size = 512;
+
+                    template <typename T>
+                    typename std::enable_if<std::is_unsigned<T>::value, T>::type abs(T x)
+                    {
+                        return x;
+                    }
+
+                    template <typename T>
+                    typename std::enable_if<!std::is_unsigned<T>::value, T>::type abs(T x)
+                    {
+                        return x < 0 ? -x : x;
+                    }
+                }
+
+                template <typename ElementType>
+                void loop_kernel(const loop::Program& program,
+                                 void* const* inputs,
+                                 void* const* outputs,
+                                 size_t count,
+                                 int arena)
+                {
+                    using loop::Opcode;
+                    const size_t block_size = loop::block_size;
+                    size_t num_blocks = (count + block_size - 1) / block_size;
+
+                    auto run_blocks = [&](Eigen::Index first_block, Eigen::Index last_block) {
+                        std::vector<ElementType> scratch(program.num_registers * block_size);
+                        // Loaded registers point straight into their input
+                        std::vector<const ElementType*> registers(program.num_registers);
+
+                        for (Eigen::Index block = first_block; block < last_block; block++)
+                        {
+                            size_t begin = block * block_size;
+                            size_t n = std::min(block_size, count - begin);
+
+                            for (const loop::Instruction& instruction :
+                                 program.instructions)
+                            {
+                                if (instruction.opcode == Opcode::Load)
+                                {
+                                    registers[instruction.dst] =
+                                        static_cast<const ElementType*>(inputs[instruction.arg0]) +
+                                        begin;
+                                    continue;
+                                }
+                                if (instruction.opcode == Opcode::Store)
+                                {
+                                    const ElementType* value = registers[instruction.arg0];
+                                    std::copy(value,
+                                              value + n,
+                                              static_cast<ElementType*>(outputs[instruction.dst]) +
+                                                  begin);
+                                    continue;
+                                }
+
+                                ElementType* dst = &scratch[instruction.dst * block_size];
+                                if (instruction.opcode == Opcode::Splat)
+                                {
+                                    std::fill(
+                                        dst,
+                                        dst + n,
+                                        *static_cast<const ElementType*>(inputs[instruction.arg0]));
+                                    registers[instruction.dst] = dst;
+                                    continue;
+                                }
+                                if (instruction.opcode == Opcode::Tile ||
+                                    instruction.opcode == Opcode::Repeat)
+                                {
+                                    // Copy whole runs of the input instead of indexing
+                                    // each element
+                                    auto input =
+                                        static_cast<const ElementType*>(inputs[instruction.arg0]);
+                                    size_t period = instruction.arg1;
+                                    size_t position = begin % period;
+                                    size_t row = begin / period;
+                                    for (size_t i = 0; i < n;)
+                                    {
+                                        size_t run = std::min(period - position, n - i);
+                                        if (instruction.opcode == Opcode::Tile)
+                                        {
+                                            std::copy(input + position,
+                                                      input + position + run,
+                                                      dst + i);
+                                        }
+                                        else
+                                        {
+                                            std::fill(dst + i, dst + i + run, input[row]);
+                                        }
+                                        i += run;
+                                        position = 0;
+                                        row++;
+                                    }
+                                    registers[instruction.dst] = dst;
+                                    continue;
+                                }
+
+                                const ElementType* a = registers[instruction.arg0];
+                                const ElementType* b = registers[instruction.arg1];
+                                switch (instruction.opcode)
+                                {
+                                case Opcode::Add:
+                                    for (size_t i = 0; i < n; i++)
+                                    {
+                                        dst[i] = a[i] + b[i];
+                                    }
+                                    break;
+                                case Opcode::Subtract:
+                                    for (size_t i = 0; i < n; i++)
+                                    {
+                                        dst[i] = a[i] - b[i];
+                                    }
+                                    break;
+                                case Opcode::Multiply:
+                                    for (size_t i = 0; i < n; i++)
+                                    {
+                                        dst[i] = a[i] * b[i];
+                                    }
+                                    break;
+                                case Opcode::Divide:
+                                    // Only real numbers, integers are left to the divide
+                                    // kernel that checks for zero
+                                    for (size_t i = 0; i < n; i++)
+                                    {
+                                        dst[i] = a[i] / b[i];
+                                    }
+                                    break;
+                                case Opcode::Minimum:
+                                    for (size_t i = 0; i < n; i++)
+                                    {
+                                        dst[i] = a[i] < b[i] ? a[i] : b[i];
+                                    }
+                                    break;
+                                case Opcode::Maximum:
+                                    for (size_t i = 0; i < n; i++)
+                                    {
+                                        dst[i] = a[i] > b[i] ? a[i] : b[i];
+                                    }
+                                    break;
+                                case Opcode::Negative:
+                                    for (size_t i = 0; i < n; i++)
+                                    {
+                                        dst[i] = -a[i];
+                                    }
+                                    break;
+                                case Opcode::Abs:
+                                    for (size_t i = 0; i < n; i++)
+                                    {
+                                        dst[i] = loop::abs(a[i]);
+                                    }
+                                    break;
+                                case Opcode::Relu:
+                                    for (size_t i = 0; i < n; i++)
+                                    {
+                                        dst[i] = a[i] > 0 ? a[i] : 0;
+                                    }
+                                    break;
+                                default: break;
+                                }
+                                registers[instruction.dst] = dst;
+                            }
+                        }
+                    };
+
+                    Eigen::TensorOpCost cost(
+                        block_size * sizeof(ElementType),
+                        block_size * sizeof(ElementType),
+                        block_size * static_cast<double>(program.instructions.size()));
+                    ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        num_blocks, cost, run_blocks);
+                }
+            }
+        }
+    }
+}
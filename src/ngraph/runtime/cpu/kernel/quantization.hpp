@@ -0,0 +1,285 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/op/quantize.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// \brief Views a tensor as [outer, channels, inner], where the channels are the
+                ///        quantization axes. Returns false when the axes are not contiguous, so
+                ///        that scale and offset cannot be indexed that way.
+                inline bool get_quantization_layout(const Shape& shape,
+                                                    const AxisSet& axes,
+                                                    size_t& outer,
+                                                    size_t& channels,
+                                                    size_t& inner)
+                {
+                    outer = 1;
+                    channels = 1;
+                    inner = 1;
+                    if (axes.empty())
+                    {
+                        inner = shape_size(shape);
+                        return true;
+                    }
+                    size_t first = *axes.begin();
+                    size_t last = *axes.rbegin();
+                    if (last - first + 1 != axes.size())
+                    {
+                        return false;
+                    }
+                    for (size_t i = 0; i < shape.size(); i++)
+                    {
+                        if (i < first)
+                        {
+                            outer *= shape[i];
+                        }
+                        else if (i <= last)
+                        {
+                            channels *= shape[i];
+                        }
+                        else
+                        {
+                            inner *= shape[i];
+                        }
+                    }
+                    return true;
+                }
+
+                // Runs op(in, out, count, channel) over every run of elements that share a
+                // channel, in parallel on the executor's thread pool
+                template <typename OP>
+                void quantization_loop(size_t outer,
+                                       size_t channels,
+                                       size_t inner,
+                                       size_t element_cost,
+                                       int arena,
+                                       OP op)
+                {
+                    auto& device = executor::GetCPUExecutor().get_device(arena);
+                    if (inner == 1)
+                    {
+                        // Per-channel scales along the innermost axis: each row of channels
+                        // is a loop over the scale vector
+                        Eigen::TensorOpCost cost(channels * element_cost, channels, channels);
+                        device.parallelFor(outer, cost, [&](Eigen::Index first, Eigen::Index last) {
+                            for (Eigen::Index r = first; r < last; r++)
+                            {
+                                op(r * channels, channels, -1);
+                            }
+                        });
+                    }
+                    else
+                    {
+                        Eigen::TensorOpCost cost(inner * element_cost, inner, inner);
+                        device.parallelFor(
+                            outer * channels, cost, [&](Eigen::Index first, Eigen::Index last) {
+                                for (Eigen::Index r = first; r < last; r++)
+                                {
+                                    op(r * inner, inner, r % channels);
+                                }
+                            });
+                    }
+                }
+
+                template <typename REAL, typename QUANT, typename ROUND>
+                void quantize(const REAL* input,
+                              const REAL* scale,
+                              const QUANT* offset,
+                              QUANT* output,
+                              size_t outer,
+                              size_t channels,
+                              size_t inner,
+                              int arena,
+                              ROUND round)
+                {
+                    const REAL min_value = static_cast<REAL>(std::numeric_limits<QUANT>::min());
+                    const REAL max_value = static_cast<REAL>(std::numeric_limits<QUANT>::max());
+                    auto quantize_one = [=](REAL value, REAL s, QUANT o) {
+                        REAL q = round(value / s);
+                        q += o;
+                        return static_cast<QUANT>(std::min(std::max(q, min_value), max_value));
+                    };
+
+                    quantization_loop(
+                        outer,
+                        channels,
+                        inner,
+                        sizeof(REAL) + sizeof(QUANT),
+                        arena,
+                        [&](size_t start, size_t count, Eigen::Index channel) {
+                            const REAL* in = input + start;
+                            QUANT* out = output + start;
+                            if (channel < 0)
+                            {
+                                for (size_t i = 0; i < count; i++)
+                                {
+                                    out[i] = quantize_one(in[i], scale[i], offset[i]);
+                                }
+                            }
+                            else
+                            {
+                                REAL s = scale[channel];
+                                QUANT o = offset[channel];
+                                for (size_t i = 0; i < count; i++)
+                                {
+                                    out[i] = quantize_one(in[i], s, o);
+                                }
+                            }
+                        });
+                }
+
+                /// \brief Quantizes a tensor with one scale and offset per channel, see
+                ///        get_quantization_layout. Rounds like reference::quantize.
+                template <typename REAL, typename QUANT>
+                void quantize(void* input,
+                              void* scale,
+                              void* offset,
+                              void* output,
+                              size_t outer,
+                              size_t channels,
+                              size_t inner,
+                              ngraph::op::Quantize::RoundMode round_mode,
+                              int arena)
+                {
+                    auto in = static_cast<const REAL*>(input);
+                    auto s = static_cast<const REAL*>(scale);
+                    auto o = static_cast<const QUANT*>(offset);
+                    auto out = static_cast<QUANT*>(output);
+
+                    // The rounding mode is fixed per op, so each one gets its own loop
+                    switch (round_mode)
+                    {
+                    case ngraph::op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_INFINITY:
+                        quantize(in, s, o, out, outer, channels, inner, arena, [](REAL q) -> REAL {
+                            REAL r = std::floor(std::fabs(q) + 0.5);
+                            return q < 0 ? -r : r;
+                        });
+                        break;
+                    case ngraph::op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_ZERO:
+                        quantize(in, s, o, out, outer, channels, inner, arena, [](REAL q) -> REAL {
+                            REAL r = std::ceil(std::fabs(q) - 0.5);
+                            return q < 0 ? -r : r;
+                        });
+                        break;
+                    case ngraph::op::Quantize::RoundMode::ROUND_NEAREST_UPWARD:
+                        quantize(in, s, o, out, outer, channels, inner, arena, [](REAL q) -> REAL {
+                            return std::floor(q + 0.5);
+                        });
+                        break;
+                    case ngraph::op::Quantize::RoundMode::ROUND_NEAREST_DOWNWARD:
+                        quantize(in, s, o, out, outer, channels, inner, arena, [](REAL q) -> REAL {
+                            return std::ceil(q - 0.5);
+                        });
+                        break;
+                    case ngraph::op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN:
+                        quantize(in, s, o, out, outer, channels, inner, arena, [](REAL q) -> REAL {
+                            REAL up = std::floor(q + 0.5);
+                            REAL down = std::ceil(q - 0.5);
+                            return std::fmod(up, 2.0) == 0.0 ? up : down;
+                        });
+                        break;
+                    case ngraph::op::Quantize::RoundMode::ROUND_TOWARD_INFINITY:
+                        quantize(in, s, o, out, outer, channels, inner, arena, [](REAL q) -> REAL {
+                            REAL r = std::ceil(std::fabs(q));
+                            return q < 0 ? -r : r;
+                        });
+                        break;
+                    case ngraph::op::Quantize::RoundMode::ROUND_TOWARD_ZERO:
+                        quantize(in, s, o, out, outer, channels, inner, arena, [](REAL q) -> REAL {
+                            return std::trunc(q);
+                        });
+                        break;
+                    case ngraph::op::Quantize::RoundMode::ROUND_UP:
+                        quantize(in, s, o, out, outer, channels, inner, arena, [](REAL q) -> REAL {
+                            return std::ceil(q);
+                        });
+                        break;
+                    case ngraph::op::Quantize::RoundMode::ROUND_DOWN:
+                        quantize(in, s, o, out, outer, channels, inner, arena, [](REAL q) -> REAL {
+                            return std::floor(q);
+                        });
+                        break;
+                    }
+                }
+
+                /// \brief Dequantizes a tensor with one scale and offset per channel, see
+                ///        get_quantization_layout
+                template <typename QUANT, typename REAL>
+                void dequantize(void* input,
+                                void* scale,
+                                void* offset,
+                                void* output,
+                                size_t outer,
+                                size_t channels,
+                                size_t inner,
+                                int arena)
+                {
+                    auto in = static_cast<const QUANT*>(input);
+                    auto s = static_cast<const REAL*>(scale);
+                    auto o = static_cast<const QUANT*>(offset);
+                    auto out = static_cast<REAL*>(output);
+
+                    quantization_loop(
+                        outer,
+                        channels,
+                        inner,
+                        sizeof(REAL) + sizeof(QUANT),
+                        arena,
+                        [&](size_t start, size_t count, Eigen::Index channel) {
+                            if (channel < 0)
+                            {
+                                for (size_t i = 0; i < count; i++)
+                                {
+                                    out[start + i] =
+                                        static_cast<REAL>(in[start + i] - o[i]) * s[i];
+                                }
+                            }
+                            else
+                            {
+                                REAL channel_scale = s[channel];
+                                QUANT channel_offset = o[channel];
+                                for (size_t i = 0; i < count; i++)
+                                {
+                                    out[start + i] =
+                                        static_cast<REAL>(in[start + i] - channel_offset) *
+                                        channel_scale;
+                                }
+                            }
+                        });
+                }
+            }
+        }
+    }
+}
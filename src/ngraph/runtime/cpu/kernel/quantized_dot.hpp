@@ -0,0 +1,114 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                template <typename OUT>
+                inline OUT requantize(int32_t acc, float scale)
+                {
+                    double value = std::nearbyint(static_cast<double>(acc) * scale);
+                    value = std::max(value, static_cast<double>(std::numeric_limits<OUT>::min()));
+                    value = std::min(value, static_cast<double>(std::numeric_limits<OUT>::max()));
+                    return static_cast<OUT>(value);
+                }
+
+                template <>
+                inline float requantize<float>(int32_t acc, float scale)
+                {
+                    return static_cast<float>(acc) * scale;
+                }
+
+                /// \brief int8 matrix product out[m, n] = scale * sum_k data[m, k] * weights[k, n]
+                ///        with i32 accumulation.
+                ///
+                /// Work is split into blocks of output columns so that each task keeps its
+                /// accumulators in a small local buffer and streams rows of the weights; the
+                /// inner loop is a widening multiply-add over contiguous columns.
+                template <typename DATA, typename WEIGHTS, typename OUT>
+                void quantized_dot(void* data,
+                                   void* weights,
+                                   void* scale,
+                                   void* output,
+                                   size_t m,
+                                   size_t k,
+                                   size_t n,
+                                   int arena)
+                {
+                    static const size_t block_columns = 256;
+
+                    auto a = static_cast<const DATA*>(data);
+                    auto b = static_cast<const WEIGHTS*>(weights);
+                    auto out = static_cast<OUT*>(output);
+                    float s = *static_cast<const float*>(scale);
+
+                    size_t column_blocks = (n + block_columns - 1) / block_columns;
+                    auto dot_block = [&](Eigen::Index first, Eigen::Index last) {
+                        int32_t acc[block_columns];
+                        for (Eigen::Index task = first; task < last; task++)
+                        {
+                            size_t row = task / column_blocks;
+                            size_t column = (task % column_blocks) * block_columns;
+                            size_t width = std::min(block_columns, n - column);
+
+                            std::fill(acc, acc + width, 0);
+                            const DATA* a_row = a + row * k;
+                            for (size_t i = 0; i < k; i++)
+                            {
+                                int32_t a_value = a_row[i];
+                                const WEIGHTS* b_row = b + i * n + column;
+                                for (size_t j = 0; j < width; j++)
+                                {
+                                    acc[j] += a_value * static_cast<int32_t>(b_row[j]);
+                                }
+                            }
+
+                            OUT* out_row = out + row * n + column;
+                            for (size_t j = 0; j < width; j++)
+                            {
+                                out_row[j] = requantize<OUT>(acc[j], s);
+                            }
+                        }
+                    };
+
+                    Eigen::TensorOpCost cost(k * std::min(block_columns, n) *
+                                                 (sizeof(DATA) + sizeof(WEIGHTS)),
+                                             std::min(block_columns, n) * sizeof(OUT),
+                                             2 * k * std::min(block_columns, n));
+                    executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        m * column_blocks, cost, dot_block);
+                }
+            }
+        }
+    }
+}
@@ -20,6 +20,7 @@
 #include <unsupported/Eigen/CXX11/Tensor>
 
 #include "ngraph/axis_set.hpp"
+#include "ngraph/op/util/reducer.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
@@ -73,6 +74,45 @@ namespace ngraph
                     ElementType finalize(const ElementType R) const { return R; }
                 };
 
+                // Folds the initial value of a recognised reduction into its `count` results
+                template <typename ElementType>
+                void reduce_function_initial(void* input1,
+                                             void* output,
+                                             size_t count,
+                                             ngraph::op::util::ReducerKind kind,
+                                             int arena)
+                {
+                    Eigen::array<Eigen::Index, 1> dims;
+                    dims[0] = count;
+
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> out(
+                        static_cast<ElementType*>(output), dims);
+                    auto initial = out.constant(*static_cast<ElementType*>(input1));
+                    auto& device =
+                        ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena);
+
+                    switch (kind)
+                    {
+                    case ngraph::op::util::ReducerKind::Add:
+                        out.device(device) = out + initial;
+                        break;
+                    case ngraph::op::util::ReducerKind::Multiply:
+                        out.device(device) = out * initial;
+                        break;
+                    // Booleans hold 0 or 1, so Or and And are Maximum and Minimum
+                    case ngraph::op::util::ReducerKind::Maximum:
+                    case ngraph::op::util::ReducerKind::Or:
+                        out.device(device) = out.cwiseMax(initial);
+                        break;
+                    case ngraph::op::util::ReducerKind::Minimum:
+                    case ngraph::op::util::ReducerKind::And:
+                        out.device(device) = out.cwiseMin(initial);
+                        break;
+                    case ngraph::op::util::ReducerKind::Unknown:
+                        throw ngraph_error("Unrecognised reduction function");
+                    }
+                }
+
                 template <typename ElementType, unsigned int Rank, unsigned int ReductionDims>
                 void reduce_function(void* input0,
                                      void* input1,
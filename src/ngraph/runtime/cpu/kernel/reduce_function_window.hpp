@@ -16,6 +16,10 @@
 
 #pragma once
 
+#include <algorithm>
+#include <functional>
+
+#include "ngraph/op/util/reducer.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
@@ -72,6 +76,48 @@ namespace ngraph
                                                           window_shape,
                                                           window_movement_strides);
                 }
+
+                template <typename ElementType>
+                void reduce_function_window_native(void* input0,
+                                                   void* input1,
+                                                   void* output,
+                                                   const Shape& input_shape,
+                                                   const Shape& output_shape,
+                                                   const Shape& window_shape,
+                                                   const Strides& window_movement_strides,
+                                                   ngraph::op::util::ReducerKind kind)
+                {
+                    std::function<ElementType(ElementType, ElementType)> reducer;
+                    switch (kind)
+                    {
+                    case ngraph::op::util::ReducerKind::Add:
+                        reducer = std::plus<ElementType>();
+                        break;
+                    case ngraph::op::util::ReducerKind::Multiply:
+                        reducer = std::multiplies<ElementType>();
+                        break;
+                    // Booleans hold 0 or 1, so Or and And are Maximum and Minimum
+                    case ngraph::op::util::ReducerKind::Maximum:
+                    case ngraph::op::util::ReducerKind::Or:
+                        reducer = [](ElementType a, ElementType b) { return std::max(a, b); };
+                        break;
+                    case ngraph::op::util::ReducerKind::Minimum:
+                    case ngraph::op::util::ReducerKind::And:
+                        reducer = [](ElementType a, ElementType b) { return std::min(a, b); };
+                        break;
+                    case ngraph::op::util::ReducerKind::Unknown:
+                        throw ngraph_error("Unrecognised reduction function");
+                    }
+
+                    reference::reduce_window<ElementType>(static_cast<const ElementType*>(input0),
+                                                          static_cast<const ElementType*>(input1),
+                                                          static_cast<ElementType*>(output),
+                                                          input_shape,
+                                                          output_shape,
+                                                          reducer,
+                                                          window_shape,
+                                                          window_movement_strides);
+                }
             }
         }
     }
@@ -0,0 +1,127 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstring>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// \brief Copies a [num_rows, row_len] table to `out`, unless they share a
+                ///        buffer, and adds row i of `updates` to row indices[i] of `out`.
+                ///
+                ///        The table is split into one contiguous band of rows per thread. Each
+                ///        thread copies its band and applies only the updates that land in it,
+                ///        so repeated indices accumulate without atomics or locks.
+                template <typename ElementType, typename IndexType>
+                void scatter_add(void* inputs,
+                                 void* indices,
+                                 void* updates,
+                                 void* out,
+                                 size_t indices_count,
+                                 size_t num_rows,
+                                 size_t row_len,
+                                 int arena)
+                {
+                    auto input_data = static_cast<const ElementType*>(inputs);
+                    auto index_data = static_cast<const IndexType*>(indices);
+                    auto update_data = static_cast<const ElementType*>(updates);
+                    auto out_data = static_cast<ElementType*>(out);
+                    bool in_place = inputs == out;
+
+                    auto& device =
+                        ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena);
+                    size_t num_bands = std::max<size_t>(
+                        1, std::min<size_t>(num_rows, static_cast<size_t>(device.numThreads())));
+
+                    auto scatter = [&](Eigen::Index first_band, Eigen::Index last_band) {
+                        size_t first_row = first_band * num_rows / num_bands;
+                        size_t last_row = last_band * num_rows / num_bands;
+                        if (!in_place)
+                        {
+                            memcpy(out_data + first_row * row_len,
+                                   input_data + first_row * row_len,
+                                   (last_row - first_row) * row_len * sizeof(ElementType));
+                        }
+                        for (size_t i = 0; i < indices_count; i++)
+                        {
+                            IndexType index = index_data[i];
+                            if (index < 0 || static_cast<size_t>(index) < first_row ||
+                                static_cast<size_t>(index) >= last_row)
+                            {
+                                continue;
+                            }
+                            ElementType* out_row = out_data + static_cast<size_t>(index) * row_len;
+                            const ElementType* update_row = update_data + i * row_len;
+                            for (size_t j = 0; j < row_len; j++)
+                            {
+                                out_row[j] += update_row[j];
+                            }
+                        }
+                    };
+
+                    // Every band scans all the indices but only touches its own rows
+                    double rows_per_band = static_cast<double>(num_rows) / num_bands;
+                    double updates_per_band = static_cast<double>(indices_count) / num_bands;
+                    Eigen::TensorOpCost cost(
+                        (rows_per_band + updates_per_band) * row_len * sizeof(ElementType),
+                        rows_per_band * row_len * sizeof(ElementType),
+                        indices_count + updates_per_band * row_len);
+                    device.parallelFor(num_bands, cost, scatter);
+                }
+
+                template <typename ElementType>
+                void scatter_add_i32(void* inputs,
+                                     void* indices,
+                                     void* updates,
+                                     void* out,
+                                     size_t indices_count,
+                                     size_t num_rows,
+                                     size_t row_len,
+                                     int arena)
+                {
+                    scatter_add<ElementType, int32_t>(
+                        inputs, indices, updates, out, indices_count, num_rows, row_len, arena);
+                }
+
+                template <typename ElementType>
+                void scatter_add_i64(void* inputs,
+                                     void* indices,
+                                     void* updates,
+                                     void* out,
+                                     size_t indices_count,
+                                     size_t num_rows,
+                                     size_t row_len,
+                                     int arena)
+                {
+                    scatter_add<ElementType, int64_t>(
+                        inputs, indices, updates, out, indices_count, num_rows, row_len, arena);
+                }
+            }
+        }
+    }
+}
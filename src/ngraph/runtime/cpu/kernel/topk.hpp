@@ -0,0 +1,299 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Use a bounded heap when k is at most this fraction of the axis, else sort
+                constexpr size_t topk_heap_ratio = 16;
+                // Smallest part of an axis scanned by one thread when a slice is split
+                constexpr size_t topk_min_chunk = 16384;
+
+                /// \brief Whether (value, index) `a` comes before `b` in the output; ties go to
+                ///        the larger index for max and the smaller for min, as in
+                ///        reference::topk.
+                template <typename T, typename U, bool Max>
+                struct topk_before
+                {
+                    bool operator()(const std::pair<T, U>& a, const std::pair<T, U>& b) const
+                    {
+                        return Max ? (a.first > b.first ||
+                                      (a.first == b.first && a.second > b.second))
+                                   : (a.first < b.first ||
+                                      (a.first == b.first && a.second < b.second));
+                    }
+                };
+
+                // The front of `heap` is the last of the best k entries seen so far
+                template <typename T, typename U, bool Max>
+                void topk_heap_push(std::vector<std::pair<T, U>>& heap,
+                                    size_t k,
+                                    const std::pair<T, U>& entry)
+                {
+                    topk_before<T, U, Max> before;
+                    if (heap.size() < k)
+                    {
+                        heap.push_back(entry);
+                        std::push_heap(heap.begin(), heap.end(), before);
+                    }
+                    else if (before(entry, heap.front()))
+                    {
+                        std::pop_heap(heap.begin(), heap.end(), before);
+                        heap.back() = entry;
+                        std::push_heap(heap.begin(), heap.end(), before);
+                    }
+                }
+
+                // Collects the best k of slice[first * stride], ..., slice[(last - 1) * stride]
+                template <typename T, typename U, bool Max>
+                void topk_heap_scan(const T* slice,
+                                    size_t stride,
+                                    size_t first,
+                                    size_t last,
+                                    size_t k,
+                                    std::vector<std::pair<T, U>>& heap)
+                {
+                    heap.clear();
+                    size_t i = first;
+                    for (; i < last && heap.size() < k; i++)
+                    {
+                        topk_heap_push<T, U, Max>(heap, k, {slice[i * stride], static_cast<U>(i)});
+                    }
+                    if (heap.empty())
+                    {
+                        return;
+                    }
+                    // Once the heap is full almost every element loses to the threshold and is
+                    // rejected with a single comparison
+                    T threshold = heap.front().first;
+                    for (; i < last; i++)
+                    {
+                        T value = slice[i * stride];
+                        if (Max ? value < threshold : value > threshold)
+                        {
+                            continue;
+                        }
+                        topk_heap_push<T, U, Max>(heap, k, {value, static_cast<U>(i)});
+                        threshold = heap.front().first;
+                    }
+                }
+
+                template <typename T, typename U, bool Max>
+                void topk_select(const T* arg,
+                                 U* out_indices,
+                                 T* out_values,
+                                 const Shape& in_shape,
+                                 size_t axis,
+                                 size_t k,
+                                 int arena)
+                {
+                    size_t outer = shape_size(Shape(in_shape.begin(), in_shape.begin() + axis));
+                    size_t axis_len = in_shape.at(axis);
+                    size_t inner = shape_size(Shape(in_shape.begin() + axis + 1, in_shape.end()));
+                    size_t num_slices = outer * inner;
+                    if (num_slices == 0 || k == 0)
+                    {
+                        return;
+                    }
+
+                    auto& device =
+                        ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena);
+                    bool use_heap = k * topk_heap_ratio <= axis_len;
+
+                    // With fewer slices than threads, the axis is split too and the best k of
+                    // every part are merged afterwards
+                    size_t num_chunks = 1;
+                    size_t num_threads = static_cast<size_t>(device.numThreads());
+                    if (use_heap && num_slices < num_threads)
+                    {
+                        num_chunks = std::max<size_t>(
+                            1,
+                            std::min(num_threads / num_slices, axis_len / topk_min_chunk));
+                    }
+
+                    auto write = [&](size_t slice, const std::pair<T, U>* entries) {
+                        size_t out_index = (slice / inner) * k * inner + slice % inner;
+                        for (size_t j = 0; j < k; j++)
+                        {
+                            out_values[out_index] = entries[j].first;
+                            out_indices[out_index] = entries[j].second;
+                            out_index += inner;
+                        }
+                    };
+
+                    topk_before<T, U, Max> before;
+                    size_t num_tasks = num_slices * num_chunks;
+                    std::vector<std::pair<T, U>> candidates(num_chunks > 1 ? num_tasks * k : 0);
+                    std::vector<size_t> candidate_counts(num_chunks > 1 ? num_tasks : 0);
+
+                    auto select = [&](Eigen::Index first_task, Eigen::Index last_task) {
+                        std::vector<std::pair<T, U>> heap;
+                        std::vector<U> order;
+                        heap.reserve(k);
+                        for (Eigen::Index task = first_task; task < last_task; task++)
+                        {
+                            size_t slice = task / num_chunks;
+                            size_t chunk = task % num_chunks;
+                            const T* slice_data =
+                                arg + (slice / inner) * axis_len * inner + slice % inner;
+
+                            if (!use_heap)
+                            {
+                                order.resize(axis_len);
+                                std::iota(order.begin(), order.end(), 0);
+                                auto index_before = [&](U a, U b) {
+                                    return before({slice_data[a * inner], a},
+                                                  {slice_data[b * inner], b});
+                                };
+                                std::partial_sort(
+                                    order.begin(), order.begin() + k, order.end(), index_before);
+                                heap.clear();
+                                for (size_t j = 0; j < k; j++)
+                                {
+                                    heap.push_back({slice_data[order[j] * inner], order[j]});
+                                }
+                                write(slice, heap.data());
+                                continue;
+                            }
+
+                            topk_heap_scan<T, U, Max>(slice_data,
+                                                      inner,
+                                                      chunk * axis_len / num_chunks,
+                                                      (chunk + 1) * axis_len / num_chunks,
+                                                      k,
+                                                      heap);
+                            if (num_chunks == 1)
+                            {
+                                std::sort_heap(heap.begin(), heap.end(), before);
+                                write(slice, heap.data());
+                            }
+                            else
+                            {
+                                std::copy(heap.begin(), heap.end(), &candidates[task * k]);
+                                candidate_counts[task] = heap.size();
+                            }
+                        }
+                    };
+
+                    size_t scanned = use_heap ? axis_len / num_chunks : axis_len * 4;
+                    Eigen::TensorOpCost cost(
+                        scanned * sizeof(T), k * (sizeof(T) + sizeof(U)), scanned);
+                    device.parallelFor(num_tasks, cost, select);
+
+                    if (num_chunks > 1)
+                    {
+                        auto merge = [&](Eigen::Index first_slice, Eigen::Index last_slice) {
+                            std::vector<std::pair<T, U>> heap;
+                            heap.reserve(k);
+                            for (Eigen::Index slice = first_slice; slice < last_slice; slice++)
+                            {
+                                heap.clear();
+                                for (size_t chunk = 0; chunk < num_chunks; chunk++)
+                                {
+                                    size_t task = slice * num_chunks + chunk;
+                                    for (size_t j = 0; j < candidate_counts[task]; j++)
+                                    {
+                                        topk_heap_push<T, U, Max>(
+                                            heap, k, candidates[task * k + j]);
+                                    }
+                                }
+                                std::sort_heap(heap.begin(), heap.end(), before);
+                                write(slice, heap.data());
+                            }
+                        };
+                        Eigen::TensorOpCost merge_cost(num_chunks * k * (sizeof(T) + sizeof(U)),
+                                                       k * (sizeof(T) + sizeof(U)),
+                                                       num_chunks * k);
+                        device.parallelFor(num_slices, merge_cost, merge);
+                    }
+                }
+
+                /// \brief Writes the k largest (or smallest) elements of every slice of `arg`
+                ///        along `axis`, in order, and their positions along the axis.
+                template <typename ElementType, typename IndexType>
+                void topk(void* arg,
+                          void* out_indices,
+                          void* out_values,
+                          const Shape& in_shape,
+                          size_t axis,
+                          size_t k,
+                          bool compute_max,
+                          int arena)
+                {
+                    auto arg_data = static_cast<const ElementType*>(arg);
+                    auto indices_data = static_cast<IndexType*>(out_indices);
+                    auto values_data = static_cast<ElementType*>(out_values);
+                    if (compute_max)
+                    {
+                        topk_select<ElementType, IndexType, true>(
+                            arg_data, indices_data, values_data, in_shape, axis, k, arena);
+                    }
+                    else
+                    {
+                        topk_select<ElementType, IndexType, false>(
+                            arg_data, indices_data, values_data, in_shape, axis, k, arena);
+                    }
+                }
+
+                template <typename ElementType>
+                void topk_i32(void* arg,
+                              void* out_indices,
+                              void* out_values,
+                              const Shape& in_shape,
+                              size_t axis,
+                              size_t k,
+                              bool compute_max,
+                              int arena)
+                {
+                    topk<ElementType, int32_t>(
+                        arg, out_indices, out_values, in_shape, axis, k, compute_max, arena);
+                }
+
+                template <typename ElementType>
+                void topk_i64(void* arg,
+                              void* out_indices,
+                              void* out_values,
+                              const Shape& in_shape,
+                              size_t axis,
+                              size_t k,
+                              bool compute_max,
+                              int arena)
+                {
+                    topk<ElementType, int64_t>(
+                        arg, out_indices, out_values, in_shape, axis, k, compute_max, arena);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,136 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "attention.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/softmax.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/sum.hpp"
+#include "ngraph/runtime/cpu/op/batch_dot.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+op::ScaledDotProductAttention::ScaledDotProductAttention(shared_ptr<Node> query,
+                                                         shared_ptr<Node> key,
+                                                         shared_ptr<Node> value,
+                                                         double scale)
+    : Op("ScaledDotProductAttention", check_single_output_args({query, key, value}))
+    , m_scale(scale)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::ScaledDotProductAttention::validate_and_infer_types()
+{
+    auto& et = get_input_element_type(0);
+    auto& query_shape = get_input_shape(0);
+    auto& key_shape = get_input_shape(1);
+    auto& value_shape = get_input_shape(2);
+    size_t rank = query_shape.size();
+
+    NODE_VALIDATION_ASSERT(this, et == element::f32 || et == element::f64)
+        << "Query must be f32 or f64 (query element type: " << et << ").";
+
+    NODE_VALIDATION_ASSERT(
+        this, get_input_element_type(1) == et && get_input_element_type(2) == et)
+        << "Query, key and value element types do not match.";
+
+    NODE_VALIDATION_ASSERT(this,
+                           (rank == 2 || rank == 3) && key_shape.size() == rank &&
+                               value_shape.size() == rank)
+        << "Query, key and value must all have rank 2 or all have rank 3 (query shape: "
+        << query_shape << ", key shape: " << key_shape << ", value shape: " << value_shape
+        << ").";
+
+    NODE_VALIDATION_ASSERT(this, rank == 2 || (query_shape[0] == key_shape[0] &&
+                                               query_shape[0] == value_shape[0]))
+        << "Batch sizes do not match (query shape: " << query_shape
+        << ", key shape: " << key_shape << ", value shape: " << value_shape << ").";
+
+    NODE_VALIDATION_ASSERT(this, query_shape[rank - 1] == key_shape[rank - 1])
+        << "Query and key depths do not match (query shape: " << query_shape
+        << ", key shape: " << key_shape << ").";
+
+    NODE_VALIDATION_ASSERT(this, key_shape[rank - 2] == value_shape[rank - 2])
+        << "Key and value lengths do not match (key shape: " << key_shape
+        << ", value shape: " << value_shape << ").";
+
+    Shape output_shape{query_shape};
+    output_shape[rank - 1] = value_shape[rank - 1];
+    set_output_type(0, et, output_shape);
+}
+
+shared_ptr<Node>
+    op::ScaledDotProductAttention::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<ScaledDotProductAttention>(
+        new_args.at(0), new_args.at(1), new_args.at(2), m_scale);
+}
+
+void op::ScaledDotProductAttention::generate_adjoints(autodiff::Adjoints& adjoints,
+                                                      const NodeVector& deltas)
+{
+    auto delta = deltas.at(0);
+    auto query = get_argument(0);
+    auto key = get_argument(1);
+    auto value = get_argument(2);
+    size_t rank = query->get_shape().size();
+
+    // Matrix product of (optionally transposed) matrices or batches of matrices
+    auto matmul = [rank](const shared_ptr<Node>& a,
+                         const shared_ptr<Node>& b,
+                         bool transpose_a,
+                         bool transpose_b) -> shared_ptr<Node> {
+        if (rank == 3)
+        {
+            return make_shared<op::BatchDot>(a, b, transpose_a, transpose_b);
+        }
+        auto transpose = [](const shared_ptr<Node>& n) {
+            auto& shape = n->get_shape();
+            return make_shared<op::Reshape>(n, AxisVector{1, 0}, Shape{shape[1], shape[0]});
+        };
+        return make_shared<op::Dot>(transpose_a ? transpose(a) : a,
+                                    transpose_b ? transpose(b) : b);
+    };
+    auto scaled = [this](const shared_ptr<Node>& n) {
+        return make_shared<op::Multiply>(
+            n, op::Constant::create(n->get_element_type(), n->get_shape(), {m_scale}));
+    };
+
+    // Recompute the attention probabilities from the saved forward arguments
+    AxisSet key_axis{rank - 1};
+    auto probabilities =
+        make_shared<op::Softmax>(scaled(matmul(query, key, false, true)), key_axis);
+    auto& scores_shape = probabilities->get_shape();
+
+    // Softmax backprop: d(scores) = p * (d(p) - sum(d(p) * p))
+    auto probabilities_delta = matmul(delta, value, false, true);
+    auto row_sums = make_shared<op::Sum>(
+        make_shared<op::Multiply>(probabilities_delta, probabilities), key_axis);
+    auto scores_delta = scaled(make_shared<op::Multiply>(
+        probabilities,
+        make_shared<op::Subtract>(probabilities_delta,
+                                  make_shared<op::Broadcast>(row_sums, scores_shape, key_axis))));
+
+    adjoints.add_delta(query, matmul(scores_delta, key, false, false));
+    adjoints.add_delta(key, matmul(scores_delta, query, true, false));
+    adjoints.add_delta(value, matmul(probabilities, delta, true, false));
+}
@@ -0,0 +1,58 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include "ngraph/op/op.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Scaled dot-product attention: softmax(scale * query . key^T) . value, with the
+        ///        softmax taken over the keys.
+        ///
+        /// Inputs are either matrices or batches of matrices (the leading axis is the batch):
+        /// query [(B,) Lq, D], key [(B,) Lk, D], value [(B,) Lk, Dv]; the output is
+        /// [(B,) Lq, Dv].
+        class ScaledDotProductAttention : public Op
+        {
+        public:
+            /// \brief Constructs a ScaledDotProductAttention operation.
+            ///
+            /// \param query The queries.
+            /// \param key The keys.
+            /// \param value The values.
+            /// \param scale The factor applied to the attention scores, usually 1 / sqrt(D).
+            ScaledDotProductAttention(std::shared_ptr<Node> query,
+                                      std::shared_ptr<Node> key,
+                                      std::shared_ptr<Node> value,
+                                      double scale);
+
+            void validate_and_infer_types() override;
+
+            double get_scale() const { return m_scale; }
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+        protected:
+            virtual void generate_adjoints(autodiff::Adjoints& adjoints,
+                                           const NodeVector& deltas) override;
+
+        private:
+            double m_scale;
+        };
+    }
+}
@@ -0,0 +1,73 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "gelu.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/tanh.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr double op::Gelu::sqrt_2_over_pi;
+constexpr double op::Gelu::cubic_coefficient;
+
+op::Gelu::Gelu(shared_ptr<Node> arg)
+    : UnaryElementwiseArithmetic("Gelu", {arg})
+{
+    constructor_validate_and_infer_types();
+}
+
+shared_ptr<Node> op::Gelu::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<Gelu>(new_args.at(0));
+}
+
+void op::Gelu::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas)
+{
+    auto delta = deltas.at(0);
+    auto x = get_argument(0);
+    auto& et = x->get_element_type();
+    auto& shape = x->get_shape();
+    auto constant = [&](double value) { return op::Constant::create(et, shape, {value}); };
+
+    // With t = tanh(sqrt(2 / pi) * (x + c * x^3)):
+    // d/dx = 0.5 * (1 + t) + 0.5 * x * (1 - t^2) * sqrt(2 / pi) * (1 + 3 * c * x^2)
+    auto x_squared = make_shared<op::Multiply>(x, x);
+    auto inner = make_shared<op::Multiply>(
+        constant(sqrt_2_over_pi),
+        make_shared<op::Add>(
+            x,
+            make_shared<op::Multiply>(constant(cubic_coefficient),
+                                      make_shared<op::Multiply>(x_squared, x))));
+    auto t = make_shared<op::Tanh>(inner);
+    auto half_one_plus_t =
+        make_shared<op::Multiply>(constant(0.5), make_shared<op::Add>(constant(1), t));
+    auto inner_derivative = make_shared<op::Multiply>(
+        constant(sqrt_2_over_pi),
+        make_shared<op::Add>(
+            constant(1), make_shared<op::Multiply>(constant(3 * cubic_coefficient), x_squared)));
+    auto tanh_derivative = make_shared<op::Subtract>(constant(1), make_shared<op::Multiply>(t, t));
+    auto derivative = make_shared<op::Add>(
+        half_one_plus_t,
+        make_shared<op::Multiply>(
+            make_shared<op::Multiply>(constant(0.5), x),
+            make_shared<op::Multiply>(tanh_derivative, inner_derivative)));
+
+    adjoints.add_delta(x, make_shared<op::Multiply>(delta, derivative));
+}
@@ -0,0 +1,123 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "layer_norm.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/sqrt.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/sum.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+op::LayerNorm::LayerNorm(shared_ptr<Node> data,
+                         shared_ptr<Node> gamma,
+                         shared_ptr<Node> beta,
+                         double epsilon)
+    : Op("LayerNorm", check_single_output_args({data, gamma, beta}))
+    , m_epsilon(epsilon)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::LayerNorm::validate_and_infer_types()
+{
+    auto& data_et = get_input_element_type(0);
+    auto& data_shape = get_input_shape(0);
+
+    NODE_VALIDATION_ASSERT(this, data_et == element::f32 || data_et == element::f64)
+        << "Data must be f32 or f64 (data element type: " << data_et << ").";
+
+    NODE_VALIDATION_ASSERT(this, data_shape.size() >= 1)
+        << "Data must have rank of at least 1 (data shape: " << data_shape << ").";
+
+    NODE_VALIDATION_ASSERT(this, m_epsilon >= 0)
+        << "Epsilon must be non-negative (epsilon: " << m_epsilon << ").";
+
+    Shape channel_shape{data_shape.back()};
+    for (size_t i = 1; i < 3; i++)
+    {
+        NODE_VALIDATION_ASSERT(this, get_input_element_type(i) == data_et)
+            << "Gamma and beta must have the element type of the data (argument " << i
+            << " element type: " << get_input_element_type(i) << ").";
+
+        NODE_VALIDATION_ASSERT(this, get_input_shape(i) == channel_shape)
+            << "Gamma and beta must have the shape of the last axis of the data (argument " << i
+            << " shape: " << get_input_shape(i) << ", data shape: " << data_shape << ").";
+    }
+
+    set_output_type(0, data_et, data_shape);
+}
+
+shared_ptr<Node> op::LayerNorm::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<LayerNorm>(new_args.at(0), new_args.at(1), new_args.at(2), m_epsilon);
+}
+
+void op::LayerNorm::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas)
+{
+    auto delta = deltas.at(0);
+    auto data = get_argument(0);
+    auto gamma = get_argument(1);
+    auto beta = get_argument(2);
+
+    auto& et = data->get_element_type();
+    auto& shape = data->get_shape();
+    size_t axis = shape.size() - 1;
+    AxisSet norm_axes{axis};
+    AxisSet outer_axes;
+    for (size_t i = 0; i < axis; i++)
+    {
+        outer_axes.insert(i);
+    }
+    Shape outer_shape(shape.begin(), shape.end() - 1);
+
+    // Recompute the normalized input from the saved forward arguments
+    auto count = op::Constant::create(et, outer_shape, {shape[axis]});
+    auto mean = make_shared<op::Divide>(make_shared<op::Sum>(data, norm_axes), count);
+    auto centered =
+        make_shared<op::Subtract>(data, make_shared<op::Broadcast>(mean, shape, norm_axes));
+    auto variance = make_shared<op::Divide>(
+        make_shared<op::Sum>(make_shared<op::Multiply>(centered, centered), norm_axes), count);
+    auto epsilon = op::Constant::create(et, outer_shape, {m_epsilon});
+    auto inv_std = make_shared<op::Broadcast>(
+        make_shared<op::Divide>(op::Constant::create(et, outer_shape, {1}),
+                                make_shared<op::Sqrt>(make_shared<op::Add>(variance, epsilon))),
+        shape,
+        norm_axes);
+    auto normalized = make_shared<op::Multiply>(centered, inv_std);
+
+    adjoints.add_delta(beta, make_shared<op::Sum>(delta, outer_axes));
+    adjoints.add_delta(
+        gamma, make_shared<op::Sum>(make_shared<op::Multiply>(delta, normalized), outer_axes));
+
+    // d(data) = inv_std * (g - mean(g) - normalized * mean(g * normalized)), g = delta * gamma
+    auto g = make_shared<op::Multiply>(delta, make_shared<op::Broadcast>(gamma, shape, outer_axes));
+    auto mean_g = make_shared<op::Divide>(make_shared<op::Sum>(g, norm_axes), count);
+    auto mean_g_normalized = make_shared<op::Divide>(
+        make_shared<op::Sum>(make_shared<op::Multiply>(g, normalized), norm_axes), count);
+    auto data_delta = make_shared<op::Multiply>(
+        inv_std,
+        make_shared<op::Subtract>(
+            make_shared<op::Subtract>(g, make_shared<op::Broadcast>(mean_g, shape, norm_axes)),
+            make_shared<op::Multiply>(
+                normalized, make_shared<op::Broadcast>(mean_g_normalized, shape, norm_axes))));
+    adjoints.add_delta(data, data_delta);
+}
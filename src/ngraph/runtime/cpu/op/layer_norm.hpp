@@ -0,0 +1,54 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include "ngraph/op/op.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Layer normalization over the innermost axis:
+        ///        gamma * (data - mean) / sqrt(variance + epsilon) + beta
+        class LayerNorm : public Op
+        {
+        public:
+            /// \brief Constructs a LayerNorm operation.
+            ///
+            /// \param data The input tensor, normalized along its last axis.
+            /// \param gamma The scale, with the shape of the last axis of `data`.
+            /// \param beta The shift, with the shape of the last axis of `data`.
+            /// \param epsilon Added to the variance for numerical stability.
+            LayerNorm(std::shared_ptr<Node> data,
+                      std::shared_ptr<Node> gamma,
+                      std::shared_ptr<Node> beta,
+                      double epsilon);
+
+            void validate_and_infer_types() override;
+
+            double get_epsilon() const { return m_epsilon; }
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+        protected:
+            virtual void generate_adjoints(autodiff::Adjoints& adjoints,
+                                           const NodeVector& deltas) override;
+
+        private:
+            double m_epsilon;
+        };
+    }
+}
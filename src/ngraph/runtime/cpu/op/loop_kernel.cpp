@@ -90,3 +90,36 @@ ngraph::runtime::cpu::op::LoopKernel::LoopKernel(const NodeVector& node_list,
         set_output_type(i, o->get_element_type(), o->get_shape());
     }
 }
+
+ngraph::runtime::cpu::op::LoopBroadcast
+    ngraph::runtime::cpu::op::get_loop_broadcast(const ngraph::op::Broadcast& broadcast)
+{
+    const Shape& shape = broadcast.get_shape();
+    const AxisSet& axes = broadcast.get_broadcast_axes();
+    size_t input_size = shape_size(broadcast.get_input_shape(0));
+    if (input_size == 0)
+    {
+        return LoopBroadcast{true, 0};
+    }
+    if (input_size == 1)
+    {
+        return LoopBroadcast{true, 1};
+    }
+
+    bool leading = true;
+    bool trailing = true;
+    for (size_t axis : axes)
+    {
+        leading = leading && axis < axes.size();
+        trailing = trailing && axis >= shape.size() - axes.size();
+    }
+    if (leading)
+    {
+        return LoopBroadcast{true, input_size};
+    }
+    if (trailing)
+    {
+        return LoopBroadcast{false, shape_size(shape) / input_size};
+    }
+    return LoopBroadcast{true, 0};
+}
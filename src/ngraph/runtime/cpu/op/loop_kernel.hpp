@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include "ngraph/op/broadcast.hpp"
 #include "ngraph/op/op.hpp"
 #include "ngraph/util.hpp"
 
@@ -44,6 +45,19 @@ namespace ngraph
                     NodeVector m_node_list;
                     NodeVector m_output_nodes;
                 };
+
+                /// \brief How a Broadcast inside a LoopKernel reads its input for output
+                ///     element i: input[i % period] if tile is set, else input[i / period].
+                struct LoopBroadcast
+                {
+                    bool tile;
+                    size_t period;
+                };
+
+                /// \brief Broadcasts of a single element or along leading axes tile their
+                ///     input, broadcasts along trailing axes repeat each element. Any other
+                ///     Broadcast can't be fused into a LoopKernel and has period 0.
+                LoopBroadcast get_loop_broadcast(const ngraph::op::Broadcast& broadcast);
             }
         }
     }
@@ -30,9 +30,11 @@
 #include "ngraph/op/concat.hpp"
 #include "ngraph/op/constant.hpp"
 #include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dequantize.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/dot.hpp"
 #include "ngraph/op/exp.hpp"
+#include "ngraph/op/experimental/quantized_dot.hpp"
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/max_pool.hpp"
 #include "ngraph/op/maximum.hpp"
@@ -41,11 +43,13 @@
 #include "ngraph/op/negative.hpp"
 #include "ngraph/op/pad.hpp"
 #include "ngraph/op/parameter.hpp"
+#include "ngraph/op/quantize.hpp"
 #include "ngraph/op/relu.hpp"
 #include "ngraph/op/replace_slice.hpp"
 #include "ngraph/op/reshape.hpp"
 #include "ngraph/op/sigmoid.hpp"
 #include "ngraph/op/slice.hpp"
+#include "ngraph/op/softmax.hpp"
 #include "ngraph/op/sqrt.hpp"
 #include "ngraph/op/subtract.hpp"
 #include "ngraph/op/sum.hpp"
@@ -54,13 +58,17 @@
 #include "ngraph/pattern/op/label.hpp"
 #include "ngraph/pattern/op/skip.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
+#include "ngraph/runtime/cpu/op/attention.hpp"
+#include "ngraph/runtime/cpu/op/batch_dot.hpp"
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
 #include "ngraph/runtime/cpu/op/bounded_relu.hpp"
 #include "ngraph/runtime/cpu/op/conv_add.hpp"
 #include "ngraph/runtime/cpu/op/conv_bias.hpp"
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
+#include "ngraph/runtime/cpu/op/gelu.hpp"
 #include "ngraph/runtime/cpu/op/group_conv.hpp"
 #include "ngraph/runtime/cpu/op/group_conv_bias.hpp"
+#include "ngraph/runtime/cpu/op/layer_norm.hpp"
 #include "ngraph/runtime/cpu/op/leaky_relu.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
@@ -164,6 +172,241 @@ void ngraph::runtime::cpu::pass::CPUFusion::construct_matmulbias()
     this->add_matcher(m);
 }
 
+// Reads the scale of a Quantize or Dequantize with a single constant scale and a zero offset
+static bool get_per_tensor_scale(const std::shared_ptr<ngraph::Node>& node,
+                                 const ngraph::AxisSet& axes,
+                                 float& scale)
+{
+    auto scale_op = std::dynamic_pointer_cast<ngraph::op::Constant>(node->get_argument(1));
+    if (!axes.empty() || !scale_op || scale_op->get_element_type() != ngraph::element::f32 ||
+        !ngraph::is_zero(node->get_argument(2)))
+    {
+        return false;
+    }
+    scale = scale_op->get_vector<float>().at(0);
+    return true;
+}
+
+// Matches a matrix product of two dequantized int8 tensors that op::QuantizedDot can
+// compute directly on the quantized inputs
+static bool get_quantized_dot_args(const std::shared_ptr<ngraph::Node>& node,
+                                   std::shared_ptr<ngraph::Node>& data,
+                                   std::shared_ptr<ngraph::Node>& weights,
+                                   float& scale)
+{
+    auto dot = std::dynamic_pointer_cast<ngraph::op::Dot>(node);
+    if (!dot || dot->get_reduction_axes_count() != 1 ||
+        dot->get_element_type() != ngraph::element::f32)
+    {
+        return false;
+    }
+
+    auto dq_data = std::dynamic_pointer_cast<ngraph::op::Dequantize>(dot->get_argument(0));
+    auto dq_weights = std::dynamic_pointer_cast<ngraph::op::Dequantize>(dot->get_argument(1));
+    float data_scale, weights_scale;
+    if (!dq_data || !dq_weights ||
+        !get_per_tensor_scale(dq_data, dq_data->get_axes(), data_scale) ||
+        !get_per_tensor_scale(dq_weights, dq_weights->get_axes(), weights_scale))
+    {
+        return false;
+    }
+
+    data = dq_data->get_argument(0);
+    weights = dq_weights->get_argument(0);
+    if (data->get_shape().size() != 2 || weights->get_shape().size() != 2 ||
+        (data->get_element_type() != ngraph::element::u8 &&
+         data->get_element_type() != ngraph::element::i8) ||
+        weights->get_element_type() != ngraph::element::i8)
+    {
+        return false;
+    }
+
+    scale = data_scale * weights_scale;
+    return true;
+}
+
+// Returns the Quantize that is the only user of `dot`, if it can be folded into the
+// requantization step of op::QuantizedDot
+static std::shared_ptr<ngraph::op::Quantize>
+    get_requantize_user(const std::shared_ptr<ngraph::Node>& dot, float& scale)
+{
+    auto users = dot->get_users();
+    if (users.size() != 1)
+    {
+        return nullptr;
+    }
+
+    auto quantize = std::dynamic_pointer_cast<ngraph::op::Quantize>(users.at(0));
+    if (!quantize ||
+        quantize->get_round_mode() !=
+            ngraph::op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN ||
+        !get_per_tensor_scale(quantize, quantize->get_axes(), scale))
+    {
+        return nullptr;
+    }
+    return quantize;
+}
+
+// Reads the value of a constant, possibly broadcast, whose elements are all equal
+static bool get_uniform_constant(std::shared_ptr<ngraph::Node> node, double& value)
+{
+    if (auto broadcast = std::dynamic_pointer_cast<ngraph::op::Broadcast>(node))
+    {
+        node = broadcast->get_argument(0);
+    }
+
+    auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(node);
+    if (!constant || shape_size(constant->get_shape()) == 0)
+    {
+        return false;
+    }
+
+    std::vector<double> values;
+    if (constant->get_element_type() == ngraph::element::f32)
+    {
+        auto float_values = constant->get_vector<float>();
+        values.assign(float_values.begin(), float_values.end());
+    }
+    else if (constant->get_element_type() == ngraph::element::f64)
+    {
+        values = constant->get_vector<double>();
+    }
+    else
+    {
+        return false;
+    }
+
+    for (auto val : values)
+    {
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wfloat-equal"
+        if (val != values[0])
+        {
+            return false;
+        }
+#pragma clang diagnostic pop
+    }
+    value = values[0];
+    return true;
+}
+
+static bool is_close(double value, double expected)
+{
+    return std::abs(value - expected) <= 1e-6 * std::max(1.0, std::abs(expected));
+}
+
+// Walks back from `node`, the product of the attention weights with the values, through
+// softmax(scale * query . key^T) and collects the operands of op::ScaledDotProductAttention
+static bool get_attention_args(const std::shared_ptr<ngraph::Node>& node,
+                               std::shared_ptr<ngraph::Node>& query,
+                               std::shared_ptr<ngraph::Node>& key,
+                               std::shared_ptr<ngraph::Node>& value,
+                               double& scale)
+{
+    using namespace ngraph;
+
+    auto et = node->get_element_type();
+    size_t rank = node->get_shape().size();
+    if ((et != element::f32 && et != element::f64) || (rank != 2 && rank != 3))
+    {
+        return false;
+    }
+
+    auto dot = std::dynamic_pointer_cast<op::Dot>(node);
+    auto batch_dot = std::dynamic_pointer_cast<op::BatchDot>(node);
+    if (dot ? (rank != 2 || dot->get_reduction_axes_count() != 1)
+            : (!batch_dot || rank != 3 || batch_dot->get_is_a_transposed() ||
+               batch_dot->get_is_b_transposed()))
+    {
+        return false;
+    }
+
+    auto softmax = std::dynamic_pointer_cast<op::Softmax>(node->get_argument(0));
+    if (!softmax || softmax->get_axes() != AxisSet{rank - 1} ||
+        softmax->get_users().size() != 1)
+    {
+        return false;
+    }
+
+    // The scores are either multiplied or divided by a constant
+    auto scaled = softmax->get_argument(0);
+    if (scaled->get_users().size() != 1 || scaled->get_arguments().size() != 2)
+    {
+        return false;
+    }
+    std::shared_ptr<Node> scores;
+    double factor;
+    if (std::dynamic_pointer_cast<op::Multiply>(scaled))
+    {
+        for (size_t i = 0; i < 2 && !scores; i++)
+        {
+            if (get_uniform_constant(scaled->get_argument(i), factor))
+            {
+                scores = scaled->get_argument(1 - i);
+                scale = factor;
+            }
+        }
+    }
+    else if (std::dynamic_pointer_cast<op::Divide>(scaled) &&
+             get_uniform_constant(scaled->get_argument(1), factor) && std::abs(factor) > 0.0)
+    {
+        scores = scaled->get_argument(0);
+        scale = 1.0 / factor;
+    }
+    if (!scores || scores->get_users().size() != 1)
+    {
+        return false;
+    }
+
+    if (rank == 2)
+    {
+        auto scores_dot = std::dynamic_pointer_cast<op::Dot>(scores);
+        auto key_t =
+            scores_dot ? std::dynamic_pointer_cast<op::Reshape>(scores_dot->get_argument(1))
+                       : nullptr;
+        if (!scores_dot || scores_dot->get_reduction_axes_count() != 1 || !key_t ||
+            key_t->get_input_order() != AxisVector{1, 0})
+        {
+            return false;
+        }
+        query = scores_dot->get_argument(0);
+        key = key_t->get_argument(0);
+    }
+    else
+    {
+        auto scores_dot = std::dynamic_pointer_cast<op::BatchDot>(scores);
+        if (!scores_dot || scores_dot->get_is_a_transposed() ||
+            !scores_dot->get_is_b_transposed())
+        {
+            return false;
+        }
+        query = scores_dot->get_argument(0);
+        key = scores_dot->get_argument(1);
+    }
+    value = node->get_argument(1);
+    return true;
+}
+
+// True when `dot` computes the attention scores of a subgraph that construct_attention fuses
+static bool is_attention_scores(const std::shared_ptr<ngraph::Node>& dot)
+{
+    std::shared_ptr<ngraph::Node> node = dot;
+    // scores -> scale -> softmax -> product with the values
+    for (size_t i = 0; i < 3; i++)
+    {
+        auto users = node->get_users();
+        if (users.size() != 1)
+        {
+            return false;
+        }
+        node = users.at(0);
+    }
+
+    std::shared_ptr<ngraph::Node> query, key, value;
+    double scale;
+    return get_attention_args(node, query, key, value, scale);
+}
+
 void ngraph::runtime::cpu::pass::CPUFusion::construct_matmul()
 {
     Shape shape_w{2, 4};
@@ -201,6 +444,20 @@ void ngraph::runtime::cpu::pass::CPUFusion::construct_matmul()
             return false;
         }
 
+        std::shared_ptr<Node> qdata, qweights;
+        float qscale;
+        if (get_quantized_dot_args(dot, qdata, qweights, qscale))
+        {
+            NGRAPH_DEBUG << "dot = " << dot->get_name() << " is left for QuantizedDot";
+            return false;
+        }
+
+        if (is_attention_scores(dot))
+        {
+            NGRAPH_DEBUG << "dot = " << dot->get_name() << " is left for attention fusion";
+            return false;
+        }
+
         if (shape_size(dot->get_shape()) == 0)
         {
             NGRAPH_DEBUG << "dot has a zero dimension";
@@ -1856,3 +2113,305 @@ void ngraph::runtime::cpu::pass::CPUFusion::construct_update_slice()
         replace_slice, callback, "CPUFusion.UpdateSlice");
     this->add_matcher(m);
 }
+
+void ngraph::runtime::cpu::pass::CPUFusion::construct_quantized_dot()
+{
+    auto data = std::make_shared<pattern::op::Label>(
+        element::f32, Shape{2, 4}, pattern::has_class<op::Dequantize>());
+    auto weights = std::make_shared<pattern::op::Label>(
+        element::f32, Shape{4, 3}, pattern::has_class<op::Dequantize>());
+    auto pdot = std::make_shared<op::Dot>(data, weights);
+
+    pattern::graph_rewrite_callback callback = [](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for construct_quantized_dot against node = "
+                     << m.get_match_root()->get_name();
+        auto dot = m.get_match_root();
+
+        std::shared_ptr<Node> qdata, qweights;
+        float scale;
+        if (!get_quantized_dot_args(dot, qdata, qweights, scale))
+        {
+            return false;
+        }
+
+        // A Quantize that follows is folded in when the match reaches it
+        float requantize_scale;
+        if (get_requantize_user(dot, requantize_scale))
+        {
+            return false;
+        }
+
+        auto scale_op = op::Constant::create(element::f32, Shape{}, {scale});
+        auto qdot = std::make_shared<op::QuantizedDot>(qdata, qweights, scale_op, element::f32);
+        ngraph::replace_node(dot, qdot);
+        return true;
+    };
+
+    auto m = std::make_shared<pattern::Matcher>(pdot, callback, "CPUFusion.QuantizedDot");
+    this->add_matcher(m);
+}
+
+void ngraph::runtime::cpu::pass::CPUFusion::construct_quantized_dot_requantize()
+{
+    auto dot = std::make_shared<pattern::op::Label>(
+        element::f32, Shape{2, 3}, pattern::has_class<op::Dot>());
+    auto scale = std::make_shared<pattern::op::Label>(element::f32, Shape{});
+    auto offset = std::make_shared<pattern::op::Label>(element::i8, Shape{});
+    auto quantize =
+        std::make_shared<op::Quantize>(dot,
+                                       scale,
+                                       offset,
+                                       element::i8,
+                                       AxisSet{},
+                                       op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN);
+
+    pattern::graph_rewrite_callback callback = [dot](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for construct_quantized_dot_requantize against node = "
+                     << m.get_match_root()->get_name();
+        auto pattern_map = m.get_pattern_map();
+
+        std::shared_ptr<Node> qdata, qweights;
+        float dot_scale, requantize_scale;
+        if (!get_quantized_dot_args(pattern_map[dot], qdata, qweights, dot_scale) ||
+            get_requantize_user(pattern_map[dot], requantize_scale) != m.get_match_root())
+        {
+            return false;
+        }
+
+        auto scale_op =
+            op::Constant::create(element::f32, Shape{}, {dot_scale / requantize_scale});
+        auto qdot = std::make_shared<op::QuantizedDot>(
+            qdata, qweights, scale_op, m.get_match_root()->get_element_type());
+        ngraph::replace_node(m.get_match_root(), qdot);
+        return true;
+    };
+
+    auto m =
+        std::make_shared<pattern::Matcher>(quantize, callback, "CPUFusion.QuantizedDotRequantize");
+    this->add_matcher(m);
+}
+
+void ngraph::runtime::cpu::pass::CPUFusion::construct_layer_norm()
+{
+    Shape shape{2, 4};
+    Shape reduced_shape{2};
+    AxisSet last_axis{1};
+    auto broadcast_pred = pattern::has_class<op::Broadcast>();
+
+    auto input = std::make_shared<pattern::op::Label>(element::f32, shape);
+    auto mean_count = std::make_shared<pattern::op::Label>(element::f32, reduced_shape);
+    auto mean = std::make_shared<op::Divide>(
+        std::make_shared<op::Sum>(input, last_axis),
+        std::make_shared<pattern::op::Skip>(mean_count, broadcast_pred));
+    auto mean_broadcast = std::make_shared<op::Broadcast>(mean, shape, last_axis);
+    auto mean_broadcast_label = std::make_shared<pattern::op::Label>(
+        mean_broadcast, nullptr, NodeVector{mean_broadcast});
+    auto centered = std::make_shared<op::Subtract>(input, mean_broadcast_label);
+    auto centered_label =
+        std::make_shared<pattern::op::Label>(centered, nullptr, NodeVector{centered});
+
+    auto variance_count = std::make_shared<pattern::op::Label>(element::f32, reduced_shape);
+    auto variance = std::make_shared<op::Divide>(
+        std::make_shared<op::Sum>(std::make_shared<op::Multiply>(centered_label, centered_label),
+                                  last_axis),
+        std::make_shared<pattern::op::Skip>(variance_count, broadcast_pred));
+    auto eps = std::make_shared<pattern::op::Label>(element::f32, reduced_shape);
+    auto stddev = std::make_shared<op::Sqrt>(std::make_shared<op::Add>(
+        variance, std::make_shared<pattern::op::Skip>(eps, broadcast_pred)));
+    auto stddev_broadcast = std::make_shared<op::Broadcast>(stddev, shape, last_axis);
+    auto stddev_broadcast_label = std::make_shared<pattern::op::Label>(
+        stddev_broadcast, nullptr, NodeVector{stddev_broadcast});
+    auto normalized = std::make_shared<op::Divide>(centered_label, stddev_broadcast_label);
+
+    auto gamma = std::make_shared<pattern::op::Label>(element::f32, Shape{4});
+    auto gamma_broadcast = std::make_shared<op::Broadcast>(gamma, shape, AxisSet{0});
+    auto gamma_broadcast_label = std::make_shared<pattern::op::Label>(
+        gamma_broadcast, nullptr, NodeVector{gamma_broadcast});
+    auto beta = std::make_shared<pattern::op::Label>(element::f32, Shape{4});
+    auto beta_broadcast = std::make_shared<op::Broadcast>(beta, shape, AxisSet{0});
+    auto beta_broadcast_label = std::make_shared<pattern::op::Label>(
+        beta_broadcast, nullptr, NodeVector{beta_broadcast});
+    auto layer_norm = std::make_shared<op::Add>(
+        std::make_shared<op::Multiply>(normalized, gamma_broadcast_label), beta_broadcast_label);
+
+    pattern::graph_rewrite_callback callback = [input,
+                                                mean_count,
+                                                variance_count,
+                                                eps,
+                                                gamma,
+                                                beta,
+                                                mean_broadcast_label,
+                                                stddev_broadcast_label,
+                                                gamma_broadcast_label,
+                                                beta_broadcast_label](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for construct_layer_norm against node = "
+                     << m.get_match_root()->get_name();
+        auto pattern_map = m.get_pattern_map();
+
+        auto data = pattern_map[input];
+        auto et = data->get_element_type();
+        auto& data_shape = data->get_shape();
+        size_t rank = data_shape.size();
+        if ((et != element::f32 && et != element::f64) || rank < 2)
+        {
+            NGRAPH_DEBUG << "Only f32/f64 inputs of rank 2 or more are normalized";
+            return false;
+        }
+
+        // Every reduction and broadcast in the match must run along the last axis
+        AxisSet last_axis{rank - 1};
+        AxisSet leading_axes;
+        for (size_t i = 0; i < rank - 1; i++)
+        {
+            leading_axes.insert(i);
+        }
+        for (auto node : m.get_matched_nodes())
+        {
+            auto sum = std::dynamic_pointer_cast<op::Sum>(node);
+            if (sum && sum->get_reduction_axes() != last_axis)
+            {
+                NGRAPH_DEBUG << "Sum " << sum->get_name() << " does not reduce the last axis";
+                return false;
+            }
+        }
+        for (auto label : {mean_broadcast_label, stddev_broadcast_label})
+        {
+            auto broadcast = std::static_pointer_cast<op::Broadcast>(pattern_map[label]);
+            if (broadcast->get_broadcast_axes() != last_axis)
+            {
+                return false;
+            }
+        }
+        for (auto label : {gamma_broadcast_label, beta_broadcast_label})
+        {
+            auto broadcast = std::static_pointer_cast<op::Broadcast>(pattern_map[label]);
+            if (broadcast->get_broadcast_axes() != leading_axes)
+            {
+                return false;
+            }
+        }
+
+        double width = static_cast<double>(data_shape.back());
+        double mean_count_value, variance_count_value, epsilon;
+        if (!get_uniform_constant(pattern_map[mean_count], mean_count_value) ||
+            !get_uniform_constant(pattern_map[variance_count], variance_count_value) ||
+            !get_uniform_constant(pattern_map[eps], epsilon))
+        {
+            NGRAPH_DEBUG << "Element counts and epsilon must be constants";
+            return false;
+        }
+        if (!is_close(mean_count_value, width) || !is_close(variance_count_value, width) ||
+            epsilon < 0)
+        {
+            NGRAPH_DEBUG << "Mean and variance are not taken over the last axis";
+            return false;
+        }
+
+        auto ln = std::make_shared<op::LayerNorm>(
+            data, pattern_map[gamma], pattern_map[beta], epsilon);
+        ngraph::replace_node(m.get_match_root(), ln);
+        return true;
+    };
+
+    auto m = std::make_shared<pattern::Matcher>(layer_norm, callback, "CPUFusion.LayerNorm");
+    this->add_matcher(m);
+}
+
+void ngraph::runtime::cpu::pass::CPUFusion::construct_gelu()
+{
+    auto broadcast_pred = pattern::has_class<op::Broadcast>();
+    auto input = std::make_shared<pattern::op::Label>(element::f32, Shape{});
+    auto half = std::make_shared<pattern::op::Label>(element::f32, Shape{});
+    auto one = std::make_shared<pattern::op::Label>(element::f32, Shape{});
+    auto sqrt_2_over_pi = std::make_shared<pattern::op::Label>(element::f32, Shape{});
+    auto cubic_coefficient = std::make_shared<pattern::op::Label>(element::f32, Shape{});
+
+    // 0.5 * x * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x * x * x)))
+    auto cube = std::make_shared<op::Multiply>(input, std::make_shared<op::Multiply>(input, input));
+    auto inner = std::make_shared<op::Add>(
+        input,
+        std::make_shared<op::Multiply>(
+            std::make_shared<pattern::op::Skip>(cubic_coefficient, broadcast_pred), cube));
+    auto tanh = std::make_shared<op::Tanh>(std::make_shared<op::Multiply>(
+        std::make_shared<pattern::op::Skip>(sqrt_2_over_pi, broadcast_pred), inner));
+    auto gelu = std::make_shared<op::Multiply>(
+        std::make_shared<op::Multiply>(
+            std::make_shared<pattern::op::Skip>(half, broadcast_pred), input),
+        std::make_shared<op::Add>(std::make_shared<pattern::op::Skip>(one, broadcast_pred),
+                                  tanh));
+
+    pattern::graph_rewrite_callback callback = [input,
+                                                half,
+                                                one,
+                                                sqrt_2_over_pi,
+                                                cubic_coefficient](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for construct_gelu against node = "
+                     << m.get_match_root()->get_name();
+        auto pattern_map = m.get_pattern_map();
+
+        auto et = m.get_match_root()->get_element_type();
+        if (et != element::f32 && et != element::f64)
+        {
+            NGRAPH_DEBUG << "Only f32/f64 Gelu is supported";
+            return false;
+        }
+
+        double half_value, one_value, sqrt_2_over_pi_value, cubic_coefficient_value;
+        if (!get_uniform_constant(pattern_map[half], half_value) ||
+            !get_uniform_constant(pattern_map[one], one_value) ||
+            !get_uniform_constant(pattern_map[sqrt_2_over_pi], sqrt_2_over_pi_value) ||
+            !get_uniform_constant(pattern_map[cubic_coefficient], cubic_coefficient_value))
+        {
+            NGRAPH_DEBUG << "Gelu coefficients must be constants";
+            return false;
+        }
+        if (!is_close(half_value, 0.5) || !is_close(one_value, 1.0) ||
+            !is_close(sqrt_2_over_pi_value, op::Gelu::sqrt_2_over_pi) ||
+            !is_close(cubic_coefficient_value, op::Gelu::cubic_coefficient))
+        {
+            NGRAPH_DEBUG << "Coefficients do not match the tanh approximation of Gelu";
+            return false;
+        }
+
+        auto cg = std::make_shared<op::Gelu>(pattern_map[input]);
+        ngraph::replace_node(m.get_match_root(), cg);
+        return true;
+    };
+
+    auto m = std::make_shared<pattern::Matcher>(gelu, callback, "CPUFusion.Gelu");
+    this->add_matcher(m);
+}
+
+void ngraph::runtime::cpu::pass::CPUFusion::construct_attention()
+{
+    auto softmax = std::make_shared<pattern::op::Label>(
+        element::f32, Shape{2, 3}, pattern::has_class<op::Softmax>());
+    auto value = std::make_shared<pattern::op::Label>(element::f32, Shape{3, 4});
+    auto pdot = std::make_shared<op::Dot>(softmax, value);
+
+    auto batch_softmax = std::make_shared<pattern::op::Label>(
+        element::f32, Shape{2, 2, 3}, pattern::has_class<op::Softmax>());
+    auto batch_value = std::make_shared<pattern::op::Label>(element::f32, Shape{2, 3, 4});
+    auto pbatch_dot = std::make_shared<op::BatchDot>(batch_softmax, batch_value, false, false);
+
+    pattern::graph_rewrite_callback callback = [](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for construct_attention against node = "
+                     << m.get_match_root()->get_name();
+
+        std::shared_ptr<Node> query, key, value;
+        double scale;
+        if (!get_attention_args(m.get_match_root(), query, key, value, scale))
+        {
+            return false;
+        }
+
+        auto attention = std::make_shared<op::ScaledDotProductAttention>(query, key, value, scale);
+        ngraph::replace_node(m.get_match_root(), attention);
+        return true;
+    };
+
+    auto m = std::make_shared<pattern::Matcher>(pdot, callback, "CPUFusion.Attention");
+    this->add_matcher(m);
+    auto mb = std::make_shared<pattern::Matcher>(pbatch_dot, callback, "CPUFusion.BatchAttention");
+    this->add_matcher(mb);
+}
@@ -53,10 +53,15 @@ public:
         {
             construct_conv_bias();
             construct_sigmoid_multiply();
+            construct_layer_norm();
+            construct_gelu();
+            construct_attention();
         }
 
         if (fusions & REGULAR_FUSIONS)
         {
+            construct_quantized_dot();
+            construct_quantized_dot_requantize();
             construct_matmul();
             construct_matmulbias();
             construct_fprop_bn();
@@ -110,4 +115,9 @@ private:
     void construct_groupconv_batchnorm_global_stats_folding_relu();
     void construct_update_slice();
     void construct_fuse_lstm_recurrent_state();
+    void construct_quantized_dot();
+    void construct_quantized_dot_requantize();
+    void construct_layer_norm();
+    void construct_gelu();
+    void construct_attention();
 };
@@ -15,17 +15,22 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <deque>
 #include <iostream>
 #include <map>
 #include <memory>
+#include <set>
 
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/abs.hpp"
 #include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/divide.hpp"
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/maximum.hpp"
 #include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
 #include "ngraph/op/negative.hpp"
 #include "ngraph/op/relu.hpp"
 #include "ngraph/op/subtract.hpp"
@@ -59,8 +64,10 @@ public:
             if (is_fusible(n))
             {
                 auto arg_from_fusible_group = collect_fusible_args(n);
-                // create a new group
-                if (!arg_from_fusible_group)
+                // create a new group, also when joining the group would make one of its own
+                // outputs an input of the group (e.g. a residual add(a, dot(a, w)))
+                if (!arg_from_fusible_group ||
+                    depends_on_group(m_heads.at(arg_from_fusible_group), n->get_arguments()))
                 {
                     m_heads.insert(std::make_pair(n, n));
                     m_graphs.insert(std::make_pair(n, LKGraph{{n}, n->get_arguments()}));
@@ -71,10 +78,17 @@ public:
                 {
                     auto smallest_head = m_heads.at(arg_from_fusible_group);
                     auto& lkgraph = m_graphs.at(smallest_head);
+                    for (auto arg : n->get_arguments())
+                    {
+                        if (arg != smallest_head && is_lone_broadcast(arg))
+                        {
+                            absorb_lone_broadcast(arg, smallest_head);
+                        }
+                    }
                     lkgraph.m_nodes.push_back(n);
                     for (auto arg : n->get_arguments())
                     {
-                        if (is_leaf(arg))
+                        if (m_heads.count(arg) == 0)
                         {
                             lkgraph.m_inputs.push_back(arg);
                         }
@@ -83,6 +97,15 @@ public:
                     log_group(smallest_head);
                 }
             }
+            else
+            {
+                auto& upstream = m_upstream_groups[n];
+                for (auto arg : n->get_arguments())
+                {
+                    auto arg_groups = get_groups(arg);
+                    upstream.insert(arg_groups.begin(), arg_groups.end());
+                }
+            }
         }
 
         prune_graphs(min_nodes_to_fuse);
@@ -111,7 +134,25 @@ private:
                                                                TI(ngraph::op::Subtract),
                                                                TI(ngraph::op::Relu),
                                                                TI(ngraph::op::Minimum),
-                                                               TI(ngraph::op::Maximum)};
+                                                               TI(ngraph::op::Maximum),
+                                                               TI(ngraph::op::Multiply),
+                                                               TI(ngraph::op::Divide)};
+
+        // Broadcasting a single element, or rows along leading or trailing axes, only needs
+        // the input inside the loop
+        if (auto broadcast = std::dynamic_pointer_cast<ngraph::op::Broadcast>(n))
+        {
+            auto arg = broadcast->get_argument(0);
+            return (arg->is_parameter() || arg->is_constant()) &&
+                   runtime::cpu::op::get_loop_broadcast(*broadcast).period != 0;
+        }
+
+        // Integer division has to throw on a zero divisor, which the fused loop can't do
+        if (std::dynamic_pointer_cast<ngraph::op::Divide>(n) &&
+            !n->get_element_type().is_real())
+        {
+            return false;
+        }
 
         const Node& node = *n;
         return fusible_ops_set.count(TI(node)) != 0;
@@ -143,14 +184,38 @@ private:
         NGRAPH_DEBUG << "Inputs: " << m_graphs.at(head).m_inputs << std::endl;
     }
 
+    // A Broadcast in a group of its own that only feeds one node can join that node's group
+    bool is_lone_broadcast(std::shared_ptr<Node> n) const
+    {
+        auto head = m_heads.find(n);
+        return head != m_heads.end() && head->second == n &&
+               m_graphs.at(n).m_nodes.size() == 1 &&
+               std::dynamic_pointer_cast<ngraph::op::Broadcast>(n) && n->get_users().size() == 1;
+    }
+
+    void absorb_lone_broadcast(std::shared_ptr<Node> broadcast, std::shared_ptr<Node> head)
+    {
+        auto& lkgraph = m_graphs.at(head);
+        lkgraph.m_nodes.push_back(broadcast);
+        lkgraph.m_inputs.push_back(broadcast->get_argument(0));
+        m_graphs.erase(broadcast);
+        m_heads[broadcast] = head;
+    }
+
     std::shared_ptr<Node> collect_fusible_args(std::shared_ptr<Node> n)
     {
         std::shared_ptr<Node> arg_from_fusible_group;
+        std::shared_ptr<Node> lone_broadcast;
         for (auto arg : n->get_arguments())
         {
             // an argument is fusible and a part of some group
             NGRAPH_DEBUG << "Considering " << arg->get_name();
-            if (m_heads.count(arg) != 0)
+            if (is_lone_broadcast(arg))
+            {
+                // joins whichever group n ends up in
+                lone_broadcast = arg;
+            }
+            else if (m_heads.count(arg) != 0)
             {
                 if (!arg_from_fusible_group)
                 {
@@ -165,11 +230,62 @@ private:
                 }
             }
         }
-        return arg_from_fusible_group;
+        return arg_from_fusible_group ? arg_from_fusible_group : lone_broadcast;
+    }
+
+    // Returns the head of n's group if n is a member, otherwise the heads of the nearest
+    // groups n depends on
+    std::set<std::shared_ptr<Node>> get_groups(std::shared_ptr<Node> n) const
+    {
+        if (m_heads.count(n) != 0)
+        {
+            return {m_heads.at(n)};
+        }
+        auto it = m_upstream_groups.find(n);
+        return it != m_upstream_groups.end() ? it->second : std::set<std::shared_ptr<Node>>{};
+    }
+
+    // Returns true if any of the args from outside the group led by head transitively depends
+    // on the group. Each group becomes a single LoopKernel, so a dependency through any member
+    // of an intermediate group counts as a dependency on all of it.
+    bool depends_on_group(std::shared_ptr<Node> head, const NodeVector& args) const
+    {
+        std::deque<std::shared_ptr<Node>> work;
+        for (auto arg : args)
+        {
+            if (m_heads.count(arg) == 0)
+            {
+                auto arg_groups = get_groups(arg);
+                work.insert(work.end(), arg_groups.begin(), arg_groups.end());
+            }
+        }
+
+        std::set<std::shared_ptr<Node>> visited;
+        while (!work.empty())
+        {
+            auto group = work.front();
+            work.pop_front();
+            if (group == head)
+            {
+                return true;
+            }
+            if (!visited.insert(group).second)
+            {
+                continue;
+            }
+            for (auto input : m_graphs.at(group).m_inputs)
+            {
+                auto input_groups = get_groups(input);
+                work.insert(work.end(), input_groups.begin(), input_groups.end());
+            }
+        }
+        return false;
     }
 
     std::unordered_map<std::shared_ptr<Node>, LKGraph> m_graphs;
     std::unordered_map<std::shared_ptr<Node>, std::shared_ptr<Node>> m_heads;
+    // nearest upstream groups of every node outside a group
+    std::unordered_map<std::shared_ptr<Node>, std::set<std::shared_ptr<Node>>> m_upstream_groups;
 };
 
 bool ngraph::runtime::cpu::pass::CPULoopKernelFusion::run_on_function(
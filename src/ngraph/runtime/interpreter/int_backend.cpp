@@ -14,6 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstdlib>
+
 #include "ngraph/runtime/interpreter/int_backend.hpp"
 #include "ngraph/descriptor/layout/dense_tensor_layout.hpp"
 #include "ngraph/except.hpp"
@@ -57,15 +59,41 @@ shared_ptr<runtime::Tensor> runtime::interpreter::INTBackend::create_tensor(
 
 runtime::Handle runtime::interpreter::INTBackend::compile(shared_ptr<Function> function)
 {
-    FunctionInstance& instance = m_function_map[function];
-    if (!instance.m_is_compiled)
     {
-        instance.m_is_compiled = true;
+        lock_guard<mutex> lock(m_function_map_mutex);
+        auto it = m_function_map.find(function);
+        if (it != m_function_map.end() && it->second->m_is_compiled)
+        {
+            return function;
+        }
+    }
+
+    // Compiles run one at a time but outside m_function_map_mutex, so calls of functions
+    // that are already compiled never wait for them
+    lock_guard<mutex> compile_lock(m_compile_mutex);
+    shared_ptr<FunctionInstance> instance_ptr;
+    {
+        lock_guard<mutex> lock(m_function_map_mutex);
+        instance_ptr = get_instance(function);
+        if (instance_ptr->m_is_compiled)
+        {
+            // compiled by another thread while this one waited
+            return function;
+        }
+    }
+
+    // call() refuses the instance until it is marked compiled, so the plan is built without
+    // the lock. A half-built plan is dropped if building it fails.
+    FunctionInstance& instance = *instance_ptr;
+    try
+    {
         pass::Manager pass_manager;
         pass_manager.register_pass<pass::LikeReplacement>();
         pass_manager.register_pass<pass::AssignLayout<DenseTensorLayout>>();
         pass_manager.register_pass<pass::Liveness>();
-        pass_manager.register_pass<pass::MemoryLayout>(get_alignment());
+        static const bool s_pack_memory =
+            std::getenv("NGRAPH_INTERPRETER_MEMORY_PACKING") != nullptr;
+        pass_manager.register_pass<pass::MemoryLayout>(get_alignment(), false, s_pack_memory);
         pass_manager.run_passes(function);
 
         size_t memory_pool_size = function->get_temporary_pool_size();
@@ -75,8 +103,84 @@ runtime::Handle runtime::interpreter::INTBackend::compile(shared_ptr<Function> f
         {
             instance.m_wrapped_nodes.emplace_back(node);
         }
+
+        // Give every tensor a slot. Parameters and Results come first, in call order.
+        unordered_map<const descriptor::Tensor*, size_t> tensor_slots;
+        for (auto param : function->get_parameters())
+        {
+            for (size_t i = 0; i < param->get_output_size(); ++i)
+            {
+                tensor_slots.insert({param->get_output_tensor_ptr(i).get(), tensor_slots.size()});
+            }
+        }
+        for (size_t i = 0; i < function->get_output_size(); ++i)
+        {
+            auto output = function->get_output_op(i);
+            if (!dynamic_pointer_cast<op::Result>(output))
+            {
+                throw ngraph_error("One of function's outputs isn't op::Result");
+            }
+            tensor_slots.insert({output->get_output_tensor_ptr(0).get(), tensor_slots.size()});
+        }
+        instance.m_slots.resize(tensor_slots.size(), nullptr);
+
+        for (size_t node_index = 0; node_index < instance.m_wrapped_nodes.size(); ++node_index)
+        {
+            const NodeWrapper& wrapped = instance.m_wrapped_nodes[node_index];
+            const Node* op = &wrapped.get_node();
+            auto type_id = wrapped.get_typeid();
+            if (type_id == OP_TYPEID::Parameter)
+            {
+                continue;
+            }
+            if (type_id == OP_TYPEID::Constant)
+            {
+                const op::Constant* c = static_cast<const op::Constant*>(op);
+                tensor_slots.insert({op->get_output_tensor_ptr(0).get(), instance.m_slots.size()});
+                instance.m_slots.push_back(const_cast<void*>(c->get_data_ptr()));
+                continue;
+            }
+
+            FunctionInstance::ExecutionStep step;
+            step.m_node_index = node_index;
+            step.m_kernel = select_kernel(wrapped, instance);
+            for (const descriptor::Input& input : op->get_inputs())
+            {
+                step.m_input_slots.push_back(
+                    tensor_slots.at(input.get_output().get_tensor_ptr().get()));
+            }
+            for (size_t i = 0; i < op->get_output_size(); ++i)
+            {
+                const descriptor::Tensor* tensor = op->get_output_tensor_ptr(i).get();
+                auto it = tensor_slots.find(tensor);
+                if (it == tensor_slots.end())
+                {
+                    auto offset = op->get_output_tensor(i).get_pool_offset();
+                    it = tensor_slots.insert({tensor, instance.m_slots.size()}).first;
+                    instance.m_slots.push_back(instance.get_temporary_pointer(offset));
+                }
+                step.m_output_slots.push_back(it->second);
+            }
+            step.m_inputs.resize(step.m_input_slots.size());
+            step.m_outputs.resize(step.m_output_slots.size());
+            instance.m_plan.push_back(move(step));
+        }
+    }
+    catch (...)
+    {
+        lock_guard<mutex> lock(m_function_map_mutex);
+        auto it = m_function_map.find(function);
+        if (it != m_function_map.end() && it->second == instance_ptr)
+        {
+            m_function_map.erase(it);
+        }
+        throw;
     }
 
+    lock_guard<mutex> lock(m_function_map_mutex);
+    instance.m_is_compiled = true;
+    // publish again in case the function was removed while it compiled
+    m_function_map[function] = instance_ptr;
     return function;
 }
 
@@ -86,144 +190,70 @@ bool runtime::interpreter::INTBackend::call(shared_ptr<Function> function,
 {
     validate_call(function, outputs, inputs);
 
-    auto fit = m_function_map.find(function);
-    if (fit == m_function_map.end())
+    shared_ptr<FunctionInstance> instance_ptr;
     {
-        throw runtime_error("compile() must be called before call().");
-    }
-    FunctionInstance& instance = fit->second;
-
-    // convert inputs to HostTensor
-    vector<void*> func_inputs;
-    vector<shared_ptr<runtime::HostTensor>> htv_inputs;
-    for (auto tensor : inputs)
-    {
-        auto host_tensor = static_pointer_cast<runtime::HostTensor>(tensor);
-        func_inputs.push_back(static_cast<void*>(host_tensor->get_data_ptr()));
-        htv_inputs.push_back(host_tensor);
-    }
-    if (instance.m_nan_check_enabled)
-    {
-        perform_nan_check(htv_inputs);
+        lock_guard<mutex> lock(m_function_map_mutex);
+        auto fit = m_function_map.find(function);
+        if (fit == m_function_map.end() || !fit->second->m_is_compiled)
+        {
+            throw runtime_error("compile() must be called before call().");
+        }
+        instance_ptr = fit->second;
     }
+    FunctionInstance& instance = *instance_ptr;
+    lock_guard<mutex> call_lock(instance.m_call_mutex);
 
-    // convert outputs to HostTensor
-    vector<void*> func_outputs;
-    for (auto tensor : outputs)
+    // bind the call's tensors to their slots, all other slots were bound by compile()
+    size_t slot = 0;
+    for (const shared_ptr<runtime::Tensor>& tensor : inputs)
     {
-        auto host_tensor = static_pointer_cast<runtime::HostTensor>(tensor);
-        func_outputs.push_back(static_cast<void*>(host_tensor->get_data_ptr()));
+        instance.m_slots[slot++] = static_cast<runtime::HostTensor*>(tensor.get())->get_data_ptr();
     }
-
-    // map function params -> HostTensor
-    unordered_map<descriptor::Tensor*, void*> tensor_map;
-    size_t input_count = 0;
-    for (auto param : function->get_parameters())
+    for (const shared_ptr<runtime::Tensor>& tensor : outputs)
     {
-        for (size_t i = 0; i < param->get_output_size(); ++i)
-        {
-            descriptor::Tensor* tensor = param->get_output_tensor_ptr(i).get();
-            tensor_map.insert({tensor, func_inputs[input_count++]});
-        }
+        instance.m_slots[slot++] = static_cast<runtime::HostTensor*>(tensor.get())->get_data_ptr();
     }
-
-    // map function outputs -> HostTensor
-    for (size_t output_count = 0; output_count < function->get_output_size(); ++output_count)
+    if (instance.m_nan_check_enabled)
     {
-        auto output = function->get_output_op(output_count);
-        if (!dynamic_pointer_cast<op::Result>(output))
+        vector<shared_ptr<runtime::HostTensor>> htv_inputs;
+        for (auto tensor : inputs)
         {
-            throw ngraph_error("One of function's outputs isn't op::Result");
+            htv_inputs.push_back(static_pointer_cast<runtime::HostTensor>(tensor));
         }
-        descriptor::Tensor* tensor = output->get_output_tensor_ptr(0).get();
-        tensor_map.insert({tensor, func_outputs[output_count]});
+        perform_nan_check(htv_inputs);
     }
 
-    // for each ordered op in the graph
-    for (const NodeWrapper& wrapped : instance.m_wrapped_nodes)
+    for (FunctionInstance::ExecutionStep& step : instance.m_plan)
     {
-        const Node* op = &wrapped.get_node();
-        auto type_id = wrapped.get_typeid();
-        if (type_id == OP_TYPEID::Parameter)
+        for (size_t i = 0; i < step.m_input_slots.size(); ++i)
         {
-            continue;
+            step.m_inputs[i] = instance.m_slots[step.m_input_slots[i]];
         }
-        if (type_id == OP_TYPEID::Constant)
+        for (size_t i = 0; i < step.m_output_slots.size(); ++i)
         {
-            const op::Constant* c = static_cast<const op::Constant*>(op);
-            descriptor::Tensor* tensor = op->get_output_tensor_ptr(0).get();
-            tensor_map.insert({tensor, const_cast<void*>(c->get_data_ptr())});
-            continue;
-        }
-        // get op inputs from map
-        vector<const void*> op_inputs;
-        for (const descriptor::Input& input : op->get_inputs())
-        {
-            descriptor::Tensor* tensor = input.get_output().get_tensor_ptr().get();
-            op_inputs.push_back(tensor_map.at(tensor));
+            step.m_outputs[i] = instance.m_slots[step.m_output_slots[i]];
         }
 
-        // get op outputs from map or create
-        vector<void*> op_outputs;
-        vector<shared_ptr<runtime::HostTensor>> htv_outputs;
-        for (size_t i = 0; i < op->get_output_size(); ++i)
-        {
-            descriptor::Tensor* tensor = op->get_output_tensor_ptr(i).get();
-            void* host_tensor = nullptr;
-            auto it = tensor_map.find(tensor);
-            if (it == tensor_map.end())
-            {
-                auto offset = op->get_output_tensor(i).get_pool_offset();
-                host_tensor = instance.get_temporary_pointer(offset);
-                tensor_map.insert({tensor, host_tensor});
-            }
-            else
-            {
-                host_tensor = it->second;
-            }
-            op_outputs.push_back(host_tensor);
-            htv_outputs.push_back(make_shared<runtime::HostTensor>(
-                tensor->get_element_type(), tensor->get_shape(), host_tensor));
-        }
-
-        // get op type
-        element::Type type;
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wswitch-enum"
-        switch (type_id)
-        {
-        case OP_TYPEID::Convert:
-        case OP_TYPEID::Quantize:
-        case OP_TYPEID::Dequantize:
-        case OP_TYPEID::ArgMin:
-        case OP_TYPEID::ArgMax: type = op->get_input_element_type(0); break;
-        case OP_TYPEID::Equal:
-        case OP_TYPEID::Greater:
-        case OP_TYPEID::GreaterEq:
-        case OP_TYPEID::Less:
-        case OP_TYPEID::LessEq:
-        case OP_TYPEID::NotEqual:
-            // Get the type of the second input, not the first
-            // All BinaryElementwiseComparision ops have the same type for inputs
-            // Select has bool for first input and the type we are interested in for the second
-            type = op->get_input_element_type(1);
-            break;
-        case OP_TYPEID::TopK: type = op->get_output_element_type(1); break;
-        default: type = op->get_output_element_type(0); break;
-        }
-#pragma GCC diagnostic pop
-
+        const NodeWrapper& wrapped = instance.m_wrapped_nodes[step.m_node_index];
+        const Node* op = &wrapped.get_node();
         if (instance.m_performance_counters_enabled)
         {
             instance.m_timer_map[op].start();
         }
-        generate_calls(type, wrapped, op_outputs, op_inputs, instance);
+        step.m_kernel(step.m_outputs, step.m_inputs);
         if (instance.m_performance_counters_enabled)
         {
             instance.m_timer_map[op].stop();
         }
         if (instance.m_nan_check_enabled)
         {
+            vector<shared_ptr<runtime::HostTensor>> htv_outputs;
+            for (size_t i = 0; i < op->get_output_size(); ++i)
+            {
+                const descriptor::Tensor& tensor = op->get_output_tensor(i);
+                htv_outputs.push_back(make_shared<runtime::HostTensor>(
+                    tensor.get_element_type(), tensor.get_shape(), step.m_outputs[i]));
+            }
             perform_nan_check(htv_outputs, op);
         }
     }
@@ -231,82 +261,137 @@ bool runtime::interpreter::INTBackend::call(shared_ptr<Function> function,
     return true;
 }
 
-void runtime::interpreter::INTBackend::generate_calls(const element::Type& type,
-                                                      const NodeWrapper& op,
-                                                      const vector<void*>& outputs,
-                                                      const vector<const void*>& inputs,
-                                                      FunctionInstance& instance)
+future<bool>
+    runtime::interpreter::INTBackend::call_async(shared_ptr<Function> function,
+                                                 const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                                 const vector<shared_ptr<runtime::Tensor>>& inputs)
 {
+    return enqueue_call(m_call_queue, function, outputs, inputs);
+}
+
+runtime::interpreter::INTBackend::FunctionInstance::Kernel
+    runtime::interpreter::INTBackend::select_kernel(const NodeWrapper& op,
+                                                    FunctionInstance& instance)
+{
+    const Node* node = &op.get_node();
+
+    // get op type
+    element::Type type;
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wswitch-enum"
+    switch (op.get_typeid())
+    {
+    case OP_TYPEID::Convert:
+    case OP_TYPEID::Quantize:
+    case OP_TYPEID::Dequantize:
+    case OP_TYPEID::ArgMin:
+    case OP_TYPEID::ArgMax: type = node->get_input_element_type(0); break;
+    case OP_TYPEID::Equal:
+    case OP_TYPEID::Greater:
+    case OP_TYPEID::GreaterEq:
+    case OP_TYPEID::Less:
+    case OP_TYPEID::LessEq:
+    case OP_TYPEID::NotEqual:
+        // Get the type of the second input, not the first
+        // All BinaryElementwiseComparision ops have the same type for inputs
+        // Select has bool for first input and the type we are interested in for the second
+        type = node->get_input_element_type(1);
+        break;
+    case OP_TYPEID::TopK: type = node->get_output_element_type(1); break;
+    default: type = node->get_output_element_type(0); break;
+    }
+#pragma GCC diagnostic pop
+
+    FunctionInstance::Kernel kernel;
     if (type == element::boolean)
     {
-        op_engine<char>(op, outputs, inputs, instance);
+        kernel = build_kernel<char>(op, instance);
     }
     else if (type == element::f32)
     {
-        op_engine<float>(op, outputs, inputs, instance);
+        kernel = build_kernel<float>(op, instance);
     }
     else if (type == element::f64)
     {
-        op_engine<double>(op, outputs, inputs, instance);
+        kernel = build_kernel<double>(op, instance);
     }
     else if (type == element::i8)
     {
-        op_engine<int8_t>(op, outputs, inputs, instance);
+        kernel = build_kernel<int8_t>(op, instance);
     }
     else if (type == element::i16)
     {
-        op_engine<int16_t>(op, outputs, inputs, instance);
+        kernel = build_kernel<int16_t>(op, instance);
     }
     else if (type == element::i32)
     {
-        op_engine<int32_t>(op, outputs, inputs, instance);
+        kernel = build_kernel<int32_t>(op, instance);
     }
     else if (type == element::i64)
     {
-        op_engine<int64_t>(op, outputs, inputs, instance);
+        kernel = build_kernel<int64_t>(op, instance);
     }
     else if (type == element::u8)
     {
-        op_engine<uint8_t>(op, outputs, inputs, instance);
+        kernel = build_kernel<uint8_t>(op, instance);
     }
     else if (type == element::u16)
     {
-        op_engine<uint16_t>(op, outputs, inputs, instance);
+        kernel = build_kernel<uint16_t>(op, instance);
     }
     else if (type == element::u32)
     {
-        op_engine<uint32_t>(op, outputs, inputs, instance);
+        kernel = build_kernel<uint32_t>(op, instance);
     }
     else if (type == element::u64)
     {
-        op_engine<uint64_t>(op, outputs, inputs, instance);
+        kernel = build_kernel<uint64_t>(op, instance);
     }
     else
     {
         stringstream ss;
-        ss << "unsupported element type " << type << " op " << op.get_node().get_name();
+        ss << "unsupported element type " << type << " op " << node->get_name();
         throw ngraph_error(ss.str());
     }
+    return kernel;
+}
+
+void runtime::interpreter::INTBackend::remove_compiled_function(shared_ptr<Function> function)
+{
+    lock_guard<mutex> lock(m_function_map_mutex);
+    m_function_map.erase(function);
+}
+
+shared_ptr<runtime::interpreter::INTBackend::FunctionInstance>
+    runtime::interpreter::INTBackend::get_instance(const shared_ptr<Function>& function)
+{
+    shared_ptr<FunctionInstance>& instance = m_function_map[function];
+    if (instance == nullptr)
+    {
+        instance = make_shared<FunctionInstance>();
+    }
+    return instance;
 }
 
 void runtime::interpreter::INTBackend::set_nan_check(shared_ptr<Function> func, bool enable)
 {
-    FunctionInstance& instance = m_function_map[func];
-    instance.m_nan_check_enabled = enable;
+    lock_guard<mutex> lock(m_function_map_mutex);
+    get_instance(func)->m_nan_check_enabled = enable;
 }
 
 void runtime::interpreter::INTBackend::enable_performance_data(shared_ptr<Function> func,
                                                                bool enable)
 {
-    FunctionInstance& instance = m_function_map[func];
-    instance.m_performance_counters_enabled = enable;
+    lock_guard<mutex> lock(m_function_map_mutex);
+    get_instance(func)->m_performance_counters_enabled = enable;
 }
 
 vector<runtime::PerformanceCounter>
     runtime::interpreter::INTBackend::get_performance_data(shared_ptr<Function> func) const
 {
     vector<runtime::PerformanceCounter> rc;
-    const FunctionInstance& instance = m_function_map.at(func);
+    lock_guard<mutex> lock(m_function_map_mutex);
+    const FunctionInstance& instance = *m_function_map.at(func);
     for (const pair<const Node*, stopwatch> p : instance.m_timer_map)
     {
         rc.emplace_back(p.first->get_name().c_str(),
@@ -16,7 +16,9 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -36,6 +38,7 @@
 #include "ngraph/op/embedding_lookup.hpp"
 #include "ngraph/op/experimental/generate_mask.hpp"
 #include "ngraph/op/experimental/shape_of.hpp"
+#include "ngraph/op/gather.hpp"
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/lrn.hpp"
 #include "ngraph/op/max.hpp"
@@ -52,6 +55,7 @@
 #include "ngraph/op/result.hpp"
 #include "ngraph/op/reverse.hpp"
 #include "ngraph/op/reverse_sequence.hpp"
+#include "ngraph/op/scatter_add.hpp"
 #include "ngraph/op/select_and_scatter.hpp"
 #include "ngraph/op/select_and_scatter.hpp"
 #include "ngraph/op/slice.hpp"
@@ -60,6 +64,7 @@
 #include "ngraph/op/topk.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/call_queue.hpp"
 #include "ngraph/runtime/host_tensor.hpp"
 #include "ngraph/runtime/interpreter/node_wrapper.hpp"
 #include "ngraph/runtime/reference/abs.hpp"
@@ -90,6 +95,7 @@
 #include "ngraph/runtime/reference/equal.hpp"
 #include "ngraph/runtime/reference/exp.hpp"
 #include "ngraph/runtime/reference/floor.hpp"
+#include "ngraph/runtime/reference/gather.hpp"
 #include "ngraph/runtime/reference/generate_mask.hpp"
 #include "ngraph/runtime/reference/greater.hpp"
 #include "ngraph/runtime/reference/greater_eq.hpp"
@@ -120,6 +126,7 @@
 #include "ngraph/runtime/reference/result.hpp"
 #include "ngraph/runtime/reference/reverse.hpp"
 #include "ngraph/runtime/reference/reverse_sequence.hpp"
+#include "ngraph/runtime/reference/scatter_add.hpp"
 #include "ngraph/runtime/reference/select.hpp"
 #include "ngraph/runtime/reference/select_and_scatter.hpp"
 #include "ngraph/runtime/reference/shape_of.hpp"
@@ -167,6 +174,12 @@ public:
               const std::vector<std::shared_ptr<Tensor>>& outputs,
               const std::vector<std::shared_ptr<Tensor>>& intputs) override;
 
+    std::future<bool> call_async(std::shared_ptr<Function> function,
+                                 const std::vector<std::shared_ptr<Tensor>>& outputs,
+                                 const std::vector<std::shared_ptr<Tensor>>& inputs) override;
+
+    void remove_compiled_function(std::shared_ptr<Function> function) override;
+
     void set_nan_check(std::shared_ptr<Function> func, bool);
 
     void enable_performance_data(std::shared_ptr<Function> func, bool enable) override;
@@ -176,9 +189,27 @@ public:
     bool is_supported(const Node& node) const override { return true; }
 private:
     int get_alignment() const { return 64; }
+    using KernelOutputs = std::vector<void*>;
+    using KernelInputs = std::vector<const void*>;
     class FunctionInstance
     {
     public:
+        /// \brief Runs one op on the buffers of its outputs and inputs.
+        using Kernel = std::function<void(const KernelOutputs&, const KernelInputs&)>;
+
+        /// \brief One op of the execution plan with its kernel already built for the op's
+        ///     element type, shapes and attributes. The argument vectors are refilled from
+        ///     the slots on every call.
+        struct ExecutionStep
+        {
+            size_t m_node_index;
+            Kernel m_kernel;
+            std::vector<size_t> m_input_slots;
+            std::vector<size_t> m_output_slots;
+            std::vector<const void*> m_inputs;
+            std::vector<void*> m_outputs;
+        };
+
         bool m_is_compiled = false;
         bool m_nan_check_enabled = false;
         bool m_performance_counters_enabled = false;
@@ -186,28 +217,39 @@ private:
         std::vector<NodeWrapper> m_wrapped_nodes;
         std::unordered_map<const Node*, std::shared_ptr<RNGState>> m_states;
         std::shared_ptr<AlignedBuffer> m_temporary_memory;
+        // Calls share m_temporary_memory so they are serialized per function
+        std::mutex m_call_mutex;
+        // Buffer of every tensor in the function. The first slots hold the call's inputs
+        // followed by its outputs and are bound per call, the rest are bound by compile().
+        std::vector<void*> m_slots;
+        std::vector<ExecutionStep> m_plan;
 
         void* get_temporary_pointer(size_t offset) { return m_temporary_memory->get_ptr(offset); }
     };
-    std::map<std::shared_ptr<Function>, FunctionInstance> m_function_map;
+    // Instances are shared with the calls running them, so a function can be removed while
+    // it is being called
+    std::map<std::shared_ptr<Function>, std::shared_ptr<FunctionInstance>> m_function_map;
+    mutable std::mutex m_function_map_mutex;
+    // Serializes compile() without holding m_function_map_mutex
+    std::mutex m_compile_mutex;
+    /// \brief Returns the instance of `function`, adding an empty one if there is none.
+    ///     m_function_map_mutex must be held.
+    std::shared_ptr<FunctionInstance> get_instance(const std::shared_ptr<Function>& function);
+    // Declared last so that queued calls drain before the functions are released
+    std::unique_ptr<CallQueue> m_call_queue;
 
     static void perform_nan_check(const std::vector<std::shared_ptr<HostTensor>>&,
                                   const Node* op = nullptr);
 
-    void generate_calls(const element::Type& type,
-                        const NodeWrapper& op,
-                        const std::vector<void*>& outputs,
-                        const std::vector<const void*>& inputs,
-                        FunctionInstance& instance);
+    FunctionInstance::Kernel select_kernel(const NodeWrapper& op, FunctionInstance& instance);
 
+    /// \brief Builds the kernel of one op for element type `T`. Everything the op reads
+    ///     from the node is looked up here, so the kernel only touches the buffers.
     template <typename T>
-    void op_engine(const NodeWrapper& node_wrapper,
-                   const std::vector<void*>& out,
-                   const std::vector<const void*>& args,
-                   FunctionInstance& instance)
+    FunctionInstance::Kernel build_kernel(const NodeWrapper& node_wrapper,
+                                          FunctionInstance& instance)
     {
         const Node& node = node_wrapper.get_node();
-        std::string node_op = node.description();
 
 // We want to check that every OP_TYPEID enumeration is included in the list.
 // These GCC flags enable compile-time checking so that if an enumeration
@@ -221,144 +263,190 @@ private:
         case OP_TYPEID::Abs:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::abs<T>(
-                static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
-            break;
+            return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+                reference::abs<T>(
+                    static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
+            };
         }
         case OP_TYPEID::Acos:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::acos<T>(
-                static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
-            break;
+            return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+                reference::acos<T>(
+                    static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
+            };
         }
         case OP_TYPEID::Add:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::add<T>(static_cast<const T*>(args[0]),
-                              static_cast<const T*>(args[1]),
-                              static_cast<T*>(out[0]),
-                              element_count);
-            break;
+            return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+                reference::add<T>(static_cast<const T*>(args[0]),
+                                  static_cast<const T*>(args[1]),
+                                  static_cast<T*>(out[0]),
+                                  element_count);
+            };
         }
         case OP_TYPEID::All:
         {
             const op::All* all = static_cast<const op::All*>(&node);
-            reference::all(static_cast<const char*>(args[0]),
-                           static_cast<char*>(out[0]),
-                           node.get_input_shape(0),
-                           node.get_output_shape(0),
-                           all->get_reduction_axes());
-            break;
-        }
-        case OP_TYPEID::AllReduce: {
+            Shape in_shape = node.get_input_shape(0);
+            Shape out_shape = node.get_output_shape(0);
+            AxisSet reduction_axes = all->get_reduction_axes();
+            return [in_shape, out_shape, reduction_axes](const KernelOutputs& out,
+                                                         const KernelInputs& args) {
+                reference::all(static_cast<const char*>(args[0]),
+                               static_cast<char*>(out[0]),
+                               in_shape,
+                               out_shape,
+                               reduction_axes);
+            };
+        }
+        case OP_TYPEID::AllReduce:
+        {
 #ifdef NGRAPH_DISTRIBUTED
-            reference::allreduce<T>(static_cast<T*>(const_cast<void*>(args[0])),
-                                    static_cast<T*>(out[0]),
-                                    node.get_input_element_type(0),
-                                    static_cast<int>(shape_size(node.get_input_shape(0))));
+            element::Type element_type = node.get_input_element_type(0);
+            int element_count = static_cast<int>(shape_size(node.get_input_shape(0)));
+            return [element_type, element_count](const KernelOutputs& out,
+                                                 const KernelInputs& args) {
+                reference::allreduce<T>(static_cast<T*>(const_cast<void*>(args[0])),
+                                        static_cast<T*>(out[0]),
+                                        element_type,
+                                        element_count);
+            };
+#else
+            return [](const KernelOutputs&, const KernelInputs&) {};
 #endif
-            break;
         }
         case OP_TYPEID::And:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::logical_and(static_cast<const T*>(args[0]),
-                                   static_cast<const T*>(args[1]),
-                                   static_cast<T*>(out[0]),
-                                   element_count);
-            break;
+            return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+                reference::logical_and(static_cast<const T*>(args[0]),
+                                       static_cast<const T*>(args[1]),
+                                       static_cast<T*>(out[0]),
+                                       element_count);
+            };
         }
         case OP_TYPEID::Any:
         {
             const op::Any* any = static_cast<const op::Any*>(&node);
-            reference::any(static_cast<const char*>(args[0]),
-                           static_cast<char*>(out[0]),
-                           node.get_input_shape(0),
-                           node.get_output_shape(0),
-                           any->get_reduction_axes());
-            break;
+            Shape in_shape = node.get_input_shape(0);
+            Shape out_shape = node.get_output_shape(0);
+            AxisSet reduction_axes = any->get_reduction_axes();
+            return [in_shape, out_shape, reduction_axes](const KernelOutputs& out,
+                                                         const KernelInputs& args) {
+                reference::any(static_cast<const char*>(args[0]),
+                               static_cast<char*>(out[0]),
+                               in_shape,
+                               out_shape,
+                               reduction_axes);
+            };
         }
         case OP_TYPEID::ArgMin:
         {
             const op::ArgMin* argmin = static_cast<const op::ArgMin*>(&node);
             auto element_type = node.get_output_element_type(0);
+            Shape in_shape = node.get_input_shape(0);
+            Shape out_shape = node.get_output_shape(0);
+            size_t axis = argmin->get_reduction_axis();
             if (element_type == element::i64)
             {
-                reference::argmin<T, int64_t>(static_cast<const T*>(args[0]),
-                                              static_cast<int64_t*>(out[0]),
-                                              node.get_input_shape(0),
-                                              node.get_output_shape(0),
-                                              argmin->get_reduction_axis());
+                return [in_shape, out_shape, axis](const KernelOutputs& out,
+                                                   const KernelInputs& args) {
+                    reference::argmin<T, int64_t>(static_cast<const T*>(args[0]),
+                                                  static_cast<int64_t*>(out[0]),
+                                                  in_shape,
+                                                  out_shape,
+                                                  axis);
+                };
             }
             else if (element_type == element::i32)
             {
-                reference::argmin<T, int32_t>(static_cast<const T*>(args[0]),
-                                              static_cast<int32_t*>(out[0]),
-                                              node.get_input_shape(0),
-                                              node.get_output_shape(0),
-                                              argmin->get_reduction_axis());
+                return [in_shape, out_shape, axis](const KernelOutputs& out,
+                                                   const KernelInputs& args) {
+                    reference::argmin<T, int32_t>(static_cast<const T*>(args[0]),
+                                                  static_cast<int32_t*>(out[0]),
+                                                  in_shape,
+                                                  out_shape,
+                                                  axis);
+                };
             }
             else
             {
                 throw ngraph_error("Unexpected type");
             }
-            break;
         }
         case OP_TYPEID::ArgMax:
         {
             const op::ArgMax* argmax = static_cast<const op::ArgMax*>(&node);
             auto element_type = node.get_output_element_type(0);
+            Shape in_shape = node.get_input_shape(0);
+            Shape out_shape = node.get_output_shape(0);
+            size_t axis = argmax->get_reduction_axis();
             if (element_type == element::i64)
             {
-                reference::argmax<T, int64_t>(static_cast<const T*>(args[0]),
-                                              static_cast<int64_t*>(out[0]),
-                                              node.get_input_shape(0),
-                                              node.get_output_shape(0),
-                                              argmax->get_reduction_axis());
+                return [in_shape, out_shape, axis](const KernelOutputs& out,
+                                                   const KernelInputs& args) {
+                    reference::argmax<T, int64_t>(static_cast<const T*>(args[0]),
+                                                  static_cast<int64_t*>(out[0]),
+                                                  in_shape,
+                                                  out_shape,
+                                                  axis);
+                };
             }
             else if (element_type == element::i32)
             {
-                reference::argmax<T, int32_t>(static_cast<const T*>(args[0]),
-                                              static_cast<int32_t*>(out[0]),
-                                              node.get_input_shape(0),
-                                              node.get_output_shape(0),
-                                              argmax->get_reduction_axis());
+                return [in_shape, out_shape, axis](const KernelOutputs& out,
+                                                   const KernelInputs& args) {
+                    reference::argmax<T, int32_t>(static_cast<const T*>(args[0]),
+                                                  static_cast<int32_t*>(out[0]),
+                                                  in_shape,
+                                                  out_shape,
+                                                  axis);
+                };
             }
             else
             {
                 throw ngraph_error("Unexpected type");
             }
-            break;
         }
         case OP_TYPEID::Asin:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::asin<T>(
-                static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
-            break;
+            return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+                reference::asin<T>(
+                    static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
+            };
         }
         case OP_TYPEID::Atan:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::atan<T>(
-                static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
-            break;
+            return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+                reference::atan<T>(
+                    static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
+            };
         }
         case OP_TYPEID::AvgPool:
         {
             const op::AvgPool* avg_pool = static_cast<const op::AvgPool*>(&node);
-
-            reference::avg_pool<T>(static_cast<const T*>(args[0]),
-                                   static_cast<T*>(out[0]),
-                                   node.get_input_shape(0),
-                                   node.get_output_shape(0),
-                                   avg_pool->get_window_shape(),
-                                   avg_pool->get_window_movement_strides(),
-                                   avg_pool->get_padding_below(),
-                                   avg_pool->get_padding_above(),
-                                   avg_pool->get_include_padding_in_avg_computation());
-            break;
+            Shape in_shape = node.get_input_shape(0);
+            Shape out_shape = node.get_output_shape(0);
+            Shape window_shape = avg_pool->get_window_shape();
+            Strides window_movement_strides = avg_pool->get_window_movement_strides();
+            Shape padding_below = avg_pool->get_padding_below();
+            Shape padding_above = avg_pool->get_padding_above();
+            bool include_padding = avg_pool->get_include_padding_in_avg_computation();
+            return [=](const KernelOutputs& out, const KernelInputs& args) {
+                reference::avg_pool<T>(static_cast<const T*>(args[0]),
+                                       static_cast<T*>(out[0]),
+                                       in_shape,
+                                       out_shape,
+                                       window_shape,
+                                       window_movement_strides,
+                                       padding_below,
+                                       padding_above,
+                                       include_padding);
+            };
         }
         case OP_TYPEID::GenerateMask:
         {
@@ -368,13 +456,14 @@ private:
                 instance.m_states[&node] = std::unique_ptr<ngraph::RNGState>(
                     ngraph::RNGState::create_rng_state(gm->get_seed(), gm->get_probability()));
             }
-
-            bool training = static_cast<bool>(static_cast<const T*>(args[0])[0]);
-            auto state = instance.m_states.at(&node).get();
+            // The instance owns the state and outlives its kernels
+            RNGState* state = instance.m_states.at(&node).get();
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::generate_mask<T>(
-                reinterpret_cast<T*>(out[0]), element_count, state, training);
-            break;
+            return [state, element_count](const KernelOutputs& out, const KernelInputs& args) {
+                bool training = static_cast<bool>(static_cast<const T*>(args[0])[0]);
+                reference::generate_mask<T>(
+                    reinterpret_cast<T*>(out[0]), element_count, state, training);
+            };
         }
         case OP_TYPEID::GetOutputElement:
         {
@@ -383,67 +472,85 @@ private:
             size_t n = get_output_element->get_n();
             size_t element_count = shape_size(node.get_output_shape(0));
             size_t num_bytes = element_count * node.get_output_element_type(0).size();
-            std::memcpy(static_cast<T*>(out[0]), args[n], num_bytes);
-            break;
+            return [n, num_bytes](const KernelOutputs& out, const KernelInputs& args) {
+                std::memcpy(static_cast<T*>(out[0]), args[n], num_bytes);
+            };
         }
         case OP_TYPEID::BatchNormTraining:
         {
             const ngraph::op::BatchNormTraining* bn =
                 static_cast<const ngraph::op::BatchNormTraining*>(&node);
-            reference::batch_norm_training<T>(bn->get_eps_value(),
-                                              static_cast<const T*>(args[0]),
-                                              static_cast<const T*>(args[1]),
-                                              static_cast<const T*>(args[2]),
-                                              static_cast<T*>(out[0]),
-                                              static_cast<T*>(out[1]),
-                                              static_cast<T*>(out[2]),
-                                              node.get_input_shape(2));
-            break;
+            double eps = bn->get_eps_value();
+            Shape channel_shape = node.get_input_shape(2);
+            return [eps, channel_shape](const KernelOutputs& out, const KernelInputs& args) {
+                reference::batch_norm_training<T>(eps,
+                                                  static_cast<const T*>(args[0]),
+                                                  static_cast<const T*>(args[1]),
+                                                  static_cast<const T*>(args[2]),
+                                                  static_cast<T*>(out[0]),
+                                                  static_cast<T*>(out[1]),
+                                                  static_cast<T*>(out[2]),
+                                                  channel_shape);
+            };
         }
         case OP_TYPEID::BatchNormInference:
         {
             const ngraph::op::BatchNormInference* bn =
                 static_cast<const ngraph::op::BatchNormInference*>(&node);
-            reference::batch_norm_inference<T>(bn->get_eps_value(),
+            double eps = bn->get_eps_value();
+            Shape channel_shape = node.get_input_shape(2);
+            return [eps, channel_shape](const KernelOutputs& out, const KernelInputs& args) {
+                reference::batch_norm_inference<T>(eps,
+                                                   static_cast<const T*>(args[0]),
+                                                   static_cast<const T*>(args[1]),
+                                                   static_cast<const T*>(args[2]),
+                                                   static_cast<const T*>(args[3]),
+                                                   static_cast<const T*>(args[4]),
+                                                   static_cast<T*>(out[0]),
+                                                   channel_shape);
+            };
+        }
+        case OP_TYPEID::BatchNormTrainingBackprop:
+        {
+            const ngraph::op::BatchNormTrainingBackprop* bn_bprop =
+                static_cast<const ngraph::op::BatchNormTrainingBackprop*>(&node);
+            double eps = bn_bprop->get_eps_value();
+            Shape channel_shape = node.get_input_shape(2);
+            return [eps, channel_shape](const KernelOutputs& out, const KernelInputs& args) {
+                reference::batch_norm_backprop(eps,
                                                static_cast<const T*>(args[0]),
                                                static_cast<const T*>(args[1]),
                                                static_cast<const T*>(args[2]),
                                                static_cast<const T*>(args[3]),
                                                static_cast<const T*>(args[4]),
+                                               static_cast<const T*>(args[5]),
                                                static_cast<T*>(out[0]),
-                                               node.get_input_shape(2));
-            break;
-        }
-        case OP_TYPEID::BatchNormTrainingBackprop:
-        {
-            const ngraph::op::BatchNormTrainingBackprop* bn_bprop =
-                static_cast<const ngraph::op::BatchNormTrainingBackprop*>(&node);
-            reference::batch_norm_backprop(bn_bprop->get_eps_value(),
-                                           static_cast<const T*>(args[0]),
-                                           static_cast<const T*>(args[1]),
-                                           static_cast<const T*>(args[2]),
-                                           static_cast<const T*>(args[3]),
-                                           static_cast<const T*>(args[4]),
-                                           static_cast<const T*>(args[5]),
-                                           static_cast<T*>(out[0]),
-                                           static_cast<T*>(out[1]),
-                                           static_cast<T*>(out[2]),
-                                           node.get_input_shape(2));
-            break;
+                                               static_cast<T*>(out[1]),
+                                               static_cast<T*>(out[2]),
+                                               channel_shape);
+            };
         }
         case OP_TYPEID::AvgPoolBackprop:
         {
             const op::AvgPoolBackprop* apb = static_cast<const op::AvgPoolBackprop*>(&node);
-            reference::avg_pool_backprop<T>(static_cast<const T*>(args[0]),
-                                            static_cast<T*>(out[0]),
-                                            node.get_input_shape(0),
-                                            node.get_output_shape(0),
-                                            apb->get_window_shape(),
-                                            apb->get_window_movement_strides(),
-                                            apb->get_padding_below(),
-                                            apb->get_padding_above(),
-                                            apb->get_include_padding_in_avg_computation());
-            break;
+            Shape in_shape = node.get_input_shape(0);
+            Shape out_shape = node.get_output_shape(0);
+            Shape window_shape = apb->get_window_shape();
+            Strides window_movement_strides = apb->get_window_movement_strides();
+            Shape padding_below = apb->get_padding_below();
+            Shape padding_above = apb->get_padding_above();
+            bool include_padding = apb->get_include_padding_in_avg_computation();
+            return [=](const KernelOutputs& out, const KernelInputs& args) {
+                reference::avg_pool_backprop<T>(static_cast<const T*>(args[0]),
+                                                static_cast<T*>(out[0]),
+                                                in_shape,
+                                                out_shape,
+                                                window_shape,
+                                                window_movement_strides,
+                                                padding_below,
+                                                padding_above,
+                                                include_padding);
+            };
         }
         case OP_TYPEID::Broadcast:
         {
@@ -451,44 +558,52 @@ private:
             Shape in_shape = node.get_input_shape(0);
             Shape out_shape = node.get_output_shape(0);
             AxisSet broadcast_axes = broadcast->get_broadcast_axes();
-            reference::broadcast<T>(static_cast<const T*>(args[0]),
-                                    static_cast<T*>(out[0]),
-                                    in_shape,
-                                    out_shape,
-                                    broadcast_axes);
-            break;
+            return [in_shape, out_shape, broadcast_axes](const KernelOutputs& out,
+                                                         const KernelInputs& args) {
+                reference::broadcast<T>(static_cast<const T*>(args[0]),
+                                        static_cast<T*>(out[0]),
+                                        in_shape,
+                                        out_shape,
+                                        broadcast_axes);
+            };
         }
-        case OP_TYPEID::BroadcastLike: break;
+        case OP_TYPEID::BroadcastLike: return [](const KernelOutputs&, const KernelInputs&) {};
         case OP_TYPEID::Ceiling:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::ceiling<T>(
-                static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
-            break;
+            return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+                reference::ceiling<T>(
+                    static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
+            };
         }
         case OP_TYPEID::Concat:
         {
             const op::Concat* concat = static_cast<const op::Concat*>(&node);
-            std::vector<const T*> in_args;
             std::vector<Shape> in_shapes;
             for (size_t i = 0; i < node.get_input_size(); i++)
             {
-                in_args.push_back(static_cast<const T*>(args[i]));
                 in_shapes.push_back(node.get_input_shape(i));
             }
-            reference::concat<T>(in_args,
-                                 static_cast<T*>(out[0]),
-                                 in_shapes,
-                                 node.get_output_shape(0),
-                                 concat->get_concatenation_axis());
-            break;
+            Shape out_shape = node.get_output_shape(0);
+            size_t axis = concat->get_concatenation_axis();
+            return [in_shapes, out_shape, axis](const KernelOutputs& out,
+                                                const KernelInputs& args) {
+                std::vector<const T*> in_args;
+                for (size_t i = 0; i < in_shapes.size(); i++)
+                {
+                    in_args.push_back(static_cast<const T*>(args[i]));
+                }
+                reference::concat<T>(
+                    in_args, static_cast<T*>(out[0]), in_shapes, out_shape, axis);
+            };
         }
         case OP_TYPEID::Constant:
         {
-            // Constant is handled in the main loop
-            break;
+            // Constants are bound to their slots by compile()
+            return [](const KernelOutputs&, const KernelInputs&) {};
         }
-        case OP_TYPEID::ScalarConstantLike: break;
+        case OP_TYPEID::ScalarConstantLike:
+            return [](const KernelOutputs&, const KernelInputs&) {};
         case OP_TYPEID::Convert:
         {
             // const op::Convert* c = static_cast<const op::Convert*>(&node);
@@ -496,58 +611,47 @@ private:
             size_t element_count = shape_size(node.get_output_shape(0));
             if (type == element::boolean)
             {
-                reference::convert<T>(
-                    static_cast<const T*>(args[0]), static_cast<char*>(out[0]), element_count);
+                return build_convert<T, char>(element_count);
             }
             else if (type == element::f32)
             {
-                reference::convert<T>(
-                    static_cast<const T*>(args[0]), static_cast<float*>(out[0]), element_count);
+                return build_convert<T, float>(element_count);
             }
             else if (type == element::f64)
             {
-                reference::convert<T>(
-                    static_cast<const T*>(args[0]), static_cast<double*>(out[0]), element_count);
+                return build_convert<T, double>(element_count);
             }
             else if (type == element::i8)
             {
-                reference::convert<T>(
-                    static_cast<const T*>(args[0]), static_cast<int8_t*>(out[0]), element_count);
+                return build_convert<T, int8_t>(element_count);
             }
             else if (type == element::i16)
             {
-                reference::convert<T>(
-                    static_cast<const T*>(args[0]), static_cast<int16_t*>(out[0]), element_count);
+                return build_convert<T, int16_t>(element_count);
             }
             else if (type == element::i32)
             {
-                reference::convert<T>(
-                    static_cast<const T*>(args[0]), static_cast<int32_t*>(out[0]), element_count);
+                return build_convert<T, int32_t>(element_count);
             }
             else if (type == element::i64)
             {
-                reference::convert<T>(
-                    static_cast<const T*>(args[0]), static_cast<int64_t*>(out[0]), element_count);
+                return build_convert<T, int64_t>(element_count);
             }
             else if (type == element::u8)
             {
-                reference::convert<T>(
-                    static_cast<const T*>(args[0]), static_cast<uint8_t*>(out[0]), element_count);
+                return build_convert<T, uint8_t>(element_count);
             }
             else if (type == element::u16)
             {
-                reference::convert<T>(
-                    static_cast<const T*>(args[0]), static_cast<uint16_t*>(out[0]), element_count);
+                return build_convert<T, uint16_t>(element_count);
             }
             else if (type == element::u32)
             {
-                reference::convert<T>(
-                    static_cast<const T*>(args[0]), static_cast<uint32_t*>(out[0]), element_count);
+                return build_convert<T, uint32_t>(element_count);
             }
             else if (type == element::u64)
             {
-                reference::convert<T>(
-                    static_cast<const T*>(args[0]), static_cast<uint64_t*>(out[0]), element_count);
+                return build_convert<T, uint64_t>(element_count);
             }
             else
             {
@@ -555,118 +659,155 @@ private:
                 ss << "unsupported element type " << type << " op Convert";
                 throw std::runtime_error(ss.str());
             }
-            break;
         }
         case OP_TYPEID::Convolution:
         {
             const op::Convolution* c = static_cast<const op::Convolution*>(&node);
-            reference::convolution<T>(static_cast<const T*>(args[0]),
-                                      static_cast<const T*>(args[1]),
-                                      static_cast<T*>(out[0]),
-                                      node.get_input_shape(0),
-                                      node.get_input_shape(1),
-                                      node.get_output_shape(0),
-                                      c->get_window_movement_strides(),
-                                      c->get_window_dilation_strides(),
-                                      c->get_padding_below(),
-                                      c->get_padding_above(),
-                                      c->get_data_dilation_strides(),
-                                      0,
-                                      1,
-                                      1,
-                                      0,
-                                      0,
-                                      1,
-                                      false);
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            Shape out_shape = node.get_output_shape(0);
+            Strides window_movement_strides = c->get_window_movement_strides();
+            Strides window_dilation_strides = c->get_window_dilation_strides();
+            CoordinateDiff padding_below = c->get_padding_below();
+            CoordinateDiff padding_above = c->get_padding_above();
+            Strides data_dilation_strides = c->get_data_dilation_strides();
+            return [=](const KernelOutputs& out, const KernelInputs& args) {
+                reference::convolution<T>(static_cast<const T*>(args[0]),
+                                          static_cast<const T*>(args[1]),
+                                          static_cast<T*>(out[0]),
+                                          arg0_shape,
+                                          arg1_shape,
+                                          out_shape,
+                                          window_movement_strides,
+                                          window_dilation_strides,
+                                          padding_below,
+                                          padding_above,
+                                          data_dilation_strides,
+                                          0,
+                                          1,
+                                          1,
+                                          0,
+                                          0,
+                                          1,
+                                          false);
+            };
         }
         case OP_TYPEID::ConvolutionBackpropFilters:
         {
             const op::ConvolutionBackpropFilters* c =
                 static_cast<const op::ConvolutionBackpropFilters*>(&node);
-            reference::convolution<T>(static_cast<const T*>(args[0]),
-                                      static_cast<const T*>(args[1]),
-                                      static_cast<T*>(out[0]),
-                                      node.get_input_shape(0),
-                                      node.get_input_shape(1),
-                                      node.get_output_shape(0),
-                                      c->get_window_movement_strides_backward(),
-                                      c->get_window_dilation_strides_backward(),
-                                      c->get_padding_below_backward(),
-                                      c->get_padding_above_backward(),
-                                      c->get_data_dilation_strides_backward(),
-                                      1,
-                                      0,
-                                      0,
-                                      1,
-                                      1,
-                                      0,
-                                      false);
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            Shape out_shape = node.get_output_shape(0);
+            Strides window_movement_strides = c->get_window_movement_strides_backward();
+            Strides window_dilation_strides = c->get_window_dilation_strides_backward();
+            CoordinateDiff padding_below = c->get_padding_below_backward();
+            CoordinateDiff padding_above = c->get_padding_above_backward();
+            Strides data_dilation_strides = c->get_data_dilation_strides_backward();
+            return [=](const KernelOutputs& out, const KernelInputs& args) {
+                reference::convolution<T>(static_cast<const T*>(args[0]),
+                                          static_cast<const T*>(args[1]),
+                                          static_cast<T*>(out[0]),
+                                          arg0_shape,
+                                          arg1_shape,
+                                          out_shape,
+                                          window_movement_strides,
+                                          window_dilation_strides,
+                                          padding_below,
+                                          padding_above,
+                                          data_dilation_strides,
+                                          1,
+                                          0,
+                                          0,
+                                          1,
+                                          1,
+                                          0,
+                                          false);
+            };
         }
         case OP_TYPEID::ConvolutionBackpropData:
         {
             // Note that args[1] and args[0] are switched here from the usual order.
             const op::ConvolutionBackpropData* c =
                 static_cast<const op::ConvolutionBackpropData*>(&node);
-            reference::convolution<T>(static_cast<const T*>(args[1]),
-                                      static_cast<const T*>(args[0]),
-                                      static_cast<T*>(out[0]),
-                                      node.get_input_shape(1),
-                                      node.get_input_shape(0),
-                                      node.get_output_shape(0),
-                                      c->get_window_movement_strides_backward(),
-                                      c->get_window_dilation_strides_backward(),
-                                      c->get_padding_below_backward(),
-                                      c->get_padding_above_backward(),
-                                      c->get_data_dilation_strides_backward(),
-                                      0,
-                                      1,
-                                      0,
-                                      1,
-                                      0,
-                                      1,
-                                      true);
-            break;
+            Shape arg0_shape = node.get_input_shape(1);
+            Shape arg1_shape = node.get_input_shape(0);
+            Shape out_shape = node.get_output_shape(0);
+            Strides window_movement_strides = c->get_window_movement_strides_backward();
+            Strides window_dilation_strides = c->get_window_dilation_strides_backward();
+            CoordinateDiff padding_below = c->get_padding_below_backward();
+            CoordinateDiff padding_above = c->get_padding_above_backward();
+            Strides data_dilation_strides = c->get_data_dilation_strides_backward();
+            return [=](const KernelOutputs& out, const KernelInputs& args) {
+                reference::convolution<T>(static_cast<const T*>(args[1]),
+                                          static_cast<const T*>(args[0]),
+                                          static_cast<T*>(out[0]),
+                                          arg0_shape,
+                                          arg1_shape,
+                                          out_shape,
+                                          window_movement_strides,
+                                          window_dilation_strides,
+                                          padding_below,
+                                          padding_above,
+                                          data_dilation_strides,
+                                          0,
+                                          1,
+                                          0,
+                                          1,
+                                          0,
+                                          1,
+                                          true);
+            };
         }
         case OP_TYPEID::Cos:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::cos<T>(
-                static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
-            break;
+            return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+                reference::cos<T>(
+                    static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
+            };
         }
         case OP_TYPEID::Cosh:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::cosh<T>(
-                static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
-            break;
+            return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+                reference::cosh<T>(
+                    static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
+            };
         }
         case OP_TYPEID::Dequantize:
         {
             const op::Dequantize* dequantize = static_cast<const op::Dequantize*>(&node);
             auto type = dequantize->get_element_type();
+            Shape in_shape = node.get_input_shape(0);
+            Shape scale_shape = node.get_input_shape(1);
+            AxisSet axes = dequantize->get_axes();
 
             if (type == element::f32)
             {
-                reference::dequantize<T>(static_cast<const T*>(args[0]),
-                                         static_cast<const float*>(args[1]),
-                                         static_cast<const T*>(args[2]),
-                                         static_cast<float*>(out[0]),
-                                         node.get_input_shape(0),
-                                         node.get_input_shape(1),
-                                         dequantize->get_axes());
+                return [in_shape, scale_shape, axes](const KernelOutputs& out,
+                                                     const KernelInputs& args) {
+                    reference::dequantize<T>(static_cast<const T*>(args[0]),
+                                             static_cast<const float*>(args[1]),
+                                             static_cast<const T*>(args[2]),
+                                             static_cast<float*>(out[0]),
+                                             in_shape,
+                                             scale_shape,
+                                             axes);
+                };
             }
             else if (type == element::f64)
             {
-                reference::dequantize<T>(static_cast<const T*>(args[0]),
-                                         static_cast<const double*>(args[1]),
-                                         static_cast<const T*>(args[2]),
-                                         static_cast<double*>(out[0]),
-                                         node.get_input_shape(0),
-                                         node.get_input_shape(1),
-                                         dequantize->get_axes());
+                return [in_shape, scale_shape, axes](const KernelOutputs& out,
+                                                     const KernelInputs& args) {
+                    reference::dequantize<T>(static_cast<const T*>(args[0]),
+                                             static_cast<const double*>(args[1]),
+                                             static_cast<const T*>(args[2]),
+                                             static_cast<double*>(out[0]),
+                                             in_shape,
+                                             scale_shape,
+                                             axes);
+                };
             }
             else
             {
@@ -674,373 +815,440 @@ private:
                 ss << "unsupported element type " << type << " op Dequantize";
                 throw std::runtime_error(ss.str());
             }
-
-            break;
         }
         case OP_TYPEID::Divide:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::divide<T>(static_cast<const T*>(args[0]),
-                                 static_cast<const T*>(args[1]),
-                                 static_cast<T*>(out[0]),
-                                 element_count);
-            break;
+            return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+                reference::divide<T>(static_cast<const T*>(args[0]),
+                                     static_cast<const T*>(args[1]),
+                                     static_cast<T*>(out[0]),
+                                     element_count);
+            };
         }
         case OP_TYPEID::Dot:
         {
             const op::Dot* dot = static_cast<const op::Dot*>(&node);
-
-            reference::dot(static_cast<const T*>(args[0]),
-                           static_cast<const T*>(args[1]),
-                           static_cast<T*>(out[0]),
-                           node.get_input_shape(0),
-                           node.get_input_shape(1),
-                           node.get_output_shape(0),
-                           dot->get_reduction_axes_count());
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            Shape out_shape = node.get_output_shape(0);
+            size_t reduction_axes_count = dot->get_reduction_axes_count();
+            return [arg0_shape, arg1_shape, out_shape, reduction_axes_count](
+                const KernelOutputs& out, const KernelInputs& args) {
+                reference::dot(static_cast<const T*>(args[0]),
+                               static_cast<const T*>(args[1]),
+                               static_cast<T*>(out[0]),
+                               arg0_shape,
+                               arg1_shape,
+                               out_shape,
+                               reduction_axes_count);
+            };
         }
         case OP_TYPEID::EmbeddingLookup:
         {
             const op::EmbeddingLookup* embed = static_cast<const op::EmbeddingLookup*>(&node);
             auto type = embed->get_argument(0)->get_element_type();
             size_t element_count = shape_size(embed->get_argument(0)->get_shape());
+            Shape weights_shape = embed->get_argument(1)->get_shape();
 
             if (type == element::f32)
             {
-                reference::embedding<T, float>(static_cast<const float*>(args[0]),
-                                               static_cast<const T*>(args[1]),
-                                               static_cast<T*>(out[0]),
-                                               element_count,
-                                               embed->get_shape());
+                return build_embedding<T, float>(element_count, weights_shape);
             }
             else if (type == element::f64)
             {
-                reference::embedding<T, double>(static_cast<const double*>(args[0]),
-                                                static_cast<const T*>(args[1]),
-                                                static_cast<T*>(out[0]),
-                                                element_count,
-                                                embed->get_shape());
+                return build_embedding<T, double>(element_count, weights_shape);
             }
             else if (type == element::i32)
             {
-                reference::embedding<T, int>(static_cast<const int*>(args[0]),
-                                             static_cast<const T*>(args[1]),
-                                             static_cast<T*>(out[0]),
-                                             element_count,
-                                             embed->get_shape());
+                return build_embedding<T, int>(element_count, weights_shape);
             }
             else if (type == element::i64)
             {
-                reference::embedding<T, int64_t>(static_cast<const int64_t*>(args[0]),
-                                                 static_cast<const T*>(args[1]),
-                                                 static_cast<T*>(out[0]),
-                                                 element_count,
-                                                 embed->get_shape());
+                return build_embedding<T, int64_t>(element_count, weights_shape);
             }
             else
             {
                 throw ngraph_error(std::string("Unsupported index type ") + type.c_type_string() +
                                    std::string("in EmbeddingLookup"));
             }
-            break;
         }
         case OP_TYPEID::Equal:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::equal<T>(static_cast<const T*>(args[0]),
-                                static_cast<const T*>(args[1]),
-                                static_cast<char*>(out[0]),
-                                element_count);
-            break;
+            return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+                reference::equal<T>(static_cast<const T*>(args[0]),
+                                    static_cast<const T*>(args[1]),
+                                    static_cast<char*>(out[0]),
+                                    element_count);
+            };
         }
         case OP_TYPEID::Exp:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::exp<T>(
-                static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
-            break;
+            return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+                reference::exp<T>(
+                    static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
+            };
         }
         case OP_TYPEID::Floor:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::floor<T>(
-                static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
-            break;
+            return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+                reference::floor<T>(
+                    static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
+            };
         }
         case OP_TYPEID::FunctionCall:
         {
             std::shared_ptr<Function> function = node.get_functions()[0];
 
-            std::vector<std::shared_ptr<runtime::Tensor>> outputs;
-            for (size_t i = 0; i < function->get_output_size(); i++)
+            // The callee is compiled on first use, compile() must not be reentered here
+            return [this, function](const KernelOutputs& out, const KernelInputs& args) {
+                std::vector<std::shared_ptr<runtime::Tensor>> outputs;
+                for (size_t i = 0; i < function->get_output_size(); i++)
+                {
+                    element::Type et = function->get_output_element_type(i);
+                    Shape shape = function->get_output_shape(i);
+                    auto host_tensor = std::make_shared<HostTensor>(et, shape, out[i]);
+                    outputs.push_back(std::static_pointer_cast<runtime::Tensor>(host_tensor));
+                }
+
+                std::vector<std::shared_ptr<runtime::Tensor>> inputs;
+                auto parameters = function->get_parameters();
+                for (size_t i = 0; i < parameters.size(); i++)
+                {
+                    auto parameter = parameters[i];
+                    element::Type et = parameter->get_element_type();
+                    Shape shape = parameter->get_shape();
+                    auto host_tensor =
+                        std::make_shared<HostTensor>(et, shape, const_cast<void*>(args[i]));
+                    inputs.push_back(std::static_pointer_cast<runtime::Tensor>(host_tensor));
+                }
+
+                auto handle = compile(function);
+                call(handle, outputs, inputs);
+            };
+        }
+        case OP_TYPEID::Gather:
+        {
+            const op::Gather* gather = static_cast<const op::Gather*>(&node);
+            size_t indices_count = shape_size(node.get_input_shape(1));
+            Shape params_shape = node.get_input_shape(0);
+            size_t axis = gather->get_axis();
+            if (node.get_input_element_type(1) == element::i32)
             {
-                element::Type et = function->get_output_element_type(i);
-                Shape shape = function->get_output_shape(i);
-                auto host_tensor = std::make_shared<HostTensor>(et, shape, out[i]);
-                outputs.push_back(std::static_pointer_cast<runtime::Tensor>(host_tensor));
+                return [params_shape, indices_count, axis](const KernelOutputs& out,
+                                                           const KernelInputs& args) {
+                    reference::gather<T, int32_t>(static_cast<const T*>(args[0]),
+                                                  static_cast<const int32_t*>(args[1]),
+                                                  static_cast<T*>(out[0]),
+                                                  params_shape,
+                                                  indices_count,
+                                                  axis);
+                };
             }
-
-            std::vector<std::shared_ptr<runtime::Tensor>> inputs;
-            auto parameters = function->get_parameters();
-            for (size_t i = 0; i < parameters.size(); i++)
+            else if (node.get_input_element_type(1) == element::i64)
             {
-                auto parameter = parameters[i];
-                element::Type et = parameter->get_element_type();
-                Shape shape = parameter->get_shape();
-                auto host_tensor =
-                    std::make_shared<HostTensor>(et, shape, const_cast<void*>(args[i]));
-                inputs.push_back(std::static_pointer_cast<runtime::Tensor>(host_tensor));
+                return [params_shape, indices_count, axis](const KernelOutputs& out,
+                                                           const KernelInputs& args) {
+                    reference::gather<T, int64_t>(static_cast<const T*>(args[0]),
+                                                  static_cast<const int64_t*>(args[1]),
+                                                  static_cast<T*>(out[0]),
+                                                  params_shape,
+                                                  indices_count,
+                                                  axis);
+                };
+            }
+            else
+            {
+                throw ngraph_error("Gather only supports i32 and i64 indices");
             }
-
-            auto handle = compile(function);
-            call(handle, outputs, inputs);
-            break;
         }
         case OP_TYPEID::Greater:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::greater<T>(static_cast<const T*>(args[0]),
-                                  static_cast<const T*>(args[1]),
-                                  static_cast<char*>(out[0]),
-                                  element_count);
-            break;
+            return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+                reference::greater<T>(static_cast<const T*>(args[0]),
+                                      static_cast<const T*>(args[1]),
+                                      static_cast<char*>(out[0]),
+                                      element_count);
+            };
         }
         case OP_TYPEID::GreaterEq:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::greater_eq<T>(static_cast<const T*>(args[0]),
-                                     static_cast<const T*>(args[1]),
-                                     static_cast<char*>(out[0]),
-                                     element_count);
-            break;
+            return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+                reference::greater_eq<T>(static_cast<const T*>(args[0]),
+                                         static_cast<const T*>(args[1]),
+                                         static_cast<char*>(out[0]),
+                                         element_count);
+            };
         }
         case OP_TYPEID::Less:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::less<T>(static_cast<const T*>(args[0]),
-                               static_cast<const T*>(args[1]),
-                               static_cast<char*>(out[0]),
-                               element_count);
-            break;
+            return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+                reference::less<T>(static_cast<const T*>(args[0]),
+                                   static_cast<const T*>(args[1]),
+                                   static_cast<char*>(out[0]),
+                                   element_count);
+            };
         }
         case OP_TYPEID::LessEq:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::less_eq<T>(static_cast<const T*>(args[0]),
-                                  static_cast<const T*>(args[1]),
-                                  static_cast<char*>(out[0]),
-                                  element_count);
-            break;
+            return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+                reference::less_eq<T>(static_cast<const T*>(args[0]),
+                                      static_cast<const T*>(args[1]),
+                                      static_cast<char*>(out[0]),
+                                      element_count);
+            };
         }
         case OP_TYPEID::Log:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::log<T>(
-                static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
-            break;
+            return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+                reference::log<T>(
+                    static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
+            };
         }
         case OP_TYPEID::LRN:
         {
             const op::LRN* lrn = static_cast<const op::LRN*>(&node);
-            reference::lrn<T>(static_cast<const T*>(args[0]),
-                              static_cast<T*>(out[0]),
-                              node.get_input_shape(0),
-                              lrn->get_alpha(),
-                              lrn->get_beta(),
-                              lrn->get_bias(),
-                              lrn->get_nsize());
-            break;
+            Shape in_shape = node.get_input_shape(0);
+            double alpha = lrn->get_alpha();
+            double beta = lrn->get_beta();
+            double bias = lrn->get_bias();
+            size_t nsize = lrn->get_nsize();
+            return [=](const KernelOutputs& out, const KernelInputs& args) {
+                reference::lrn<T>(static_cast<const T*>(args[0]),
+                                  static_cast<T*>(out[0]),
+                                  in_shape,
+                                  alpha,
+                                  beta,
+                                  bias,
+                                  nsize);
+            };
         }
         case OP_TYPEID::Max:
         {
             const op::Max* max = static_cast<const op::Max*>(&node);
-            reference::max<T>(static_cast<const T*>(args[0]),
-                              static_cast<T*>(out[0]),
-                              node.get_input_shape(0),
-                              node.get_output_shape(0),
-                              max->get_reduction_axes());
-            break;
+            Shape in_shape = node.get_input_shape(0);
+            Shape out_shape = node.get_output_shape(0);
+            AxisSet reduction_axes = max->get_reduction_axes();
+            return [in_shape, out_shape, reduction_axes](const KernelOutputs& out,
+                                                         const KernelInputs& args) {
+                reference::max<T>(static_cast<const T*>(args[0]),
+                                  static_cast<T*>(out[0]),
+                                  in_shape,
+                                  out_shape,
+                                  reduction_axes);
+            };
         }
         case OP_TYPEID::Maximum:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::maximum<T>(static_cast<const T*>(args[0]),
-                                  static_cast<const T*>(args[1]),
-                                  static_cast<T*>(out[0]),
-                                  element_count);
-            break;
+            return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+                reference::maximum<T>(static_cast<const T*>(args[0]),
+                                      static_cast<const T*>(args[1]),
+                                      static_cast<T*>(out[0]),
+                                      element_count);
+            };
         }
         case OP_TYPEID::MaxPool:
         {
             const op::MaxPool* max_pool = static_cast<const op::MaxPool*>(&node);
-
-            reference::max_pool<T>(static_cast<const T*>(args[0]),
-                                   static_cast<T*>(out[0]),
-                                   node.get_input_shape(0),
-                                   node.get_output_shape(0),
-                                   max_pool->get_window_shape(),
-                                   max_pool->get_window_movement_strides(),
-                                   max_pool->get_padding_below(),
-                                   max_pool->get_padding_above());
-            break;
+            Shape in_shape = node.get_input_shape(0);
+            Shape out_shape = node.get_output_shape(0);
+            Shape window_shape = max_pool->get_window_shape();
+            Strides window_movement_strides = max_pool->get_window_movement_strides();
+            Shape padding_below = max_pool->get_padding_below();
+            Shape padding_above = max_pool->get_padding_above();
+            return [=](const KernelOutputs& out, const KernelInputs& args) {
+                reference::max_pool<T>(static_cast<const T*>(args[0]),
+                                       static_cast<T*>(out[0]),
+                                       in_shape,
+                                       out_shape,
+                                       window_shape,
+                                       window_movement_strides,
+                                       padding_below,
+                                       padding_above);
+            };
         }
         case OP_TYPEID::MaxPoolBackprop:
         {
             const op::MaxPoolBackprop* max_pool_backprop =
                 static_cast<const op::MaxPoolBackprop*>(&node);
-
-            reference::max_pool_backprop<T>(static_cast<const T*>(args[0]),
-                                            static_cast<const T*>(args[1]),
-                                            static_cast<T*>(out[0]),
-                                            node.get_input_shape(1),
-                                            node.get_output_shape(0),
-                                            max_pool_backprop->get_window_shape(),
-                                            max_pool_backprop->get_window_movement_strides(),
-                                            max_pool_backprop->get_padding_below(),
-                                            max_pool_backprop->get_padding_above());
-            break;
+            Shape delta_shape = node.get_input_shape(1);
+            Shape out_shape = node.get_output_shape(0);
+            Shape window_shape = max_pool_backprop->get_window_shape();
+            Strides window_movement_strides = max_pool_backprop->get_window_movement_strides();
+            Shape padding_below = max_pool_backprop->get_padding_below();
+            Shape padding_above = max_pool_backprop->get_padding_above();
+            return [=](const KernelOutputs& out, const KernelInputs& args) {
+                reference::max_pool_backprop<T>(static_cast<const T*>(args[0]),
+                                                static_cast<const T*>(args[1]),
+                                                static_cast<T*>(out[0]),
+                                                delta_shape,
+                                                out_shape,
+                                                window_shape,
+                                                window_movement_strides,
+                                                padding_below,
+                                                padding_above);
+            };
         }
         case OP_TYPEID::Min:
         {
             const op::Min* min = static_cast<const op::Min*>(&node);
-            reference::min<T>(static_cast<const T*>(args[0]),
-                              static_cast<T*>(out[0]),
-                              node.get_input_shape(0),
-                              node.get_output_shape(0),
-                              min->get_reduction_axes());
-            break;
+            Shape in_shape = node.get_input_shape(0);
+            Shape out_shape = node.get_output_shape(0);
+            AxisSet reduction_axes = min->get_reduction_axes();
+            return [in_shape, out_shape, reduction_axes](const KernelOutputs& out,
+                                                         const KernelInputs& args) {
+                reference::min<T>(static_cast<const T*>(args[0]),
+                                  static_cast<T*>(out[0]),
+                                  in_shape,
+                                  out_shape,
+                                  reduction_axes);
+            };
         }
         case OP_TYPEID::Minimum:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::minimum<T>(static_cast<const T*>(args[0]),
-                                  static_cast<const T*>(args[1]),
-                                  static_cast<T*>(out[0]),
-                                  element_count);
-            break;
+            return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+                reference::minimum<T>(static_cast<const T*>(args[0]),
+                                      static_cast<const T*>(args[1]),
+                                      static_cast<T*>(out[0]),
+                                      element_count);
+            };
         }
         case OP_TYPEID::Multiply:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::multiply<T>(static_cast<const T*>(args[0]),
-                                   static_cast<const T*>(args[1]),
-                                   static_cast<T*>(out[0]),
-                                   element_count);
-            break;
+            return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+                reference::multiply<T>(static_cast<const T*>(args[0]),
+                                       static_cast<const T*>(args[1]),
+                                       static_cast<T*>(out[0]),
+                                       element_count);
+            };
         }
         case OP_TYPEID::Negative:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::negate<T>(
-                static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
-            break;
+            return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+                reference::negate<T>(
+                    static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
+            };
         }
         case OP_TYPEID::Not:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::logical_not(
-                static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
-            break;
+            return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+                reference::logical_not(
+                    static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
+            };
         }
         case OP_TYPEID::NotEqual:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::not_equal<T>(static_cast<const T*>(args[0]),
-                                    static_cast<const T*>(args[1]),
-                                    static_cast<char*>(out[0]),
-                                    element_count);
-            break;
+            return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+                reference::not_equal<T>(static_cast<const T*>(args[0]),
+                                        static_cast<const T*>(args[1]),
+                                        static_cast<char*>(out[0]),
+                                        element_count);
+            };
         }
         case OP_TYPEID::OneHot:
         {
             const op::OneHot* oh = static_cast<const op::OneHot*>(&node);
-            reference::one_hot<T>(static_cast<const T*>(args[0]),
-                                  static_cast<T*>(out[0]),
-                                  node.get_input_shape(0),
-                                  node.get_output_shape(0),
-                                  oh->get_one_hot_axis());
-            break;
+            Shape in_shape = node.get_input_shape(0);
+            Shape out_shape = node.get_output_shape(0);
+            size_t one_hot_axis = oh->get_one_hot_axis();
+            return [in_shape, out_shape, one_hot_axis](const KernelOutputs& out,
+                                                       const KernelInputs& args) {
+                reference::one_hot<T>(static_cast<const T*>(args[0]),
+                                      static_cast<T*>(out[0]),
+                                      in_shape,
+                                      out_shape,
+                                      one_hot_axis);
+            };
         }
         case OP_TYPEID::Or:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::logical_or(static_cast<const T*>(args[0]),
-                                  static_cast<const T*>(args[1]),
-                                  static_cast<T*>(out[0]),
-                                  element_count);
-            break;
+            return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+                reference::logical_or(static_cast<const T*>(args[0]),
+                                      static_cast<const T*>(args[1]),
+                                      static_cast<T*>(out[0]),
+                                      element_count);
+            };
         }
-        case OP_TYPEID::Parameter: break;
+        case OP_TYPEID::Parameter: return [](const KernelOutputs&, const KernelInputs&) {};
         case OP_TYPEID::Pad:
         {
             const op::Pad* pad = static_cast<const op::Pad*>(&node);
-
-            reference::pad(static_cast<const T*>(args[0]),
-                           static_cast<const T*>(args[1]),
-                           static_cast<T*>(out[0]),
-                           node.get_inputs().at(0).get_shape(),
-                           node.get_output_shape(0),
-                           pad->get_padding_below(),
-                           pad->get_padding_above(),
-                           pad->get_padding_interior());
-            break;
+            Shape in_shape = node.get_inputs().at(0).get_shape();
+            Shape out_shape = node.get_output_shape(0);
+            Shape padding_below = pad->get_padding_below();
+            Shape padding_above = pad->get_padding_above();
+            Shape padding_interior = pad->get_padding_interior();
+            return [=](const KernelOutputs& out, const KernelInputs& args) {
+                reference::pad(static_cast<const T*>(args[0]),
+                               static_cast<const T*>(args[1]),
+                               static_cast<T*>(out[0]),
+                               in_shape,
+                               out_shape,
+                               padding_below,
+                               padding_above,
+                               padding_interior);
+            };
         }
         case OP_TYPEID::Power:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::power<T>(static_cast<const T*>(args[0]),
-                                static_cast<const T*>(args[1]),
-                                static_cast<T*>(out[0]),
-                                element_count);
-            break;
+            return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+                reference::power<T>(static_cast<const T*>(args[0]),
+                                    static_cast<const T*>(args[1]),
+                                    static_cast<T*>(out[0]),
+                                    element_count);
+            };
         }
         case OP_TYPEID::Product:
         {
             const op::Product* product = static_cast<const op::Product*>(&node);
-            reference::product<T>(static_cast<const T*>(args[0]),
-                                  static_cast<T*>(out[0]),
-                                  node.get_input_shape(0),
-                                  node.get_output_shape(0),
-                                  product->get_reduction_axes());
-            break;
+            Shape in_shape = node.get_input_shape(0);
+            Shape out_shape = node.get_output_shape(0);
+            AxisSet reduction_axes = product->get_reduction_axes();
+            return [in_shape, out_shape, reduction_axes](const KernelOutputs& out,
+                                                         const KernelInputs& args) {
+                reference::product<T>(static_cast<const T*>(args[0]),
+                                      static_cast<T*>(out[0]),
+                                      in_shape,
+                                      out_shape,
+                                      reduction_axes);
+            };
         }
         case OP_TYPEID::Quantize:
         {
             const op::Quantize* quantize = static_cast<const op::Quantize*>(&node);
             auto type = quantize->get_element_type();
+            Shape in_shape = node.get_input_shape(0);
+            Shape scale_shape = node.get_input_shape(1);
+            AxisSet axes = quantize->get_axes();
+            op::Quantize::RoundMode round_mode = quantize->get_round_mode();
 
             if (type == element::u8)
             {
-                reference::quantize<T>(static_cast<const T*>(args[0]),
-                                       static_cast<const T*>(args[1]),
-                                       static_cast<const uint8_t*>(args[2]),
-                                       static_cast<uint8_t*>(out[0]),
-                                       node.get_input_shape(0),
-                                       node.get_input_shape(1),
-                                       quantize->get_axes(),
-                                       quantize->get_round_mode());
+                return build_quantize<T, uint8_t>(in_shape, scale_shape, axes, round_mode);
             }
             else if (type == element::i8)
             {
-                reference::quantize<T>(static_cast<const T*>(args[0]),
-                                       static_cast<const T*>(args[1]),
-                                       static_cast<const int8_t*>(args[2]),
-                                       static_cast<int8_t*>(out[0]),
-                                       node.get_input_shape(0),
-                                       node.get_input_shape(1),
-                                       quantize->get_axes(),
-                                       quantize->get_round_mode());
+                return build_quantize<T, int8_t>(in_shape, scale_shape, axes, round_mode);
             }
             else if (type == element::i32)
             {
-                reference::quantize<T>(static_cast<const T*>(args[0]),
-                                       static_cast<const T*>(args[1]),
-                                       static_cast<const int32_t*>(args[2]),
-                                       static_cast<int32_t*>(out[0]),
-                                       node.get_input_shape(0),
-                                       node.get_input_shape(1),
-                                       quantize->get_axes(),
-                                       quantize->get_round_mode());
+                return build_quantize<T, int32_t>(in_shape, scale_shape, axes, round_mode);
             }
             else
             {
@@ -1048,122 +1256,149 @@ private:
                 ss << "unsupported element type " << type << " op Quantize";
                 throw std::runtime_error(ss.str());
             }
-
-            break;
         }
         case OP_TYPEID::Reduce:
         {
             const op::Reduce* reduce = static_cast<const op::Reduce*>(&node);
             std::shared_ptr<Function> reduction_function = reduce->get_functions()[0];
+            element::Type x_type = node.get_inputs().at(0).get_element_type();
+            element::Type y_type = node.get_inputs().at(1).get_element_type();
+            element::Type r_type = node.get_output_element_type(0);
 
-            std::function<T(T, T)> f = [this, &node, reduction_function](T x, T y) -> T {
-                auto tx = std::make_shared<HostTensor>(
-                    node.get_inputs().at(0).get_element_type(), Shape{}, &x, "reduce_temp_x");
-                auto ty = std::make_shared<HostTensor>(
-                    node.get_inputs().at(1).get_element_type(), Shape{}, &y, "reduce_temp_y");
-                auto tr = std::make_shared<HostTensor>(
-                    node.get_output_element_type(0), Shape{}, "reduce_temp_r");
+            std::function<T(T, T)> f =
+                [this, x_type, y_type, r_type, reduction_function](T x, T y) -> T {
+                auto tx = std::make_shared<HostTensor>(x_type, Shape{}, &x, "reduce_temp_x");
+                auto ty = std::make_shared<HostTensor>(y_type, Shape{}, &y, "reduce_temp_y");
+                auto tr = std::make_shared<HostTensor>(r_type, Shape{}, "reduce_temp_r");
                 auto handle = compile(reduction_function);
                 call(handle, {tr}, {tx, ty});
                 return *(tr->get_data_ptr<T>());
             };
 
-            reference::reduce(static_cast<const T*>(args[0]),
-                              static_cast<const T*>(args[1]),
-                              static_cast<T*>(out[0]),
-                              node.get_inputs().at(0).get_shape(),
-                              node.get_output_shape(0),
-                              reduce->get_reduction_axes(),
-                              f);
-            break;
+            Shape in_shape = node.get_inputs().at(0).get_shape();
+            Shape out_shape = node.get_output_shape(0);
+            AxisSet reduction_axes = reduce->get_reduction_axes();
+            return [in_shape, out_shape, reduction_axes, f](const KernelOutputs& out,
+                                                            const KernelInputs& args) {
+                reference::reduce(static_cast<const T*>(args[0]),
+                                  static_cast<const T*>(args[1]),
+                                  static_cast<T*>(out[0]),
+                                  in_shape,
+                                  out_shape,
+                                  reduction_axes,
+                                  f);
+            };
         }
         case OP_TYPEID::ReduceWindow:
         {
             const op::ReduceWindow* reduce_window = static_cast<const op::ReduceWindow*>(&node);
             std::shared_ptr<Function> reduction_function = reduce_window->get_functions()[0];
+            element::Type x_type = node.get_inputs().at(0).get_element_type();
+            element::Type y_type = node.get_inputs().at(1).get_element_type();
+            element::Type r_type = node.get_output_element_type(0);
 
-            std::function<T(T, T)> f = [this, &node, reduction_function](T x, T y) -> T {
-                auto tx = std::make_shared<HostTensor>(node.get_inputs().at(0).get_element_type(),
-                                                       Shape{},
-                                                       &x,
-                                                       "reduce_window_temp_x");
-                auto ty = std::make_shared<HostTensor>(node.get_inputs().at(1).get_element_type(),
-                                                       Shape{},
-                                                       &y,
-                                                       "reduce_window_temp_y");
-                auto tr = std::make_shared<HostTensor>(
-                    node.get_output_element_type(0), Shape{}, "reduce_window_temp_r");
+            std::function<T(T, T)> f =
+                [this, x_type, y_type, r_type, reduction_function](T x, T y) -> T {
+                auto tx =
+                    std::make_shared<HostTensor>(x_type, Shape{}, &x, "reduce_window_temp_x");
+                auto ty =
+                    std::make_shared<HostTensor>(y_type, Shape{}, &y, "reduce_window_temp_y");
+                auto tr = std::make_shared<HostTensor>(r_type, Shape{}, "reduce_window_temp_r");
                 auto handle = compile(reduction_function);
                 call(handle, {tr}, {tx, ty});
                 return *(tr->get_data_ptr<T>());
             };
 
-            reference::reduce_window(static_cast<const T*>(args[0]),
-                                     static_cast<const T*>(args[1]),
-                                     static_cast<T*>(out[0]),
-                                     node.get_inputs().at(0).get_shape(),
-                                     node.get_output_shape(0),
-                                     f,
-                                     reduce_window->get_window_shape(),
-                                     reduce_window->get_window_movement_strides());
-            break;
+            Shape in_shape = node.get_inputs().at(0).get_shape();
+            Shape out_shape = node.get_output_shape(0);
+            Shape window_shape = reduce_window->get_window_shape();
+            Strides window_movement_strides = reduce_window->get_window_movement_strides();
+            return [=](const KernelOutputs& out, const KernelInputs& args) {
+                reference::reduce_window(static_cast<const T*>(args[0]),
+                                         static_cast<const T*>(args[1]),
+                                         static_cast<T*>(out[0]),
+                                         in_shape,
+                                         out_shape,
+                                         f,
+                                         window_shape,
+                                         window_movement_strides);
+            };
         }
         case OP_TYPEID::Relu:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::relu<T>(
-                static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
-            break;
+            return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+                reference::relu<T>(
+                    static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
+            };
         }
         case OP_TYPEID::ReluBackprop:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::relu_backprop<T>(static_cast<const T*>(args[0]),
-                                        static_cast<const T*>(args[1]),
-                                        static_cast<T*>(out[0]),
-                                        element_count);
-            break;
+            return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+                reference::relu_backprop<T>(static_cast<const T*>(args[0]),
+                                            static_cast<const T*>(args[1]),
+                                            static_cast<T*>(out[0]),
+                                            element_count);
+            };
         }
         case OP_TYPEID::ReplaceSlice:
         {
             const op::ReplaceSlice* slice = static_cast<const op::ReplaceSlice*>(&node);
-            reference::replace_slice<T>(static_cast<const T*>(args[0]),
-                                        static_cast<const T*>(args[1]),
-                                        static_cast<T*>(out[0]),
-                                        node.get_input_shape(1),
-                                        slice->get_lower_bounds(),
-                                        slice->get_upper_bounds(),
-                                        slice->get_strides(),
-                                        node.get_output_shape(0));
-            break;
+            Shape arg1_shape = node.get_input_shape(1);
+            Coordinate lower_bounds = slice->get_lower_bounds();
+            Coordinate upper_bounds = slice->get_upper_bounds();
+            Strides strides = slice->get_strides();
+            Shape out_shape = node.get_output_shape(0);
+            return [=](const KernelOutputs& out, const KernelInputs& args) {
+                reference::replace_slice<T>(static_cast<const T*>(args[0]),
+                                            static_cast<const T*>(args[1]),
+                                            static_cast<T*>(out[0]),
+                                            arg1_shape,
+                                            lower_bounds,
+                                            upper_bounds,
+                                            strides,
+                                            out_shape);
+            };
         }
         case OP_TYPEID::Reshape:
         {
             const op::Reshape* reshape = static_cast<const op::Reshape*>(&node);
-            reference::reshape(static_cast<const T*>(args[0]),
-                               static_cast<T*>(out[0]),
-                               node.get_input_shape(0),
-                               reshape->get_input_order(),
-                               node.get_output_shape(0));
-            break;
+            Shape in_shape = node.get_input_shape(0);
+            AxisVector input_order = reshape->get_input_order();
+            Shape out_shape = node.get_output_shape(0);
+            return [in_shape, input_order, out_shape](const KernelOutputs& out,
+                                                      const KernelInputs& args) {
+                reference::reshape(static_cast<const T*>(args[0]),
+                                   static_cast<T*>(out[0]),
+                                   in_shape,
+                                   input_order,
+                                   out_shape);
+            };
         }
         case OP_TYPEID::Result:
         {
             const op::Result* res = static_cast<const op::Result*>(&node);
-            reference::result(static_cast<const T*>(args[0]),
-                              static_cast<T*>(out[0]),
-                              shape_size(res->get_shape()));
-            break;
+            size_t element_count = shape_size(res->get_shape());
+            return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+                reference::result(
+                    static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
+            };
         }
         case OP_TYPEID::Reverse:
         {
             const op::Reverse* reverse = static_cast<const op::Reverse*>(&node);
-            reference::reverse(static_cast<const T*>(args[0]),
-                               static_cast<T*>(out[0]),
-                               node.get_input_shape(0),
-                               node.get_output_shape(0),
-                               reverse->get_reversed_axes());
-            break;
+            Shape in_shape = node.get_input_shape(0);
+            Shape out_shape = node.get_output_shape(0);
+            AxisSet reversed_axes = reverse->get_reversed_axes();
+            return [in_shape, out_shape, reversed_axes](const KernelOutputs& out,
+                                                        const KernelInputs& args) {
+                reference::reverse(static_cast<const T*>(args[0]),
+                                   static_cast<T*>(out[0]),
+                                   in_shape,
+                                   out_shape,
+                                   reversed_axes);
+            };
         }
         case OP_TYPEID::ReverseSequence:
         {
@@ -1171,42 +1406,84 @@ private:
 
             if (node.get_input_element_type(1) == element::i32)
             {
-                reference::reverse_sequence<T, int32_t>(static_cast<const T*>(args[0]),
-                                                        static_cast<T*>(out[0]),
-                                                        node.get_input_shape(0),
-                                                        reverse->get_batch_axis(),
-                                                        reverse->get_sequence_axis(),
-                                                        static_cast<const int32_t*>(args[1]));
+                Shape in_shape = node.get_input_shape(0);
+                size_t batch_axis = reverse->get_batch_axis();
+                size_t sequence_axis = reverse->get_sequence_axis();
+                return [in_shape, batch_axis, sequence_axis](const KernelOutputs& out,
+                                                             const KernelInputs& args) {
+                    reference::reverse_sequence<T, int32_t>(static_cast<const T*>(args[0]),
+                                                            static_cast<T*>(out[0]),
+                                                            in_shape,
+                                                            batch_axis,
+                                                            sequence_axis,
+                                                            static_cast<const int32_t*>(args[1]));
+                };
             }
             else
             {
                 throw ngraph_error("only int32 indices are supported");
             }
-            break;
+        }
+        case OP_TYPEID::ScatterAdd:
+        {
+            size_t indices_count = shape_size(node.get_input_shape(1));
+            Shape inputs_shape = node.get_input_shape(0);
+            if (node.get_input_element_type(1) == element::i32)
+            {
+                return [inputs_shape, indices_count](const KernelOutputs& out,
+                                                     const KernelInputs& args) {
+                    reference::scatter_add<T, int32_t>(static_cast<const T*>(args[0]),
+                                                       static_cast<const int32_t*>(args[1]),
+                                                       static_cast<const T*>(args[2]),
+                                                       static_cast<T*>(out[0]),
+                                                       inputs_shape,
+                                                       indices_count);
+                };
+            }
+            else if (node.get_input_element_type(1) == element::i64)
+            {
+                return [inputs_shape, indices_count](const KernelOutputs& out,
+                                                     const KernelInputs& args) {
+                    reference::scatter_add<T, int64_t>(static_cast<const T*>(args[0]),
+                                                       static_cast<const int64_t*>(args[1]),
+                                                       static_cast<const T*>(args[2]),
+                                                       static_cast<T*>(out[0]),
+                                                       inputs_shape,
+                                                       indices_count);
+                };
+            }
+            else
+            {
+                throw ngraph_error("ScatterAdd only supports i32 and i64 indices");
+            }
         }
         case OP_TYPEID::Select:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::select<T>(static_cast<const char*>(args[0]),
-                                 static_cast<const T*>(args[1]),
-                                 static_cast<const T*>(args[2]),
-                                 static_cast<T*>(out[0]),
-                                 element_count);
-            break;
+            return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+                reference::select<T>(static_cast<const char*>(args[0]),
+                                     static_cast<const T*>(args[1]),
+                                     static_cast<const T*>(args[2]),
+                                     static_cast<T*>(out[0]),
+                                     element_count);
+            };
         }
         case OP_TYPEID::SelectAndScatter:
         {
             const ngraph::op::SelectAndScatter* select_and_scatter =
                 static_cast<const ngraph::op::SelectAndScatter*>(&node);
+            element::Type x_type = node.get_inputs().at(0).get_element_type();
+            element::Type y_type = node.get_inputs().at(1).get_element_type();
+            element::Type r_type = node.get_output_element_type(0);
 
             std::shared_ptr<ngraph::Function> selection_function =
                 select_and_scatter->get_functions()[0];
-            std::function<bool(T, T)> f_selection = [this, &node, selection_function](T x,
-                                                                                      T y) -> bool {
+            std::function<bool(T, T)> f_selection =
+                [this, x_type, y_type, selection_function](T x, T y) -> bool {
                 auto tx = std::make_shared<runtime::HostTensor>(
-                    node.get_inputs().at(0).get_element_type(), Shape{}, &x, "selection_temp_x");
+                    x_type, Shape{}, &x, "selection_temp_x");
                 auto ty = std::make_shared<runtime::HostTensor>(
-                    node.get_inputs().at(1).get_element_type(), Shape{}, &y, "selection_temp_y");
+                    y_type, Shape{}, &y, "selection_temp_y");
                 auto tr = std::make_shared<runtime::HostTensor>(
                     element::boolean, Shape{}, "selection_temp_r");
                 auto handle = compile(selection_function);
@@ -1216,169 +1493,249 @@ private:
 
             std::shared_ptr<ngraph::Function> scatter_function =
                 select_and_scatter->get_functions()[1];
-            std::function<T(T, T)> f_scatter = [this, &node, scatter_function](T x, T y) -> T {
-                auto tx = std::make_shared<runtime::HostTensor>(
-                    node.get_inputs().at(0).get_element_type(), Shape{}, &x, "scatter_temp_x");
-                auto ty = std::make_shared<runtime::HostTensor>(
-                    node.get_inputs().at(1).get_element_type(), Shape{}, &y, "scatter_temp_y");
-                auto tr = std::make_shared<runtime::HostTensor>(
-                    node.get_output_element_type(0), Shape{}, "scatter_temp_r");
+            std::function<T(T, T)> f_scatter =
+                [this, x_type, y_type, r_type, scatter_function](T x, T y) -> T {
+                auto tx =
+                    std::make_shared<runtime::HostTensor>(x_type, Shape{}, &x, "scatter_temp_x");
+                auto ty =
+                    std::make_shared<runtime::HostTensor>(y_type, Shape{}, &y, "scatter_temp_y");
+                auto tr =
+                    std::make_shared<runtime::HostTensor>(r_type, Shape{}, "scatter_temp_r");
                 auto handle = compile(scatter_function);
                 call(handle, {tr}, {tx, ty});
                 return *(tr->get_data_ptr<T>());
             };
 
-            reference::select_and_scatter<T>(static_cast<const T*>(args[0]),
-                                             static_cast<const T*>(args[1]),
-                                             static_cast<const T*>(args[2]),
-                                             static_cast<T*>(out[0]),
-                                             node.get_input_shape(0),
-                                             node.get_input_shape(1),
-                                             node.get_output_shape(0),
-                                             f_selection,
-                                             f_scatter,
-                                             select_and_scatter->get_window_shape(),
-                                             select_and_scatter->get_window_movement_strides());
-            break;
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            Shape out_shape = node.get_output_shape(0);
+            Shape window_shape = select_and_scatter->get_window_shape();
+            Strides window_movement_strides = select_and_scatter->get_window_movement_strides();
+            return [=](const KernelOutputs& out, const KernelInputs& args) {
+                reference::select_and_scatter<T>(static_cast<const T*>(args[0]),
+                                                 static_cast<const T*>(args[1]),
+                                                 static_cast<const T*>(args[2]),
+                                                 static_cast<T*>(out[0]),
+                                                 arg0_shape,
+                                                 arg1_shape,
+                                                 out_shape,
+                                                 f_selection,
+                                                 f_scatter,
+                                                 window_shape,
+                                                 window_movement_strides);
+            };
         }
         case OP_TYPEID::ShapeOf:
         {
-            reference::shape_of(node.get_input_shape(0), static_cast<uint64_t*>(out[0]));
-            break;
+            Shape in_shape = node.get_input_shape(0);
+            return [in_shape](const KernelOutputs& out, const KernelInputs&) {
+                reference::shape_of(in_shape, static_cast<uint64_t*>(out[0]));
+            };
         }
         case OP_TYPEID::Sigmoid:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::sigmoid<T>(
-                static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
-            break;
+            return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+                reference::sigmoid<T>(
+                    static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
+            };
         }
         case OP_TYPEID::SigmoidBackprop:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::sigmoid_backprop<T>(static_cast<const T*>(args[0]),
-                                           static_cast<const T*>(args[1]),
-                                           static_cast<T*>(out[0]),
-                                           element_count);
-            break;
+            return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+                reference::sigmoid_backprop<T>(static_cast<const T*>(args[0]),
+                                               static_cast<const T*>(args[1]),
+                                               static_cast<T*>(out[0]),
+                                               element_count);
+            };
         }
         case OP_TYPEID::Sign:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::sign<T>(
-                static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
-            break;
+            return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+                reference::sign<T>(
+                    static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
+            };
         }
         case OP_TYPEID::Sin:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::sin<T>(
-                static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
-            break;
+            return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+                reference::sin<T>(
+                    static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
+            };
         }
         case OP_TYPEID::Sinh:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::sinh<T>(
-                static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
-            break;
+            return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+                reference::sinh<T>(
+                    static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
+            };
         }
         case OP_TYPEID::Slice:
         {
             const op::Slice* slice = static_cast<const op::Slice*>(&node);
-            reference::slice<T>(static_cast<const T*>(args[0]),
-                                static_cast<T*>(out[0]),
-                                node.get_input_shape(0),
-                                slice->get_lower_bounds(),
-                                slice->get_upper_bounds(),
-                                slice->get_strides(),
-                                node.get_output_shape(0));
-            break;
+            Shape in_shape = node.get_input_shape(0);
+            Coordinate lower_bounds = slice->get_lower_bounds();
+            Coordinate upper_bounds = slice->get_upper_bounds();
+            Strides strides = slice->get_strides();
+            Shape out_shape = node.get_output_shape(0);
+            return [=](const KernelOutputs& out, const KernelInputs& args) {
+                reference::slice<T>(static_cast<const T*>(args[0]),
+                                    static_cast<T*>(out[0]),
+                                    in_shape,
+                                    lower_bounds,
+                                    upper_bounds,
+                                    strides,
+                                    out_shape);
+            };
         }
         case OP_TYPEID::Softmax:
         {
             const op::Softmax* softmax = static_cast<const op::Softmax*>(&node);
-            reference::softmax<T>(static_cast<const T*>(args[0]),
-                                  static_cast<T*>(out[0]),
-                                  node.get_output_shape(0),
-                                  softmax->get_axes());
-            break;
+            Shape out_shape = node.get_output_shape(0);
+            AxisSet axes = softmax->get_axes();
+            return [out_shape, axes](const KernelOutputs& out, const KernelInputs& args) {
+                reference::softmax<T>(
+                    static_cast<const T*>(args[0]), static_cast<T*>(out[0]), out_shape, axes);
+            };
         }
         case OP_TYPEID::Sqrt:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::sqrt<T>(
-                static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
-            break;
+            return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+                reference::sqrt<T>(
+                    static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
+            };
         }
         case OP_TYPEID::StopGradient: { throw unsupported_op("Unsupported op 'StopGradient'");
         }
         case OP_TYPEID::Subtract:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::subtract<T>(static_cast<const T*>(args[0]),
-                                   static_cast<const T*>(args[1]),
-                                   static_cast<T*>(out[0]),
-                                   element_count);
-            break;
+            return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+                reference::subtract<T>(static_cast<const T*>(args[0]),
+                                       static_cast<const T*>(args[1]),
+                                       static_cast<T*>(out[0]),
+                                       element_count);
+            };
         }
         case OP_TYPEID::Sum:
         {
             const op::Sum* sum = static_cast<const op::Sum*>(&node);
-            reference::sum<T>(static_cast<const T*>(args[0]),
-                              static_cast<T*>(out[0]),
-                              node.get_input_shape(0),
-                              node.get_output_shape(0),
-                              sum->get_reduction_axes());
-            break;
+            Shape in_shape = node.get_input_shape(0);
+            Shape out_shape = node.get_output_shape(0);
+            AxisSet reduction_axes = sum->get_reduction_axes();
+            return [in_shape, out_shape, reduction_axes](const KernelOutputs& out,
+                                                         const KernelInputs& args) {
+                reference::sum<T>(static_cast<const T*>(args[0]),
+                                  static_cast<T*>(out[0]),
+                                  in_shape,
+                                  out_shape,
+                                  reduction_axes);
+            };
         }
         case OP_TYPEID::Tan:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::tan<T>(
-                static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
-            break;
+            return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+                reference::tan<T>(
+                    static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
+            };
         }
         case OP_TYPEID::Tanh:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::tanh<T>(
-                static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
-            break;
+            return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+                reference::tanh<T>(
+                    static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
+            };
         }
         case OP_TYPEID::TopK:
         {
             const op::TopK* topk = static_cast<const op::TopK*>(&node);
+            Shape in_shape = node.get_input_shape(0);
+            Shape out_shape = node.get_output_shape(0);
+            size_t axis = topk->get_top_k_axis();
+            size_t k = topk->get_k();
+            bool compute_max = topk->get_compute_max();
             if (node.get_output_element_type(0) == element::i64)
             {
-                reference::topk<T, int64_t>(static_cast<const T*>(args[0]),
-                                            static_cast<int64_t*>(out[0]),
-                                            static_cast<T*>(out[1]),
-                                            node.get_input_shape(0),
-                                            node.get_output_shape(0),
-                                            topk->get_top_k_axis(),
-                                            topk->get_k(),
-                                            topk->get_compute_max());
+                return [=](const KernelOutputs& out, const KernelInputs& args) {
+                    reference::topk<T, int64_t>(static_cast<const T*>(args[0]),
+                                                static_cast<int64_t*>(out[0]),
+                                                static_cast<T*>(out[1]),
+                                                in_shape,
+                                                out_shape,
+                                                axis,
+                                                k,
+                                                compute_max);
+                };
             }
             else if (node.get_output_element_type(0) == element::i32)
             {
-                reference::topk<T, int32_t>(static_cast<const T*>(args[0]),
-                                            static_cast<int32_t*>(out[0]),
-                                            static_cast<T*>(out[1]),
-                                            node.get_input_shape(0),
-                                            node.get_output_shape(0),
-                                            topk->get_top_k_axis(),
-                                            topk->get_k(),
-                                            topk->get_compute_max());
+                return [=](const KernelOutputs& out, const KernelInputs& args) {
+                    reference::topk<T, int32_t>(static_cast<const T*>(args[0]),
+                                                static_cast<int32_t*>(out[0]),
+                                                static_cast<T*>(out[1]),
+                                                in_shape,
+                                                out_shape,
+                                                axis,
+                                                k,
+                                                compute_max);
+                };
             }
             else
             {
                 throw ngraph_error("Unexpected type");
             }
-            break;
         }
         default: throw unsupported_op("Unsupported op '" + node.description() + "'");
 #pragma GCC diagnostic pop
         }
     }
+
+    template <typename T, typename OUT>
+    static FunctionInstance::Kernel build_convert(size_t element_count)
+    {
+        return [element_count](const KernelOutputs& out, const KernelInputs& args) {
+            reference::convert<T>(
+                static_cast<const T*>(args[0]), static_cast<OUT*>(out[0]), element_count);
+        };
+    }
+
+    template <typename T, typename INDEX>
+    static FunctionInstance::Kernel build_embedding(size_t element_count,
+                                                    const Shape& weights_shape)
+    {
+        return [element_count, weights_shape](const KernelOutputs& out,
+                                              const KernelInputs& args) {
+            reference::embedding<T, INDEX>(static_cast<const INDEX*>(args[0]),
+                                           static_cast<const T*>(args[1]),
+                                           static_cast<T*>(out[0]),
+                                           element_count,
+                                           weights_shape);
+        };
+    }
+
+    template <typename T, typename QUANT>
+    static FunctionInstance::Kernel build_quantize(const Shape& in_shape,
+                                                   const Shape& scale_shape,
+                                                   const AxisSet& axes,
+                                                   op::Quantize::RoundMode round_mode)
+    {
+        return [in_shape, scale_shape, axes, round_mode](const KernelOutputs& out,
+                                                         const KernelInputs& args) {
+            reference::quantize<T>(static_cast<const T*>(args[0]),
+                                   static_cast<const T*>(args[1]),
+                                   static_cast<const QUANT*>(args[2]),
+                                   static_cast<QUANT*>(out[0]),
+                                   in_shape,
+                                   scale_shape,
+                                   axes,
+                                   round_mode);
+        };
+    }
 };
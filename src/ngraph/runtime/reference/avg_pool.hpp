@@ -96,23 +96,24 @@ namespace ngraph
                         source_window_transform_padding_below,
                         source_window_transform_padding_above);
 
+                    size_t window_size = shape_size(source_window_transform.get_target_shape());
                     size_t num_elements_in_window = 0;
 
-                    for (const Coordinate& source_window_coord : source_window_transform)
+                    CoordinateTransform::IndexIterator count_it(source_window_transform);
+                    for (size_t i = 0; i < window_size; i++, ++count_it)
                     {
-                        if (source_window_transform.has_source_coordinate(source_window_coord) ||
-                            include_padding_in_avg_computation)
+                        if (count_it.has_source() || include_padding_in_avg_computation)
                         {
                             num_elements_in_window++;
                         }
                     }
 
-                    for (const Coordinate& source_window_coord : source_window_transform)
+                    CoordinateTransform::IndexIterator out_it(source_window_transform);
+                    for (size_t i = 0; i < window_size; i++, ++out_it)
                     {
-                        if (source_window_transform.has_source_coordinate(source_window_coord))
+                        if (out_it.has_source())
                         {
-                            size_t out_index = source_window_transform.index(source_window_coord);
-                            out[out_index] +=
+                            out[*out_it] +=
                                 delta[delta_transform.index(delta_coord)] / num_elements_in_window;
                         }
                     }
@@ -211,15 +212,15 @@ namespace ngraph
                     T result = 0;
                     size_t n_elements = 0;
 
-                    for (const Coordinate& input_batch_coord : input_batch_transform)
+                    size_t window_size = shape_size(input_batch_transform.get_target_shape());
+                    CoordinateTransform::IndexIterator input_it(input_batch_transform);
+                    for (size_t i = 0; i < window_size; i++, ++input_it)
                     {
-                        bool in_bounds =
-                            input_batch_transform.has_source_coordinate(input_batch_coord);
+                        bool in_bounds = input_it.has_source();
 
                         if (in_bounds || include_padding_in_avg_computation)
                         {
-                            T v =
-                                in_bounds ? arg[input_batch_transform.index(input_batch_coord)] : 0;
+                            T v = in_bounds ? arg[*input_it] : 0;
                             result += v;
                             n_elements++;
                         }
@@ -34,15 +34,11 @@ namespace ngraph
                            const Shape& out_shape,
                            const AxisSet& broadcast_axes)
             {
-                CoordinateTransform input_transform(in_shape);
-                CoordinateTransform output_transform(out_shape);
-
-                for (const Coordinate& output_coord : output_transform)
+                size_t out_size = shape_size(out_shape);
+                CoordinateTransform::IndexIterator input_it(out_shape, broadcast_axes);
+                for (size_t i = 0; i < out_size; i++, ++input_it)
                 {
-                    Coordinate input_coord = reduce(output_coord, broadcast_axes);
-
-                    out[output_transform.index(output_coord)] =
-                        arg[input_transform.index(input_coord)];
+                    out[i] = arg[*input_it];
                 }
             }
         }
@@ -16,7 +16,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/coordinate_transform.hpp"
@@ -28,6 +30,113 @@ namespace ngraph
     {
         namespace reference
         {
+            // Fast path for 2D convolution with N,C,H,W data and output and no data dilation.
+            // The filters are laid out as either (C_out,C_in,H,W) or (C_in,C_out,H,W). Each output
+            // plane is accumulated one filter tap at a time over a block of rows, so the inner
+            // loop is a contiguous multiply-add that the compiler can vectorize. Every output
+            // element still sums its taps in (C_in, H, W) order, as the generic path does.
+            template <typename T>
+            void convolution_2d(const T* arg0,
+                                const T* arg1,
+                                T* out,
+                                const Shape& arg0_shape,
+                                const Shape& arg1_shape,
+                                const Shape& out_shape,
+                                const Strides& window_movement_strides,
+                                const Strides& window_dilation_strides,
+                                const CoordinateDiff& padding_below,
+                                size_t output_channel_axis_filters,
+                                bool rotate_filter)
+            {
+                const size_t batch_size = arg0_shape[0];
+                const size_t in_channels = arg0_shape[1];
+                const size_t in_h = arg0_shape[2];
+                const size_t in_w = arg0_shape[3];
+                const size_t out_channels = out_shape[1];
+                const size_t out_h = out_shape[2];
+                const size_t out_w = out_shape[3];
+                const size_t filter_h = arg1_shape[2];
+                const size_t filter_w = arg1_shape[3];
+                const size_t stride_h = window_movement_strides[0];
+                const size_t stride_w = window_movement_strides[1];
+                const std::ptrdiff_t dilation_h = window_dilation_strides[0];
+                const std::ptrdiff_t dilation_w = window_dilation_strides[1];
+                const std::ptrdiff_t pad_h = padding_below[0];
+                const std::ptrdiff_t pad_w = padding_below[1];
+
+                const size_t filter_size = filter_h * filter_w;
+                const size_t filter_oc_stride =
+                    output_channel_axis_filters == 0 ? in_channels * filter_size : filter_size;
+                const size_t filter_ic_stride =
+                    output_channel_axis_filters == 0 ? filter_size : out_channels * filter_size;
+
+                // For each filter column, the output columns whose input column is not padding
+                std::vector<size_t> col_begin(filter_w);
+                std::vector<size_t> col_end(filter_w);
+                for (size_t kw = 0; kw < filter_w; kw++)
+                {
+                    std::ptrdiff_t offset = static_cast<std::ptrdiff_t>(kw) * dilation_w - pad_w;
+                    std::ptrdiff_t sw = stride_w;
+                    std::ptrdiff_t begin = offset >= 0 ? 0 : (-offset + sw - 1) / sw;
+                    std::ptrdiff_t last = static_cast<std::ptrdiff_t>(in_w) - 1 - offset;
+                    std::ptrdiff_t end = last < 0 ? 0 : last / sw + 1;
+                    col_begin[kw] = static_cast<size_t>(
+                        std::min<std::ptrdiff_t>(begin, static_cast<std::ptrdiff_t>(out_w)));
+                    col_end[kw] = static_cast<size_t>(
+                        std::min<std::ptrdiff_t>(end, static_cast<std::ptrdiff_t>(out_w)));
+                }
+
+                // Rows are processed in blocks that keep the output block in cache while every
+                // tap is applied to it
+                const size_t rows_per_block =
+                    std::max<size_t>(1, 4096 / std::max<size_t>(1, out_w));
+
+                for (size_t plane = 0; plane < batch_size * out_channels; plane++)
+                {
+                    const size_t n = plane / out_channels;
+                    const size_t oc = plane % out_channels;
+                    T* out_plane = out + plane * out_h * out_w;
+                    std::fill(out_plane, out_plane + out_h * out_w, T(0));
+                    for (size_t row_begin = 0; row_begin < out_h; row_begin += rows_per_block)
+                    {
+                        const size_t row_end = std::min(out_h, row_begin + rows_per_block);
+                        for (size_t c = 0; c < in_channels; c++)
+                        {
+                            const T* in_plane = arg0 + (n * in_channels + c) * in_h * in_w;
+                            const T* filter = arg1 + oc * filter_oc_stride + c * filter_ic_stride;
+                            for (size_t tap = 0; tap < filter_size; tap++)
+                            {
+                                const size_t kh = tap / filter_w;
+                                const size_t kw = tap % filter_w;
+                                const T weight =
+                                    filter[rotate_filter ? filter_size - 1 - tap : tap];
+                                const std::ptrdiff_t row_offset =
+                                    static_cast<std::ptrdiff_t>(kh) * dilation_h - pad_h;
+                                const std::ptrdiff_t col_offset =
+                                    static_cast<std::ptrdiff_t>(kw) * dilation_w - pad_w;
+                                for (size_t oh = row_begin; oh < row_end; oh++)
+                                {
+                                    std::ptrdiff_t ih =
+                                        static_cast<std::ptrdiff_t>(oh * stride_h) + row_offset;
+                                    if (ih < 0 || ih >= static_cast<std::ptrdiff_t>(in_h))
+                                    {
+                                        continue;
+                                    }
+                                    const T* in_row = in_plane + ih * in_w;
+                                    T* out_row = out_plane + oh * out_w;
+                                    for (size_t ow = col_begin[kw]; ow < col_end[kw]; ow++)
+                                    {
+                                        std::ptrdiff_t iw =
+                                            static_cast<std::ptrdiff_t>(ow * stride_w) + col_offset;
+                                        out_row[ow] += in_row[iw] * weight;
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
             template <typename T>
             void convolution(const T* arg0,
                              const T* arg1,
@@ -56,6 +165,26 @@ namespace ngraph
                 // * output channel axis for output data is 1
                 // * rotate_filter is false
 
+                if (arg0_shape.size() == 4 && batch_axis_data == 0 &&
+                    input_channel_axis_data == 1 && batch_axis_result == 0 &&
+                    output_channel_axis_result == 1 &&
+                    input_channel_axis_filters + output_channel_axis_filters == 1 &&
+                    data_dilation_strides == Strides(2, 1))
+                {
+                    convolution_2d(arg0,
+                                   arg1,
+                                   out,
+                                   arg0_shape,
+                                   arg1_shape,
+                                   out_shape,
+                                   window_movement_strides,
+                                   window_dilation_strides,
+                                   padding_below,
+                                   output_channel_axis_filters,
+                                   rotate_filter);
+                    return;
+                }
+
                 // At the outermost level we will walk over every output coordinate O.
                 CoordinateTransform output_transform(out_shape);
 
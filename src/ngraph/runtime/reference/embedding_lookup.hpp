@@ -28,20 +28,30 @@ namespace ngraph
     {
         namespace reference
         {
+            // Rows of indices outside the table are zero
             template <typename T, typename U>
             void embedding(const U* indices,
                            const T* weights,
                            T* out,
                            size_t indices_count,
-                           const Shape& out_shape)
+                           const Shape& weights_shape)
             {
-                size_t vec_len = out_shape.at(1);
+                size_t vocab_size = weights_shape.at(0);
+                size_t vec_len = weights_shape.at(1);
                 T* out_iter = out;
                 for (size_t i = 0; i < indices_count; i++)
                 {
-                    memcpy(out_iter,
-                           &weights[vec_len * static_cast<size_t>(indices[i])],
-                           sizeof(T) * vec_len);
+                    U index = indices[i];
+                    if (index >= 0 && static_cast<double>(index) < static_cast<double>(vocab_size))
+                    {
+                        memcpy(out_iter,
+                               &weights[vec_len * static_cast<size_t>(index)],
+                               sizeof(T) * vec_len);
+                    }
+                    else
+                    {
+                        memset(out_iter, 0, sizeof(T) * vec_len);
+                    }
                     out_iter += vec_len;
                 }
             }
@@ -0,0 +1,63 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstring>
+
+#include "ngraph/shape_util.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            // Slices for indices outside the gathered axis of data are zero
+            template <typename T, typename U>
+            void gather(const T* data,
+                        const U* indices,
+                        T* out,
+                        const Shape& data_shape,
+                        size_t indices_count,
+                        size_t axis)
+            {
+                size_t outer = shape_size(Shape(data_shape.begin(), data_shape.begin() + axis));
+                size_t axis_len = data_shape.at(axis);
+                size_t inner = shape_size(Shape(data_shape.begin() + axis + 1, data_shape.end()));
+                T* out_iter = out;
+                for (size_t o = 0; o < outer; o++)
+                {
+                    for (size_t i = 0; i < indices_count; i++)
+                    {
+                        U index = indices[i];
+                        if (index >= 0 && static_cast<size_t>(index) < axis_len)
+                        {
+                            memcpy(out_iter,
+                                   &data[(o * axis_len + static_cast<size_t>(index)) * inner],
+                                   sizeof(T) * inner);
+                        }
+                        else
+                        {
+                            memset(out_iter, 0, sizeof(T) * inner);
+                        }
+                        out_iter += inner;
+                    }
+                }
+            }
+        }
+    }
+}
@@ -93,30 +93,30 @@ namespace ngraph
                         source_window_transform_padding_below,
                         source_window_transform_padding_above);
 
-                    Coordinate argmax_coord;
-                    bool argmax_coord_valid = false;
+                    size_t argmax_index = 0;
+                    bool argmax_index_valid = false;
                     T max_val = 0; // just initializing to keep compiler happy, this 0 is ignored
 
-                    for (const Coordinate& source_window_coord : source_window_transform)
+                    size_t window_size = shape_size(source_window_transform.get_target_shape());
+                    CoordinateTransform::IndexIterator source_it(source_window_transform);
+                    for (size_t i = 0; i < window_size; i++, ++source_it)
                     {
-                        if (source_window_transform.has_source_coordinate(source_window_coord))
+                        if (source_it.has_source())
                         {
-                            T candidate =
-                                arg_forward[source_window_transform.index(source_window_coord)];
+                            T candidate = arg_forward[*source_it];
 
-                            if (!argmax_coord_valid || candidate > max_val)
+                            if (!argmax_index_valid || candidate > max_val)
                             {
                                 max_val = candidate;
-                                argmax_coord = source_window_coord;
-                                argmax_coord_valid = true;
+                                argmax_index = *source_it;
+                                argmax_index_valid = true;
                             }
                         }
                     }
 
-                    if (argmax_coord_valid)
+                    if (argmax_index_valid)
                     {
-                        out[source_window_transform.index(argmax_coord)] +=
-                            delta[delta_transform.index(delta_coord)];
+                        out[argmax_index] += delta[delta_transform.index(delta_coord)];
                     }
                 }
             }
@@ -207,11 +207,13 @@ namespace ngraph
 
                     T result = std::numeric_limits<T>::lowest();
 
-                    for (const Coordinate& input_batch_coord : input_batch_transform)
+                    size_t window_size = shape_size(input_batch_transform.get_target_shape());
+                    CoordinateTransform::IndexIterator input_it(input_batch_transform);
+                    for (size_t i = 0; i < window_size; i++, ++input_it)
                     {
-                        if (input_batch_transform.has_source_coordinate(input_batch_coord))
+                        if (input_it.has_source())
                         {
-                            T x = arg[input_batch_transform.index(input_batch_coord)];
+                            T x = arg[*input_it];
                             result = x > result ? x : result;
                         }
                     }
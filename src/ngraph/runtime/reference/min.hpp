@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 
@@ -42,24 +43,17 @@ namespace ngraph
                 T minval = std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
                                                                 : std::numeric_limits<T>::max();
 
-                CoordinateTransform output_transform(out_shape);
+                std::fill(out, out + shape_size(out_shape), minval);
 
-                for (const Coordinate& output_coord : output_transform)
+                size_t in_size = shape_size(in_shape);
+                CoordinateTransform::IndexIterator output_it(in_shape, reduction_axes);
+                for (size_t i = 0; i < in_size; i++, ++output_it)
                 {
-                    out[output_transform.index(output_coord)] = minval;
-                }
-
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes);
-
-                    T x = arg[input_transform.index(input_coord)];
-                    T min = out[output_transform.index(output_coord)];
+                    T x = arg[i];
+                    T min = out[*output_it];
                     if (x < min)
                     {
-                        out[output_transform.index(output_coord)] = x;
+                        out[*output_it] = x;
                     }
                 }
             }
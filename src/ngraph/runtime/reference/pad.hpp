@@ -74,24 +74,14 @@ namespace ngraph
                                                     padding_below_signed,
                                                     padding_above_signed,
                                                     input_dilation);
-                CoordinateTransform output_transform(out_shape);
 
-                CoordinateTransform::Iterator output_it = output_transform.begin();
+                size_t out_size = shape_size(out_shape);
+                NGRAPH_ASSERT(shape_size(input_transform.get_target_shape()) == out_size);
 
-                NGRAPH_ASSERT(shape_size(input_transform.get_target_shape()) ==
-                              shape_size(output_transform.get_target_shape()));
-
-                for (const Coordinate& in_coord : input_transform)
+                CoordinateTransform::IndexIterator input_it(input_transform);
+                for (size_t i = 0; i < out_size; i++, ++input_it)
                 {
-                    const Coordinate& out_coord = *output_it;
-
-                    T v = input_transform.has_source_coordinate(in_coord)
-                              ? arg0[input_transform.index(in_coord)]
-                              : *arg1;
-
-                    out[output_transform.index(out_coord)] = v;
-
-                    ++output_it;
+                    out[i] = input_it.has_source() ? arg0[*input_it] : *arg1;
                 }
             }
         }
@@ -34,22 +34,28 @@ namespace ngraph
                          const AxisSet& reversed_axes)
             {
                 // In fact arg_shape == out_shape, but we'll use both for stylistic consistency with other kernels.
-                CoordinateTransform arg_transform(arg_shape);
-                CoordinateTransform output_transform(out_shape);
+                // Walking a reversed axis forward walks the argument backward from its last
+                // element along that axis.
+                std::vector<size_t> arg_row_strides = row_major_strides(arg_shape);
+                std::vector<std::ptrdiff_t> arg_strides(arg_shape.size());
+                std::ptrdiff_t arg_offset = 0;
 
-                for (Coordinate out_coord : output_transform)
+                for (size_t i = 0; i < arg_shape.size(); i++)
                 {
-                    Coordinate arg_coord = out_coord;
-
-                    for (size_t i = 0; i < arg_coord.size(); i++)
+                    std::ptrdiff_t stride = arg_row_strides[i];
+                    if (reversed_axes.count(i) != 0)
                     {
-                        if (reversed_axes.count(i) != 0)
-                        {
-                            arg_coord[i] = arg_shape[i] - arg_coord[i] - 1;
-                        }
+                        arg_offset += (static_cast<std::ptrdiff_t>(arg_shape[i]) - 1) * stride;
+                        stride = -stride;
                     }
+                    arg_strides[i] = stride;
+                }
 
-                    out[output_transform.index(out_coord)] = arg[arg_transform.index(arg_coord)];
+                size_t out_size = shape_size(out_shape);
+                CoordinateTransform::IndexIterator arg_it(out_shape, arg_strides, arg_offset);
+                for (size_t i = 0; i < out_size; i++, ++arg_it)
+                {
+                    out[i] = arg[*arg_it];
                 }
             }
         }
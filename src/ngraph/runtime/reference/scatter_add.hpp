@@ -0,0 +1,61 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstring>
+
+#include "ngraph/shape_util.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            // Indices outside the first axis of inputs are skipped
+            template <typename T, typename U>
+            void scatter_add(const T* inputs,
+                             const U* indices,
+                             const T* updates,
+                             T* out,
+                             const Shape& inputs_shape,
+                             size_t indices_count)
+            {
+                size_t num_rows = inputs_shape.at(0);
+                size_t row_len = shape_size(Shape(inputs_shape.begin() + 1, inputs_shape.end()));
+                if (out != inputs)
+                {
+                    memcpy(out, inputs, sizeof(T) * num_rows * row_len);
+                }
+                for (size_t i = 0; i < indices_count; i++)
+                {
+                    U index = indices[i];
+                    if (index < 0 || static_cast<size_t>(index) >= num_rows)
+                    {
+                        continue;
+                    }
+                    T* out_row = &out[row_len * static_cast<size_t>(index)];
+                    const T* update_row = &updates[row_len * i];
+                    for (size_t j = 0; j < row_len; j++)
+                    {
+                        out_row[j] += update_row[j];
+                    }
+                }
+            }
+        }
+    }
+}
@@ -37,20 +37,14 @@ namespace ngraph
                        const Shape& out_shape)
             {
                 CoordinateTransform input_transform(arg_shape, lower_bounds, upper_bounds, strides);
-                CoordinateTransform output_transform(out_shape);
 
-                CoordinateTransform::Iterator output_it = output_transform.begin();
+                size_t out_size = shape_size(out_shape);
+                NGRAPH_ASSERT(shape_size(input_transform.get_target_shape()) == out_size);
 
-                NGRAPH_ASSERT(shape_size(input_transform.get_target_shape()) ==
-                              shape_size(output_transform.get_target_shape()));
-
-                for (const Coordinate& in_coord : input_transform)
+                CoordinateTransform::IndexIterator input_it(input_transform);
+                for (size_t i = 0; i < out_size; i++, ++input_it)
                 {
-                    const Coordinate& out_coord = *output_it;
-
-                    out[output_transform.index(out_coord)] = arg[input_transform.index(in_coord)];
-
-                    ++output_it;
+                    out[i] = arg[*input_it];
                 }
             }
         }
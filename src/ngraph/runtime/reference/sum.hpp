@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 
 #include "ngraph/coordinate_transform.hpp"
@@ -34,26 +35,19 @@ namespace ngraph
                      const Shape& out_shape,
                      const AxisSet& reduction_axes)
             {
-                CoordinateTransform output_transform(out_shape);
-                std::vector<T> c(shape_size(out_shape));
+                size_t out_size = shape_size(out_shape);
+                std::vector<T> c(out_size, 0);
+                std::fill(out, out + out_size, T(0));
 
-                for (const Coordinate& output_coord : output_transform)
+                size_t in_size = shape_size(in_shape);
+                CoordinateTransform::IndexIterator output_it(in_shape, reduction_axes);
+                for (size_t i = 0; i < in_size; i++, ++output_it)
                 {
-                    out[output_transform.index(output_coord)] = 0;
-                    c[output_transform.index(output_coord)] = 0;
-                }
-
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes);
-                    T y = arg[input_transform.index(input_coord)] -
-                          c[output_transform.index(output_coord)];
-                    T t = out[output_transform.index(output_coord)] + y;
-                    c[output_transform.index(output_coord)] =
-                        (t - out[output_transform.index(output_coord)]) - y;
-                    out[output_transform.index(output_coord)] = t;
+                    size_t out_index = *output_it;
+                    T y = arg[i] - c[out_index];
+                    T t = out[out_index] + y;
+                    c[out_index] = (t - out[out_index]) - y;
+                    out[out_index] = t;
                 }
             }
         }
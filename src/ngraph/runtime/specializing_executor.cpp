@@ -0,0 +1,377 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <future>
+#include <sstream>
+
+#include "ngraph/except.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/specializing_executor.hpp"
+#include "ngraph/runtime/tensor.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Copies the leading block that fits in both shapes between two row-major buffers of equal rank
+static void copy_leading_block(const char* src,
+                               const Shape& src_shape,
+                               char* dst,
+                               const Shape& dst_shape,
+                               size_t element_size)
+{
+    size_t rank = src_shape.size();
+    if (rank == 0)
+    {
+        memcpy(dst, src, element_size);
+        return;
+    }
+
+    Shape block(rank);
+    for (size_t i = 0; i < rank; i++)
+    {
+        block[i] = min(src_shape[i], dst_shape[i]);
+    }
+    size_t row_bytes = block.back() * element_size;
+    if (shape_size(block) == 0)
+    {
+        return;
+    }
+
+    // Walk the outer coordinates of the block and copy one innermost row at a time
+    Strides src_strides = row_major_strides(src_shape);
+    Strides dst_strides = row_major_strides(dst_shape);
+    vector<size_t> index(rank - 1, 0);
+    size_t row_count = shape_size(Shape(block.begin(), block.end() - 1));
+    for (size_t r = 0; r < row_count; r++)
+    {
+        size_t src_offset = 0;
+        size_t dst_offset = 0;
+        for (size_t i = 0; i < rank - 1; i++)
+        {
+            src_offset += index[i] * src_strides[i];
+            dst_offset += index[i] * dst_strides[i];
+        }
+        memcpy(dst + dst_offset * element_size, src + src_offset * element_size, row_bytes);
+
+        for (size_t i = rank - 1; i-- > 0;)
+        {
+            if (++index[i] < block[i])
+            {
+                break;
+            }
+            index[i] = 0;
+        }
+    }
+}
+
+runtime::SpecializingExecutor::SpecializingExecutor(const shared_ptr<Backend>& backend,
+                                                    const shared_ptr<Function>& func,
+                                                    size_t max_specializations,
+                                                    const vector<size_t>& buckets)
+    : m_backend(backend)
+    , m_function(func)
+    , m_max_specializations(max_specializations)
+    , m_buckets(buckets)
+    , m_compile_count(0)
+{
+    if (max_specializations == 0)
+    {
+        throw ngraph_error("SpecializingExecutor requires room for at least one specialization");
+    }
+    sort(m_buckets.begin(), m_buckets.end());
+}
+
+runtime::SpecializingExecutor::~SpecializingExecutor()
+{
+    for (auto& entry : m_specializations)
+    {
+        m_backend->remove_compiled_function(entry.second.function);
+    }
+}
+
+shared_ptr<Function>
+    runtime::SpecializingExecutor::specialize(const vector<Shape>& input_shapes) const
+{
+    // Clone the function onto static parameters and let shape inference make it static
+    NodeMap node_map;
+    const ParameterVector& params = m_function->get_parameters();
+    for (size_t i = 0; i < params.size(); i++)
+    {
+        node_map.add(params[i],
+                     make_shared<op::Parameter>(params[i]->get_element_type(),
+                                                input_shapes[i],
+                                                params[i]->get_cacheable()));
+    }
+    shared_ptr<Function> specialized = clone_function(*m_function, node_map);
+
+    for (size_t i = 0; i < specialized->get_output_size(); i++)
+    {
+        if (specialized->get_output_partial_shape(i).is_dynamic())
+        {
+            stringstream ss;
+            ss << "Result " << i << " is still dynamic after specializing the parameters";
+            throw ngraph_error(ss.str());
+        }
+    }
+    return specialized;
+}
+
+vector<Shape> runtime::SpecializingExecutor::get_key(const vector<Shape>& input_shapes) const
+{
+    const ParameterVector& params = m_function->get_parameters();
+    if (input_shapes.size() != params.size())
+    {
+        throw ngraph_error("SpecializingExecutor call does not match the Function's signature");
+    }
+
+    vector<Shape> key = input_shapes;
+    for (size_t i = 0; i < params.size(); i++)
+    {
+        const PartialShape& pshape = params[i]->get_output_partial_shape(0);
+        if (!pshape.compatible(PartialShape(input_shapes[i])))
+        {
+            stringstream ss;
+            ss << "Input " << i << " shape {" << join(input_shapes[i])
+               << "} does not match Parameter " << params[i]->get_name();
+            throw ngraph_error(ss.str());
+        }
+        for (size_t axis = 0; axis < key[i].size(); axis++)
+        {
+            if (pshape.rank().is_static() && pshape[axis].is_static())
+            {
+                continue;
+            }
+            auto bucket = lower_bound(m_buckets.begin(), m_buckets.end(), key[i][axis]);
+            if (bucket != m_buckets.end())
+            {
+                key[i][axis] = *bucket;
+            }
+        }
+    }
+    return key;
+}
+
+shared_ptr<Function> runtime::SpecializingExecutor::acquire(const vector<Shape>& key)
+{
+    unique_lock<mutex> lock(m_mutex);
+
+    while (true)
+    {
+        auto it = m_specializations.find(key);
+        if (it != m_specializations.end())
+        {
+            m_lru.splice(m_lru.begin(), m_lru, it->second.lru_position);
+            m_running[it->second.function.get()]++;
+            return it->second.function;
+        }
+
+        auto compiling = m_compiling.find(key);
+        if (compiling == m_compiling.end())
+        {
+            break;
+        }
+        // Another call is compiling these shapes; wait for it and look again, since the
+        // specialisation may already have been evicted. A failed compile is rethrown here.
+        shared_future<void> compiled = compiling->second;
+        lock.unlock();
+        compiled.get();
+        lock.lock();
+    }
+
+    // Compile without holding the lock, so calls on other specialisations keep running
+    promise<void> compiled;
+    m_compiling[key] = compiled.get_future().share();
+    lock.unlock();
+
+    shared_ptr<Function> function;
+    try
+    {
+        function = specialize(key);
+        m_backend->compile(function);
+    }
+    catch (...)
+    {
+        lock.lock();
+        m_compiling.erase(key);
+        compiled.set_exception(current_exception());
+        throw;
+    }
+
+    lock.lock();
+    m_compiling.erase(key);
+    m_compile_count++;
+
+    m_lru.push_front(key);
+    m_specializations[key] = Specialization{function, m_lru.begin()};
+    if (m_specializations.size() > m_max_specializations)
+    {
+        auto evicted = m_specializations.find(m_lru.back());
+        if (m_running.count(evicted->second.function.get()) != 0)
+        {
+            m_evicted[evicted->second.function.get()] = evicted->second.function;
+        }
+        else
+        {
+            m_backend->remove_compiled_function(evicted->second.function);
+        }
+        m_specializations.erase(evicted);
+        m_lru.pop_back();
+    }
+
+    m_running[function.get()]++;
+    compiled.set_value();
+    return function;
+}
+
+void runtime::SpecializingExecutor::release(const shared_ptr<Function>& function)
+{
+    lock_guard<mutex> lock(m_mutex);
+    auto running = m_running.find(function.get());
+    if (--running->second == 0)
+    {
+        m_running.erase(running);
+        if (m_evicted.erase(function.get()) != 0)
+        {
+            m_backend->remove_compiled_function(function);
+        }
+    }
+}
+
+void runtime::SpecializingExecutor::call(const vector<shared_ptr<Tensor>>& outputs,
+                                         const vector<shared_ptr<Tensor>>& inputs)
+{
+    vector<Shape> input_shapes;
+    for (const shared_ptr<Tensor>& input : inputs)
+    {
+        input_shapes.push_back(input->get_shape());
+    }
+    vector<Shape> key = get_key(input_shapes);
+    if (outputs.size() != m_function->get_output_size())
+    {
+        throw ngraph_error("SpecializingExecutor call does not match the Function's signature");
+    }
+
+    shared_ptr<Function> function = acquire(key);
+    try
+    {
+        bool padded = key != input_shapes;
+        for (size_t i = 0; i < outputs.size(); i++)
+        {
+            const Shape& shape = function->get_output_shape(i);
+            const Shape& output_shape = outputs[i]->get_shape();
+            bool fits = output_shape.size() == shape.size();
+            for (size_t axis = 0; fits && axis < shape.size(); axis++)
+            {
+                fits = padded ? output_shape[axis] <= shape[axis]
+                              : output_shape[axis] == shape[axis];
+            }
+            if (outputs[i]->get_element_type() != function->get_output_element_type(i) || !fits)
+            {
+                stringstream ss;
+                ss << "Output " << i << " does not match Result " << i << " of shape {"
+                   << join(shape) << "}";
+                throw ngraph_error(ss.str());
+            }
+        }
+
+        if (!padded)
+        {
+            m_backend->call(function, outputs, inputs);
+        }
+        else
+        {
+            // Stage the inputs in zero-filled tensors of the bucket shapes, and copy the leading
+            // block of each padded result back
+            vector<shared_ptr<Tensor>> padded_inputs;
+            vector<char> staging;
+            vector<char> padded_data;
+            for (size_t i = 0; i < inputs.size(); i++)
+            {
+                const element::Type& type = inputs[i]->get_element_type();
+                padded_inputs.push_back(m_backend->create_tensor(type, key[i]));
+                staging.resize(shape_size(input_shapes[i]) * type.size());
+                inputs[i]->read(staging.data(), 0, staging.size());
+                padded_data.assign(shape_size(key[i]) * type.size(), 0);
+                copy_leading_block(
+                    staging.data(), input_shapes[i], padded_data.data(), key[i], type.size());
+                padded_inputs.back()->write(padded_data.data(), 0, padded_data.size());
+            }
+
+            vector<shared_ptr<Tensor>> padded_outputs;
+            for (size_t i = 0; i < outputs.size(); i++)
+            {
+                padded_outputs.push_back(m_backend->create_tensor(
+                    function->get_output_element_type(i), function->get_output_shape(i)));
+            }
+
+            m_backend->call(function, padded_outputs, padded_inputs);
+
+            for (size_t i = 0; i < outputs.size(); i++)
+            {
+                const element::Type& type = outputs[i]->get_element_type();
+                const Shape& padded_shape = function->get_output_shape(i);
+                padded_data.resize(shape_size(padded_shape) * type.size());
+                padded_outputs[i]->read(padded_data.data(), 0, padded_data.size());
+                staging.resize(shape_size(outputs[i]->get_shape()) * type.size());
+                copy_leading_block(padded_data.data(),
+                                   padded_shape,
+                                   staging.data(),
+                                   outputs[i]->get_shape(),
+                                   type.size());
+                outputs[i]->write(staging.data(), 0, staging.size());
+            }
+        }
+    }
+    catch (...)
+    {
+        release(function);
+        throw;
+    }
+    release(function);
+}
+
+vector<Shape>
+    runtime::SpecializingExecutor::get_output_shapes(const vector<Shape>& input_shapes) const
+{
+    // Checks the shapes against the parameters
+    get_key(input_shapes);
+
+    shared_ptr<Function> specialized = specialize(input_shapes);
+    vector<Shape> shapes;
+    for (size_t i = 0; i < specialized->get_output_size(); i++)
+    {
+        shapes.push_back(specialized->get_output_shape(i));
+    }
+    return shapes;
+}
+
+size_t runtime::SpecializingExecutor::get_specialization_count()
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_specializations.size();
+}
+
+size_t runtime::SpecializingExecutor::get_compile_count()
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_compile_count;
+}
@@ -0,0 +1,112 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <future>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class Backend;
+        class Tensor;
+        class SpecializingExecutor;
+    }
+}
+
+/// \brief Runs a Function whose parameters have dynamic dimensions by compiling one static copy
+/// of it per concrete input shape.
+///
+/// On a call with input shapes that have not been seen, the Function is cloned onto parameters
+/// of those shapes, shape inference makes the clone fully static, and it is compiled by the
+/// backend, which runs its usual pass pipeline. Compiled specialisations are cached keyed on
+/// the input shapes. When more than `max_specializations` are cached, the least recently used
+/// one is removed from the backend.
+///
+/// With `buckets`, every dynamic dimension is rounded up to the smallest bucket that holds it,
+/// so that nearby sizes share a specialisation. Inputs are then zero-padded at the end of each
+/// rounded axis and the leading block of every result is copied back. This is only correct
+/// when padding an axis does not change the unpadded part of the results, e.g. for ops that
+/// act on each sequence position independently. Dimensions larger than the last bucket are
+/// not rounded.
+class ngraph::runtime::SpecializingExecutor
+{
+public:
+    SpecializingExecutor(const std::shared_ptr<Backend>& backend,
+                         const std::shared_ptr<Function>& func,
+                         size_t max_specializations = 16,
+                         const std::vector<size_t>& buckets = {});
+    ~SpecializingExecutor();
+
+    /// \brief Run the Function on inputs of any shape its parameters accept, compiling a
+    ///     specialisation for their shapes first if none is cached.
+    /// \param outputs Tensors of the shapes returned by `get_output_shapes` for the inputs
+    void call(const std::vector<std::shared_ptr<Tensor>>& outputs,
+              const std::vector<std::shared_ptr<Tensor>>& inputs);
+
+    /// \brief Shapes of the results for inputs of the given shapes, found by shape inference
+    ///     alone, so that the outputs of a call can be allocated.
+    std::vector<Shape> get_output_shapes(const std::vector<Shape>& input_shapes) const;
+
+    /// \brief Number of specialisations currently cached
+    size_t get_specialization_count();
+    /// \brief Number of specialisations compiled so far, including evicted ones
+    size_t get_compile_count();
+
+private:
+    SpecializingExecutor(const SpecializingExecutor&) = delete;
+    SpecializingExecutor(SpecializingExecutor&&) = delete;
+    SpecializingExecutor& operator=(const SpecializingExecutor&) = delete;
+
+    struct Specialization
+    {
+        std::shared_ptr<Function> function;
+        std::list<std::vector<Shape>>::iterator lru_position;
+    };
+
+    std::shared_ptr<Function> specialize(const std::vector<Shape>& input_shapes) const;
+    std::vector<Shape> get_key(const std::vector<Shape>& input_shapes) const;
+    std::shared_ptr<Function> acquire(const std::vector<Shape>& key);
+    void release(const std::shared_ptr<Function>& function);
+
+    std::shared_ptr<Backend> m_backend;
+    std::shared_ptr<Function> m_function;
+    size_t m_max_specializations;
+    std::vector<size_t> m_buckets;
+    size_t m_compile_count;
+
+    std::map<std::vector<Shape>, Specialization> m_specializations;
+    // Keys of m_specializations, most recently used first
+    std::list<std::vector<Shape>> m_lru;
+    // Number of calls running each specialisation; evicted ones stay compiled until their
+    // last call returns
+    std::map<Function*, size_t> m_running;
+    std::map<Function*, std::shared_ptr<Function>> m_evicted;
+    // Shapes being compiled, which other calls for the same shapes wait on; compiling happens
+    // outside m_mutex
+    std::map<std::vector<Shape>, std::shared_future<void>> m_compiling;
+    std::mutex m_mutex;
+};
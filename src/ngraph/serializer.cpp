@@ -51,6 +51,7 @@
 #include "ngraph/op/experimental/shape_of.hpp"
 #include "ngraph/op/floor.hpp"
 #include "ngraph/op/function_call.hpp"
+#include "ngraph/op/gather.hpp"
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/greater.hpp"
 #include "ngraph/op/greater_eq.hpp"
@@ -82,6 +83,7 @@
 #include "ngraph/op/result.hpp"
 #include "ngraph/op/reverse.hpp"
 #include "ngraph/op/reverse_sequence.hpp"
+#include "ngraph/op/scatter_add.hpp"
 #include "ngraph/op/select.hpp"
 #include "ngraph/op/select_and_scatter.hpp"
 #include "ngraph/op/sigmoid.hpp"
@@ -97,6 +99,7 @@
 #include "ngraph/op/tan.hpp"
 #include "ngraph/op/tanh.hpp"
 #include "ngraph/op/topk.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 #include "nlohmann/json.hpp"
@@ -106,6 +109,10 @@ using namespace std;
 using json = nlohmann::json;
 using const_data_callback_t = shared_ptr<Node>(const string&, const element::Type&, const Shape&);
 
+// Constant data is stored at this alignment in serialized archives so that a loaded model can
+// use it in place
+static const size_t s_constant_alignment = 64;
+
 // This expands the op list in op_tbl.hpp into a list of enumerations that look like this:
 // Abs,
 // Acos,
@@ -273,7 +280,8 @@ void ngraph::serialize(ostream& out, shared_ptr<ngraph::Function> func, size_t i
                                uint32_t size =
                                    static_cast<uint32_t>(shape_size(c->get_output_shape(0)) *
                                                          c->get_output_element_type(0).size());
-                               writer.write(c->get_name(), c->get_data_ptr(), size);
+                               writer.write(
+                                   c->get_name(), c->get_data_ptr(), size, s_constant_alignment);
                            }
                        },
                        true);
@@ -309,47 +317,65 @@ std::string ngraph::serialize(std::shared_ptr<ngraph::Function> func, size_t ind
     return ::serialize(func, indent, false);
 }
 
-shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
+// Loads a cpio archive. If mapping holds the whole archive then aligned constant data is used
+// in place, otherwise it is read into buffers owned by the constants.
+static shared_ptr<ngraph::Function> deserialize_cpio(cpio::Reader& reader,
+                                                     const shared_ptr<char>& mapping)
 {
     shared_ptr<Function> rc;
-    if (cpio::is_cpio(in))
+    const vector<cpio::FileInfo>& file_info = reader.get_file_info();
+    if (file_info.size() > 0)
     {
-        cpio::Reader reader(in);
-        vector<cpio::FileInfo> file_info = reader.get_file_info();
-        if (file_info.size() > 0)
+        // The first file is the model
+        string jstr(file_info[0].get_size(), 0);
+        reader.read(file_info[0].get_name(), &jstr[0], jstr.size());
+        json js = json::parse(jstr);
+        unordered_map<string, shared_ptr<Function>> function_map;
+        for (json func : js)
         {
-            // The first file is the model
-            uint32_t size = static_cast<uint32_t>(file_info[0].get_size());
-            char* data = new char[size];
-            reader.read(file_info[0].get_name(), data, size);
-            string jstr(data, size);
-            delete[] data;
-            json js = json::parse(jstr);
-            unordered_map<string, shared_ptr<Function>> function_map;
-            for (json func : js)
-            {
-                shared_ptr<Function> f = read_function(
-                    func,
-                    function_map,
-                    [&](const string& const_name, const element::Type& et, const Shape& shape) {
-                        shared_ptr<Node> const_node;
-                        for (const cpio::FileInfo& info : file_info)
+            shared_ptr<Function> f = read_function(
+                func,
+                function_map,
+                [&](const string& const_name, const element::Type& et, const Shape& shape) {
+                    shared_ptr<Node> const_node;
+                    if (const cpio::FileInfo* info = reader.find(const_name))
+                    {
+                        size_t size = info->get_size();
+                        if (size != shape_size(shape) * et.size())
                         {
-                            if (info.get_name() == const_name)
-                            {
-                                void* const_data = malloc(info.get_size());
-                                reader.read(const_name, const_data, info.get_size());
-                                const_node = make_shared<op::Constant>(et, shape, const_data);
-                                free(const_data);
-                                break;
-                            }
+                            throw ngraph_error("Constant '" + const_name +
+                                               "' data size does not match its shape");
                         }
-                        return const_node;
-                    });
-                rc = f;
-            }
+                        shared_ptr<void> data;
+                        if (mapping && info->get_offset() % s_constant_alignment == 0)
+                        {
+                            data = shared_ptr<void>(mapping, mapping.get() + info->get_offset());
+                        }
+                        else
+                        {
+                            auto buffer =
+                                make_shared<runtime::AlignedBuffer>(size, s_constant_alignment);
+                            reader.read(const_name, buffer->get_ptr(), size);
+                            data = shared_ptr<void>(buffer, buffer->get_ptr());
+                        }
+                        const_node = make_shared<op::Constant>(et, shape, data);
+                    }
+                    return const_node;
+                });
+            rc = f;
         }
     }
+    return rc;
+}
+
+shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
+{
+    shared_ptr<Function> rc;
+    if (cpio::is_cpio(in))
+    {
+        cpio::Reader reader(in);
+        rc = deserialize_cpio(reader, nullptr);
+    }
     else
     {
         // json file?
@@ -366,8 +392,19 @@ shared_ptr<ngraph::Function> ngraph::deserialize(const string& s)
     if (file_util::exists(s))
     {
         // s is a file and not a json string
-        ifstream in(s, ios_base::binary | ios_base::in);
-        rc = deserialize(in);
+        if (cpio::is_cpio(s))
+        {
+            // Map the archive so that constants reference the file's pages instead of copies
+            size_t size;
+            shared_ptr<char> mapping = file_util::map_file_contents(s, size);
+            cpio::Reader reader(s);
+            rc = deserialize_cpio(reader, mapping);
+        }
+        else
+        {
+            ifstream in(s, ios_base::binary | ios_base::in);
+            rc = deserialize(in);
+        }
     }
     else
     {
@@ -762,6 +799,12 @@ static shared_ptr<ngraph::Function>
                 node = make_shared<op::FunctionCall>(f_ptr, args);
                 break;
             }
+            case OP_TYPEID::Gather:
+            {
+                auto axis = node_js.at("axis").get<size_t>();
+                node = make_shared<op::Gather>(args[0], args[1], axis);
+                break;
+            }
             case OP_TYPEID::GenerateMask:
             {
                 auto output_shape = node_js.at("output_shape").get<vector<size_t>>();
@@ -1038,6 +1081,11 @@ static shared_ptr<ngraph::Function>
                 node = make_shared<op::ScalarConstantLike>(args[0], value);
                 break;
             }
+            case OP_TYPEID::ScatterAdd:
+            {
+                node = make_shared<op::ScatterAdd>(args[0], args[1], args[2]);
+                break;
+            }
             case OP_TYPEID::Select:
             {
                 node = make_shared<op::Select>(args[0], args[1], args[2]);
@@ -1445,6 +1493,12 @@ static json write(const Node& n, bool binary_constant_data)
         node["function"] = n.get_functions()[0]->get_name();
         break;
     }
+    case OP_TYPEID::Gather:
+    {
+        auto tmp = dynamic_cast<const op::Gather*>(&n);
+        node["axis"] = tmp->get_axis();
+        break;
+    }
     case OP_TYPEID::GetOutputElement:
     {
         auto tmp = dynamic_cast<const op::GetOutputElement*>(&n);
@@ -1619,6 +1673,8 @@ static json write(const Node& n, bool binary_constant_data)
         node["element_type"] = write_element_type(constant->get_element_type());
         break;
     }
+    case OP_TYPEID::ScatterAdd: { break;
+    }
     case OP_TYPEID::Select: { break;
     }
     case OP_TYPEID::SelectAndScatter:
@@ -53,6 +53,8 @@ namespace ngraph
     std::shared_ptr<ngraph::Function> deserialize(std::istream& in);
 
     /// \brief Deserialize a Function
-    /// \param str The json formatted string to deseriailze.
+    /// \param str The json formatted string to deseriailze, or the path of a file. Constants
+    ///    of a CPIO file are used in place from a private memory mapping of the file, so the
+    ///    file must not be truncated while the Function is alive.
     std::shared_ptr<ngraph::Function> deserialize(const std::string& str);
 }
@@ -21,6 +21,7 @@
 #include <memory>
 
 #include "gtest/gtest.h"
+#include "ngraph/autodiff/adjoints.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
@@ -31,12 +32,14 @@
 #include "ngraph/op/constant.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/divide.hpp"
+#include "ngraph/op/embedding_lookup.hpp"
 #include "ngraph/op/exp.hpp"
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/log.hpp"
 #include "ngraph/op/multiply.hpp"
 #include "ngraph/op/negative.hpp"
 #include "ngraph/op/product.hpp"
+#include "ngraph/op/scatter_add.hpp"
 #include "ngraph/op/sqrt.hpp"
 #include "ngraph/op/subtract.hpp"
 #include "ngraph/op/sum.hpp"
@@ -583,3 +586,36 @@ TEST(algebraic_simplification, log_no_divide)
     pass_manager.run_passes(f);
     ASSERT_EQ(neg_inner->get_argument(0), log_mul);
 }
+
+TEST(algebraic_simplification, sparse_embedding_sgd_update)
+{
+    auto indices = make_shared<op::Parameter>(element::i32, Shape{8});
+    auto weights = make_shared<op::Parameter>(element::f32, Shape{1000, 16});
+    auto delta = make_shared<op::Parameter>(element::f32, Shape{8, 16});
+    auto embed = make_shared<op::EmbeddingLookup>(indices, weights);
+
+    autodiff::Adjoints adjoints(NodeVector{embed}, NodeVector{delta});
+    auto grad = adjoints.backprop_node(weights);
+    auto learning_rate = op::Constant::create(element::f32, Shape{}, {0.1f});
+    auto scaled_grad =
+        make_shared<op::Broadcast>(learning_rate, Shape{1000, 16}, AxisSet{0, 1}) * grad;
+    auto update = weights - scaled_grad;
+    auto f = make_shared<Function>(NodeVector{update}, ParameterVector{indices, weights, delta});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AlgebraicSimplification>();
+    pass_manager.run_passes(f);
+
+    // The update only touches the looked up rows, scaled by the negated learning rate
+    auto scatter_add =
+        dynamic_pointer_cast<op::ScatterAdd>(f->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(scatter_add);
+    ASSERT_EQ(scatter_add->get_argument(0), weights);
+    ASSERT_EQ(scatter_add->get_argument(1), indices);
+    auto neg = dynamic_pointer_cast<op::Negative>(scatter_add->get_argument(2));
+    ASSERT_TRUE(neg);
+    auto mul = dynamic_pointer_cast<op::Multiply>(neg->get_argument(0));
+    ASSERT_TRUE(mul);
+    ASSERT_EQ(mul->get_argument(1), delta);
+    ASSERT_EQ(count_ops_of_type<op::ScatterAdd>(f), 1);
+}
@@ -22,6 +22,7 @@
 #include "gtest/gtest.h"
 
 #include "ngraph/ngraph.hpp"
+#include "ngraph/op/embedding_lookup.hpp"
 #include "ngraph/runtime/reference/avg_pool.hpp"
 #include "util/autodiff/backprop_function.hpp"
 #include "util/autodiff/numeric_compare.hpp"
@@ -1750,3 +1751,68 @@ NGRAPH_TEST(${BACKEND_NAME}, backwards_reverse_sequence_n4d2c3h2w2)
     backend->call_with_validate(backend->compile(df), {da, db}, {a, b, c});
     ASSERT_EQ(read_vector<int>(da), expected);
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, backwards_embedding_lookup_duplicate_indices)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    Shape shape{4};
+    Shape wshape{5, 2};
+    Shape rshape{4, 2};
+    auto A = make_shared<op::Parameter>(element::i32, shape);
+    auto W = make_shared<op::Parameter>(element::f32, wshape);
+    auto f = make_shared<Function>(make_shared<op::EmbeddingLookup>(A, W), ParameterVector{A, W});
+
+    auto a = backend->create_tensor(element::i32, shape);
+    copy_data(a, vector<int>{1, 3, 1, 0});
+    auto w = backend->create_tensor(element::f32, wshape);
+    copy_data(w, vector<float>(shape_size(wshape), 0));
+    auto c = backend->create_tensor(element::f32, rshape);
+    copy_data(c, vector<float>{1, 2, 3, 4, 5, 6, 7, 8});
+    auto da = backend->create_tensor(element::i32, shape);
+    auto dw = backend->create_tensor(element::f32, wshape);
+
+    auto df = autodiff::backprop_function(f);
+    backend->call_with_validate(backend->compile(df), {da, dw}, {a, w, c});
+    vector<float> expected{7, 8, 6, 8, 0, 0, 3, 4, 0, 0};
+    ASSERT_EQ(read_vector<float>(dw), expected);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, backwards_scatter_add)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    Shape shape{4, 3};
+    Shape ushape{3, 3};
+    auto x0 = rng.initialize(backend->create_tensor<float>(shape));
+    auto x1 = rng.initialize(backend->create_tensor<float>(ushape));
+
+    auto make_graph = [shape, ushape]() {
+        auto X0 = make_shared<op::Parameter>(element::f32, shape);
+        auto X1 = make_shared<op::Parameter>(element::f32, ushape);
+        auto indices = op::Constant::create(element::i64, Shape{3}, {2, 0, 2});
+        return make_shared<Function>(make_shared<op::ScatterAdd>(X0, indices, X1) * X0,
+                                     std::vector<std::shared_ptr<op::Parameter>>{X0, X1});
+    };
+    EXPECT_TRUE(autodiff_numeric_compare<float>(backend.get(), make_graph, {x0, x1}, .01f, .01f));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, backwards_gather_axis_1)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    Shape shape{2, 4, 3};
+    auto x0 = rng.initialize(backend->create_tensor<float>(shape));
+
+    auto make_graph = [shape]() {
+        auto X0 = make_shared<op::Parameter>(element::f32, shape);
+        // Index 3 is never gathered, index 1 is gathered twice
+        auto indices = op::Constant::create(element::i32, Shape{2, 2}, {1, 0, 2, 1});
+        auto gather = make_shared<op::Gather>(X0, indices, 1);
+        return make_shared<Function>(gather * gather,
+                                     std::vector<std::shared_ptr<op::Parameter>>{X0});
+    };
+    EXPECT_TRUE(autodiff_numeric_compare<float>(backend.get(), make_graph, {x0}, .01f, .01f));
+}
@@ -14,9 +14,14 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
 #include <random>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -75,3 +80,111 @@ TEST(INTERPRETER, nan_check_output)
     ibackend->set_nan_check(handle, true);
     EXPECT_ANY_THROW(ibackend->call_with_validate(handle, {result}, {a, b}));
 }
+
+TEST(INTERPRETER, failed_compile_is_not_cached)
+{
+    // The interpreter has no bf16 kernels, so building the execution plan fails
+    Shape shape{4};
+    auto A = make_shared<op::Parameter>(element::bf16, shape);
+    auto f = make_shared<Function>(make_shared<op::Negative>(A), ParameterVector{A});
+
+    shared_ptr<runtime::Backend> backend = runtime::Backend::create("INTERPRETER");
+    EXPECT_THROW(backend->compile(f), ngraph_error);
+
+    // A second attempt fails the same way instead of returning the half-built plan
+    EXPECT_THROW(backend->compile(f), ngraph_error);
+    auto a = backend->create_tensor(element::bf16, shape);
+    auto result = backend->create_tensor(element::bf16, shape);
+    EXPECT_THROW(backend->call(f, {result}, {a}), runtime_error);
+}
+
+namespace
+{
+    // Abs that blocks the first walk of the graph after close() until open(). The compile
+    // is the only walk of this graph in the test.
+    class GatedAbs : public op::Abs
+    {
+    public:
+        GatedAbs(const shared_ptr<Node>& arg)
+            : op::Abs(arg)
+        {
+        }
+
+        NodeVector get_arguments() const override
+        {
+            unique_lock<mutex> lock(m_mutex);
+            if (m_closed)
+            {
+                m_entered = true;
+                m_cv.notify_all();
+                m_cv.wait(lock, [this] { return !m_closed; });
+            }
+            lock.unlock();
+            return op::Abs::get_arguments();
+        }
+
+        void close()
+        {
+            lock_guard<mutex> lock(m_mutex);
+            m_closed = true;
+        }
+
+        void wait_until_entered()
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_cv.wait(lock, [this] { return m_entered; });
+        }
+
+        void open()
+        {
+            lock_guard<mutex> lock(m_mutex);
+            m_closed = false;
+            m_cv.notify_all();
+        }
+
+    private:
+        mutable mutex m_mutex;
+        mutable condition_variable m_cv;
+        bool m_closed = false;
+        mutable bool m_entered = false;
+    };
+}
+
+TEST(INTERPRETER, compile_does_not_block_calls)
+{
+    Shape shape{4};
+    shared_ptr<runtime::Backend> backend = runtime::Backend::create("INTERPRETER");
+
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto compiled = make_shared<Function>(make_shared<op::Negative>(A), ParameterVector{A});
+    backend->compile(compiled);
+
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto gated = make_shared<GatedAbs>(B);
+    auto slow = make_shared<Function>(gated, ParameterVector{B});
+    gated->close();
+    auto slow_compile = async(launch::async, [&] { backend->compile(slow); });
+    gated->wait_until_entered();
+
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, -2, 3, -4});
+    auto result = backend->create_tensor(element::f32, shape);
+    auto call = async(launch::async, [&] { backend->call(compiled, {result}, {a}); });
+    bool call_finished = call.wait_for(chrono::seconds(10)) == future_status::ready;
+    auto b = backend->create_tensor(element::f32, shape);
+    auto slow_result = backend->create_tensor(element::f32, shape);
+    if (call_finished)
+    {
+        // The function being compiled is not callable yet
+        EXPECT_THROW(backend->call(slow, {slow_result}, {b}), runtime_error);
+    }
+    gated->open();
+    slow_compile.get();
+    call.get();
+    ASSERT_TRUE(call_finished);
+    EXPECT_EQ((vector<float>{-1, 2, -3, 4}), read_vector<float>(result));
+
+    copy_data(b, vector<float>{1, -2, 3, -4});
+    backend->call(slow, {slow_result}, {b});
+    EXPECT_EQ((vector<float>{1, 2, 3, 4}), read_vector<float>(slow_result));
+}
@@ -18,12 +18,15 @@
 #include <cinttypes>
 #include <cmath>
 #include <cstdlib>
+#include <numeric>
 #include <random>
 #include <string>
 
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/op/embedding_lookup.hpp"
+#include "ngraph/op/gather.hpp"
+#include "ngraph/op/scatter_add.hpp"
 #include "util/all_close.hpp"
 #include "util/all_close_f.hpp"
 #include "util/ndarray.hpp"
@@ -103,3 +106,126 @@ NGRAPH_TEST(${BACKEND_NAME}, embedding_lookup_10x1_arbitrary_index_type_int)
     vector<float> expected{9.5, 2.5, 1.5, 0.5, 3.5, 5.5, 4.5, 6.5, 8.5, 7.5};
     EXPECT_TRUE(test::all_close(expected, read_vector<float>(result0)));
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, embedding_lookup_2x3_index_type_int64_out_of_range)
+{
+    Shape shape{2, 3};
+    Shape wshape{4, 2};
+    Shape rshape{2, 3, 2};
+    auto A = make_shared<op::Parameter>(element::i64, shape);
+    auto B = make_shared<op::Parameter>(element::f32, wshape);
+    auto embed = make_shared<op::EmbeddingLookup>(A, B);
+    auto f0 = make_shared<Function>(NodeVector{embed}, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Rows of indices outside the table are zero
+    auto a = backend->create_tensor(element::i64, shape);
+    copy_data(a, vector<int64_t>{3, -1, 0, 4, 1, 1});
+    auto b = backend->create_tensor(element::f32, wshape);
+    copy_data(b, vector<float>{0.5, 1.5, 2.5, 3.5, 4.5, 5.5, 6.5, 7.5});
+    auto result0 = backend->create_tensor(element::f32, rshape);
+    backend->call_with_validate(backend->compile(f0), {result0}, {a, b});
+    vector<float> expected{6.5, 7.5, 0, 0, 0.5, 1.5, 0, 0, 2.5, 3.5, 2.5, 3.5};
+    EXPECT_TRUE(test::all_close(expected, read_vector<float>(result0)));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, scatter_add_4x2_duplicate_indices)
+{
+    Shape shape{4, 2};
+    Shape ishape{5};
+    Shape ushape{5, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto I = make_shared<op::Parameter>(element::i32, ishape);
+    auto U = make_shared<op::Parameter>(element::f32, ushape);
+    auto scatter = make_shared<op::ScatterAdd>(A, I, U);
+    auto f0 = make_shared<Function>(NodeVector{scatter}, ParameterVector{A, I, U});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Repeated indices accumulate and indices outside the table are skipped
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{0, 1, 2, 3, 4, 5, 6, 7});
+    auto i = backend->create_tensor(element::i32, ishape);
+    copy_data(i, vector<int>{3, 1, 3, 4, -1});
+    auto u = backend->create_tensor(element::f32, ushape);
+    copy_data(u, vector<float>{10, 20, 30, 40, 50, 60, 70, 80, 90, 100});
+    auto result0 = backend->create_tensor(element::f32, shape);
+    backend->call_with_validate(backend->compile(f0), {result0}, {a, i, u});
+    vector<float> expected{0, 1, 32, 43, 4, 5, 66, 87};
+    EXPECT_TRUE(test::all_close(expected, read_vector<float>(result0)));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, scatter_add_3x2x2_index_type_int64_matrix)
+{
+    Shape shape{3, 2, 2};
+    Shape ishape{2, 2};
+    Shape ushape{2, 2, 2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto I = make_shared<op::Parameter>(element::i64, ishape);
+    auto U = make_shared<op::Parameter>(element::f32, ushape);
+    auto scatter = make_shared<op::ScatterAdd>(A, I, U);
+    auto f0 = make_shared<Function>(NodeVector{scatter}, ParameterVector{A, I, U});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>(shape_size(shape), 1));
+    auto i = backend->create_tensor(element::i64, ishape);
+    copy_data(i, vector<int64_t>{2, 0, 2, 2});
+    auto u = backend->create_tensor(element::f32, ushape);
+    vector<float> updates(shape_size(ushape));
+    iota(updates.begin(), updates.end(), 0);
+    copy_data(u, updates);
+    auto result0 = backend->create_tensor(element::f32, shape);
+    backend->call_with_validate(backend->compile(f0), {result0}, {a, i, u});
+    vector<float> expected{5, 6, 7, 8, 1, 1, 1, 1, 21, 24, 27, 30};
+    EXPECT_TRUE(test::all_close(expected, read_vector<float>(result0)));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, gather_3x2_index_type_int32_out_of_range)
+{
+    Shape shape{3, 2};
+    Shape ishape{2, 2};
+    Shape rshape{2, 2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto I = make_shared<op::Parameter>(element::i32, ishape);
+    auto gather = make_shared<op::Gather>(A, I);
+    auto f0 = make_shared<Function>(NodeVector{gather}, ParameterVector{A, I});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Rows for indices outside the first axis are zero
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4, 5, 6});
+    auto i = backend->create_tensor(element::i32, ishape);
+    copy_data(i, vector<int>{2, 0, 3, 2});
+    auto result0 = backend->create_tensor(element::f32, rshape);
+    backend->call_with_validate(backend->compile(f0), {result0}, {a, i});
+    vector<float> expected{5, 6, 1, 2, 0, 0, 5, 6};
+    EXPECT_TRUE(test::all_close(expected, read_vector<float>(result0)));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, gather_2x3x2_axis_1_index_type_int64)
+{
+    Shape shape{2, 3, 2};
+    Shape ishape{4};
+    Shape rshape{2, 4, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto I = make_shared<op::Parameter>(element::i64, ishape);
+    auto gather = make_shared<op::Gather>(A, I, 1);
+    auto f0 = make_shared<Function>(NodeVector{gather}, ParameterVector{A, I});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto a = backend->create_tensor(element::f32, shape);
+    vector<float> data(shape_size(shape));
+    iota(data.begin(), data.end(), 0);
+    copy_data(a, data);
+    auto i = backend->create_tensor(element::i64, ishape);
+    copy_data(i, vector<int64_t>{1, 1, 2, 0});
+    auto result0 = backend->create_tensor(element::f32, rshape);
+    backend->call_with_validate(backend->compile(f0), {result0}, {a, i});
+    vector<float> expected{2, 3, 2, 3, 4, 5, 0, 1, 8, 9, 8, 9, 10, 11, 6, 7};
+    EXPECT_TRUE(test::all_close(expected, read_vector<float>(result0)));
+}
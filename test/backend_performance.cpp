@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <random>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -25,6 +26,8 @@
 #include "ngraph/file_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/concat.hpp"
+#include "ngraph/op/get_output_element.hpp"
+#include "ngraph/op/topk.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
@@ -139,3 +142,80 @@ TEST(benchmark, concat_32x1x200_axis1_6)
         }
     }
 }
+
+// Times TopK on CPU against INTERPRETER, which runs the reference kernel, and checks that both
+// select the same elements in the same order
+static void benchmark_topk(const Shape& shape, size_t axis, size_t k, bool compute_max)
+{
+    const size_t iterations = 3;
+    Shape rshape = shape;
+    rshape[axis] = k;
+
+    vector<float> data(shape_size(shape));
+    std::mt19937 engine(0);
+    std::uniform_real_distribution<float> distribution(-1000.0f, 1000.0f);
+    for (float& value : data)
+    {
+        value = distribution(engine);
+    }
+
+    vector<string> backend_names{"INTERPRETER", "CPU"};
+    vector<vector<int32_t>> indices;
+    vector<vector<float>> values;
+    for (const string& backend_name : backend_names)
+    {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::TopK>(A, axis, element::i32, k, compute_max);
+        auto f = make_shared<Function>(NodeVector{make_shared<op::GetOutputElement>(B, 0),
+                                                  make_shared<op::GetOutputElement>(B, 1)},
+                                       ParameterVector{A});
+
+        auto backend = runtime::Backend::create(backend_name);
+        auto a = backend->create_tensor(element::f32, shape);
+        copy_data(a, data);
+        auto result_indices = backend->create_tensor(element::i32, rshape);
+        auto result_values = backend->create_tensor(element::f32, rshape);
+        auto handle = backend->compile(f);
+
+        stopwatch sw;
+        sw.start();
+        for (size_t i = 0; i < iterations; i++)
+        {
+            backend->call_with_validate(handle, {result_indices, result_values}, {a});
+        }
+        sw.stop();
+        std::cout << backend_name << ": TopK of " << shape << " along axis " << axis
+                  << ", k = " << k << ": " << (sw.get_microseconds() / iterations) << " us/call"
+                  << std::endl;
+
+        indices.push_back(read_vector<int32_t>(result_indices));
+        values.push_back(read_vector<float>(result_values));
+    }
+
+    EXPECT_EQ(indices.at(0), indices.at(1));
+    EXPECT_EQ(values.at(0), values.at(1));
+}
+
+// Beam search: a small k over a vocabulary for every hypothesis
+TEST(benchmark, topk_beam_search_64x50000_k5)
+{
+    benchmark_topk(Shape{64, 50000}, 1, 5, true);
+}
+
+// Retrieval: a single slice long enough to be split across threads
+TEST(benchmark, topk_retrieval_1x1000000_k10)
+{
+    benchmark_topk(Shape{1, 1000000}, 1, 10, true);
+}
+
+// A strided axis with many slices
+TEST(benchmark, topk_strided_50000x16_k8_min)
+{
+    benchmark_topk(Shape{50000, 16}, 0, 8, false);
+}
+
+// Large k takes the sorting path rather than the heap
+TEST(benchmark, topk_large_k_16x4096_k1024)
+{
+    benchmark_topk(Shape{16, 4096}, 1, 1024, true);
+}
@@ -327,6 +327,87 @@ NGRAPH_TEST(${BACKEND_NAME}, reduce_3d_to_vector)
               read_vector<float>(result));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, reduce_matrix_rows_max_with_init)
+{
+    // The reduction function (f(x:int32[],y:int32[]) = max(x,y)).
+    auto f_A = make_shared<op::Parameter>(element::i32, Shape{});
+    auto f_B = make_shared<op::Parameter>(element::i32, Shape{});
+    auto f = make_shared<Function>(make_shared<op::Maximum>(f_A, f_B), ParameterVector{f_A, f_B});
+
+    Shape shape_a{3, 4};
+    auto A = make_shared<op::Parameter>(element::i32, shape_a);
+    auto B = make_shared<op::Parameter>(element::i32, Shape{});
+    Shape shape_rt{3};
+    auto g = make_shared<Function>(make_shared<op::Reduce>(A, B, f, AxisSet{1}),
+                                   ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto a = backend->create_tensor(element::i32, shape_a);
+    copy_data(a, vector<int32_t>{1, 9, 3, 4, -5, -6, -7, -8, 2, 6, 5, 1});
+    auto b = backend->create_tensor(element::i32, Shape{});
+    copy_data(b, vector<int32_t>{5});
+    auto result = backend->create_tensor(element::i32, shape_rt);
+
+    backend->call_with_validate(backend->compile(g), {result}, {a, b});
+    EXPECT_EQ((vector<int32_t>{9, 5, 6}), read_vector<int32_t>(result));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, reduce_to_scalar_widened_add)
+{
+    // The reduction function (f(x:int8[],y:int8[]) = convert<int8>(convert<int32>(x) +
+    // convert<int32>(y))).
+    auto f_A = make_shared<op::Parameter>(element::i8, Shape{});
+    auto f_B = make_shared<op::Parameter>(element::i8, Shape{});
+    auto sum = make_shared<op::Add>(make_shared<op::Convert>(f_A, element::i32),
+                                    make_shared<op::Convert>(f_B, element::i32));
+    auto f = make_shared<Function>(make_shared<op::Convert>(sum, element::i8),
+                                   ParameterVector{f_A, f_B});
+
+    Shape shape_a{2, 3};
+    auto A = make_shared<op::Parameter>(element::i8, shape_a);
+    auto B = make_shared<op::Parameter>(element::i8, Shape{});
+    auto g = make_shared<Function>(make_shared<op::Reduce>(A, B, f, AxisSet{0, 1}),
+                                   ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto a = backend->create_tensor(element::i8, shape_a);
+    copy_data(a, vector<int8_t>{1, 2, 3, 4, 5, 6});
+    auto b = backend->create_tensor(element::i8, Shape{});
+    copy_data(b, vector<int8_t>{10});
+    auto result = backend->create_tensor(element::i8, Shape{});
+
+    backend->call_with_validate(backend->compile(g), {result}, {a, b});
+    EXPECT_EQ((vector<int8_t>{31}), read_vector<int8_t>(result));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, reduce_window_sum_with_init)
+{
+    // The reduction function (f(x:float32[],y:float32[]) = x+y).
+    auto f_A = make_shared<op::Parameter>(element::f32, Shape{});
+    auto f_B = make_shared<op::Parameter>(element::f32, Shape{});
+    auto f = make_shared<Function>(make_shared<op::Add>(f_B, f_A), ParameterVector{f_A, f_B});
+
+    Shape shape_a{6};
+    auto A = make_shared<op::Parameter>(element::f32, shape_a);
+    auto B = make_shared<op::Parameter>(element::f32, Shape{});
+    Shape shape_rt{3};
+    auto g = make_shared<Function>(
+        make_shared<op::ReduceWindow>(A, B, f, Shape{2}, Strides{2}), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto a = backend->create_tensor(element::f32, shape_a);
+    copy_data(a, vector<float>{1, 2, 3, 4, 5, 6});
+    auto b = backend->create_tensor(element::f32, Shape{});
+    copy_data(b, vector<float>{100});
+    auto result = backend->create_tensor(element::f32, shape_rt);
+
+    backend->call_with_validate(backend->compile(g), {result}, {a, b});
+    EXPECT_EQ((vector<float>{103, 107, 111}), read_vector<float>(result));
+}
+
 //
 // The unit tests for ReduceWindow follow exactly what we test for MaxPool---but they use ReduceWindow to do it.
 //
@@ -19,6 +19,7 @@
 #include <cinttypes>
 #include <cmath>
 #include <cstdlib>
+#include <future>
 #include <random>
 #include <string>
 #include "gtest/gtest.h"
@@ -6513,3 +6514,83 @@ NGRAPH_TEST(${BACKEND_NAME}, shape_of_5d)
     vector<uint64_t> expected{2, 4, 8, 16, 32};
     EXPECT_EQ(expected, read_vector<uint64_t>(result));
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, call_async)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>((A + B) * A, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    backend->set_async_config(2, 4);
+    auto handle = backend->compile(f);
+
+    const size_t call_count = 16;
+    vector<shared_ptr<runtime::Tensor>> results;
+    vector<future<bool>> futures;
+    for (size_t i = 0; i < call_count; i++)
+    {
+        float x = static_cast<float>(i);
+        auto a = backend->create_tensor(element::f32, shape);
+        auto b = backend->create_tensor(element::f32, shape);
+        auto result = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>{x, x, x, x});
+        copy_data(b, vector<float>{1, 2, 3, 4});
+        results.push_back(result);
+        futures.push_back(backend->call_async(handle, {result}, {a, b}));
+    }
+    for (size_t i = 0; i < call_count; i++)
+    {
+        float x = static_cast<float>(i);
+        EXPECT_TRUE(futures[i].get());
+        EXPECT_EQ((vector<float>{(x + 1) * x, (x + 2) * x, (x + 3) * x, (x + 4) * x}),
+                  read_vector<float>(results[i]));
+    }
+
+    // Errors raised by the call are delivered through the future
+    auto g = make_shared<Function>(A + B, ParameterVector{A, B});
+    auto a = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    auto bad = backend->call_async(g, {result}, {a, a});
+    EXPECT_ANY_THROW(bad.get());
+
+    // The worker pool already exists
+    EXPECT_THROW(backend->set_async_config(1, 1), ngraph_error);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, call_async_remove_compiled_function)
+{
+    Shape shape{64, 64};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Dot>(A, A) + A, ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    backend->set_async_config(2, 16);
+    auto handle = backend->compile(f);
+
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>(shape_size(shape), 1.0f));
+    const size_t call_count = 16;
+    vector<shared_ptr<runtime::Tensor>> results;
+    vector<future<bool>> futures;
+    for (size_t i = 0; i < call_count; i++)
+    {
+        results.push_back(backend->create_tensor(element::f32, shape));
+        futures.push_back(backend->call_async(handle, {results.back()}, {a}));
+    }
+    backend->remove_compiled_function(handle);
+
+    // Calls that were already running finish on the removed function, later ones fail
+    for (size_t i = 0; i < call_count; i++)
+    {
+        try
+        {
+            EXPECT_TRUE(futures[i].get());
+            EXPECT_EQ(vector<float>(shape_size(shape), 65.0f), read_vector<float>(results[i]));
+        }
+        catch (const runtime_error&)
+        {
+        }
+    }
+}
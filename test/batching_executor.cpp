@@ -0,0 +1,177 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <chrono>
+#include <cmath>
+#include <future>
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/batching_executor.hpp"
+#include "ngraph/runtime/host_tensor.hpp"
+#include "ngraph/runtime/interpreter/int_backend.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(batching_executor, gather_and_scatter)
+{
+    Shape shape{1, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(NodeVector{A * B + A, A - B}, ParameterVector{A, B});
+
+    shared_ptr<runtime::Backend> backend = runtime::Backend::create("INTERPRETER");
+    runtime::BatchingExecutor executor(backend, f, 4, chrono::microseconds(10000));
+    EXPECT_EQ(executor.get_batched_function()->get_output_shape(0), (Shape{4, 3}));
+
+    const size_t request_count = 10;
+    vector<shared_ptr<runtime::Tensor>> sums;
+    vector<shared_ptr<runtime::Tensor>> differences;
+    vector<future<runtime::BatchingExecutor::RequestStats>> futures;
+    for (size_t i = 0; i < request_count; i++)
+    {
+        float x = static_cast<float>(i);
+        auto a = backend->create_tensor(element::f32, shape);
+        auto b = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>{x, x + 1, x + 2});
+        copy_data(b, vector<float>{2, 2, 2});
+        sums.push_back(backend->create_tensor(element::f32, shape));
+        differences.push_back(backend->create_tensor(element::f32, shape));
+        futures.push_back(executor.call({sums.back(), differences.back()}, {a, b}));
+    }
+
+    for (size_t i = 0; i < request_count; i++)
+    {
+        float x = static_cast<float>(i);
+        runtime::BatchingExecutor::RequestStats stats = futures[i].get();
+        EXPECT_GE(stats.batch_size, 1);
+        EXPECT_LE(stats.batch_size, 4);
+        EXPECT_EQ((vector<float>{3 * x, 3 * (x + 1), 3 * (x + 2)}), read_vector<float>(sums[i]));
+        EXPECT_EQ((vector<float>{x - 2, x - 1, x}), read_vector<float>(differences[i]));
+    }
+}
+
+TEST(batching_executor, requires_batch_axis)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto f = make_shared<Function>(-A, ParameterVector{A});
+
+    shared_ptr<runtime::Backend> backend = runtime::Backend::create("INTERPRETER");
+    EXPECT_THROW(runtime::BatchingExecutor(backend, f, 4, chrono::microseconds(100)),
+                 ngraph_error);
+}
+
+TEST(batching_executor, rejects_ops_mixing_samples)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{1, 3});
+    shared_ptr<runtime::Backend> backend = runtime::Backend::create("INTERPRETER");
+
+    auto across = make_shared<Function>(make_shared<op::Softmax>(A, AxisSet{0}),
+                                        ParameterVector{A});
+    EXPECT_THROW(runtime::BatchingExecutor(backend, across, 4, chrono::microseconds(100)),
+                 ngraph_error);
+
+    auto within = make_shared<Function>(make_shared<op::Softmax>(A, AxisSet{1}),
+                                        ParameterVector{A});
+    EXPECT_NO_THROW(runtime::BatchingExecutor(backend, within, 4, chrono::microseconds(100)));
+}
+
+TEST(batching_executor, padding_does_not_leak)
+{
+    Shape shape{1, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(A + A, ParameterVector{A});
+
+    shared_ptr<runtime::Backend> backend = runtime::Backend::create("INTERPRETER");
+    runtime::BatchingExecutor executor(backend, f, 2, chrono::microseconds(200000));
+
+    // A full batch whose second row holds NaNs
+    auto a0 = backend->create_tensor(element::f32, shape);
+    auto a1 = backend->create_tensor(element::f32, shape);
+    copy_data(a0, vector<float>{1, 2});
+    copy_data(a1, vector<float>{NAN, NAN});
+    auto r0 = backend->create_tensor(element::f32, shape);
+    auto r1 = backend->create_tensor(element::f32, shape);
+    auto f0 = executor.call({r0}, {a0});
+    auto f1 = executor.call({r1}, {a1});
+    EXPECT_EQ(f0.get().batch_size, 2);
+    f1.get();
+
+    // With NaN checking on, a stale NaN row in the padding of the next batch would throw
+    static_pointer_cast<runtime::interpreter::INTBackend>(backend)->set_nan_check(
+        executor.get_batched_function(), true);
+    auto a2 = backend->create_tensor(element::f32, shape);
+    copy_data(a2, vector<float>{3, 4});
+    auto r2 = backend->create_tensor(element::f32, shape);
+    runtime::BatchingExecutor::RequestStats stats = executor.call({r2}, {a2}).get();
+    EXPECT_EQ(stats.batch_size, 1);
+    EXPECT_EQ((vector<float>{6, 8}), read_vector<float>(r2));
+}
+
+namespace
+{
+    class UnreadableTensor : public runtime::HostTensor
+    {
+    public:
+        UnreadableTensor(const element::Type& element_type, const Shape& shape)
+            : runtime::HostTensor(element_type, shape)
+        {
+        }
+
+        void read(void* p, size_t tensor_offset, size_t n) const override
+        {
+            throw ngraph_error("unreadable tensor");
+        }
+    };
+}
+
+TEST(batching_executor, failed_batch_does_not_leak)
+{
+    Shape shape{1, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(A + B, ParameterVector{A, B});
+
+    shared_ptr<runtime::Backend> backend = runtime::Backend::create("INTERPRETER");
+    runtime::BatchingExecutor executor(backend, f, 2, chrono::microseconds(200000));
+    static_pointer_cast<runtime::interpreter::INTBackend>(backend)->set_nan_check(
+        executor.get_batched_function(), true);
+
+    // The second row of A is staged with NaNs before B of the first request fails to read
+    auto a0 = backend->create_tensor(element::f32, shape);
+    auto a1 = backend->create_tensor(element::f32, shape);
+    copy_data(a0, vector<float>{1, 2});
+    copy_data(a1, vector<float>{NAN, NAN});
+    auto b0 = make_shared<UnreadableTensor>(element::f32, shape);
+    auto b1 = backend->create_tensor(element::f32, shape);
+    copy_data(b1, vector<float>{1, 1});
+    auto f0 = executor.call({backend->create_tensor(element::f32, shape)}, {a0, b0});
+    auto f1 = executor.call({backend->create_tensor(element::f32, shape)}, {a1, b1});
+    EXPECT_THROW(f0.get(), ngraph_error);
+    EXPECT_THROW(f1.get(), ngraph_error);
+
+    auto a2 = backend->create_tensor(element::f32, shape);
+    copy_data(a2, vector<float>{3, 4});
+    auto r2 = backend->create_tensor(element::f32, shape);
+    runtime::BatchingExecutor::RequestStats stats = executor.call({r2}, {a2, b1}).get();
+    EXPECT_EQ(stats.batch_size, 1);
+    EXPECT_EQ((vector<float>{4, 5}), read_vector<float>(r2));
+}
@@ -16,8 +16,10 @@
 
 #include "gtest/gtest.h"
 
+#include "ngraph/autodiff/adjoints.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/op/embedding_lookup.hpp"
 #include "ngraph/serializer.hpp"
 #include "util/test_tools.hpp"
 
@@ -131,3 +133,39 @@ TEST(build_graph, function_undeclared_parameters)
         FAIL() << "Function construction failed for unexpected reason";
     }
 }
+
+TEST(build_graph, embedding_lookup_row_deltas)
+{
+    auto indices0 = make_shared<op::Parameter>(element::i32, Shape{4});
+    auto indices1 = make_shared<op::Parameter>(element::i32, Shape{4});
+    auto weights = make_shared<op::Parameter>(element::f32, Shape{1000, 16});
+    auto delta = make_shared<op::Parameter>(element::f32, Shape{4, 16});
+    auto sum = make_shared<op::EmbeddingLookup>(indices0, weights) +
+               make_shared<op::EmbeddingLookup>(indices1, weights);
+
+    // Both lookups contribute their rows, without a dense gradient of the weights
+    autodiff::Adjoints adjoints(NodeVector{sum}, NodeVector{delta});
+    auto& row_deltas = adjoints.get_row_deltas(weights);
+    ASSERT_EQ(row_deltas.size(), 2);
+    set<shared_ptr<Node>> row_indices;
+    for (auto& row_delta : row_deltas)
+    {
+        row_indices.insert(row_delta.indices);
+        EXPECT_EQ(row_delta.delta, delta);
+    }
+    EXPECT_EQ(row_indices, (set<shared_ptr<Node>>{indices0, indices1}));
+
+    // The dense adjoint scatters the same rows into zeros
+    auto outer = dynamic_pointer_cast<op::ScatterAdd>(adjoints.backprop_node(weights));
+    ASSERT_TRUE(outer);
+    auto inner = dynamic_pointer_cast<op::ScatterAdd>(outer->get_argument(0));
+    ASSERT_TRUE(inner);
+    auto zero = dynamic_pointer_cast<op::Broadcast>(inner->get_argument(0));
+    ASSERT_TRUE(zero);
+    EXPECT_TRUE(is_zero(zero->get_argument(0)));
+
+    // A dense contribution makes the row deltas incomplete
+    adjoints.add_delta(weights, make_shared<op::Parameter>(element::f32, Shape{1000, 16}));
+    EXPECT_TRUE(adjoints.get_row_deltas(weights).empty());
+    EXPECT_TRUE(adjoints.get_row_deltas(indices0).empty());
+}
@@ -285,3 +285,96 @@ TEST(constant_folding, const_quantize)
     vector<output_c_type> values_quantize{2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5};
     ASSERT_EQ(values_quantize, values_out);
 }
+
+TEST(constant_folding, constant_shape_arithmetic)
+{
+    auto a = op::Constant::create(element::i64, Shape{2}, {2, 3});
+    auto b = op::Constant::create(element::i64, Shape{2}, {4, 5});
+    auto concat = make_shared<op::Concat>(NodeVector{a, b}, 0);
+    auto slice = make_shared<op::Slice>(concat, Coordinate{1}, Coordinate{4});
+    auto product = make_shared<op::Product>(slice, AxisSet{0});
+    auto convert = make_shared<op::Convert>(product, element::f32);
+    auto f = make_shared<Function>(convert, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Concat>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Slice>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Product>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Convert>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 1);
+
+    auto new_const =
+        std::dynamic_pointer_cast<op::Constant>(f->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(new_const);
+    ASSERT_EQ(new_const->get_element_type(), element::f32);
+    ASSERT_EQ(new_const->get_vector<float>(), vector<float>{60});
+}
+
+TEST(constant_folding, constant_dot_select)
+{
+    // Large enough for the dot to be folded on several threads
+    Shape shape_a{256, 64};
+    Shape shape_b{64, 32};
+    vector<float> values_a(shape_size(shape_a));
+    for (size_t i = 0; i < values_a.size(); i++)
+    {
+        values_a[i] = static_cast<float>(i % 7);
+    }
+    auto a = make_shared<op::Constant>(element::f32, shape_a, values_a);
+    auto b = make_shared<op::Constant>(
+        element::f32, shape_b, vector<float>(shape_size(shape_b), 1.0f));
+    auto dot = make_shared<op::Dot>(a, b);
+    auto zero = make_shared<op::Constant>(
+        element::f32, Shape{256, 32}, vector<float>(256 * 32, 0.0f));
+    auto select = make_shared<op::Select>(make_shared<op::Greater>(dot, zero), dot, zero);
+    auto f = make_shared<Function>(make_shared<op::Reverse>(select, AxisSet{0}),
+                                   ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Dot>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Select>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Reverse>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 1);
+
+    auto new_const =
+        std::dynamic_pointer_cast<op::Constant>(f->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(new_const);
+    auto values_out = new_const->get_vector<float>();
+    for (size_t row = 0; row < 256; row++)
+    {
+        float expected = 0;
+        for (size_t k = 0; k < 64; k++)
+        {
+            expected += values_a[(255 - row) * 64 + k];
+        }
+        for (size_t col = 0; col < 32; col++)
+        {
+            ASSERT_EQ(values_out[row * 32 + col], expected);
+        }
+    }
+}
+
+TEST(constant_folding, constant_size_limit)
+{
+    auto constant = op::Constant::create(element::f32, Shape{4}, {1, 2, 3, 4});
+    auto sqrt = make_shared<op::Sqrt>(constant);
+    auto broadcast = make_shared<op::Broadcast>(sqrt, Shape{1024, 4}, AxisSet{0});
+    auto f = make_shared<Function>(broadcast, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>(
+        vector<pass::ConstantFolding::CFTransformations>{
+            pass::ConstantFolding::CFTransformations::EVALUATE},
+        1024);
+    pass_manager.run_passes(f);
+
+    // The broadcast would grow the constant past the limit; its argument is still folded
+    ASSERT_EQ(count_ops_of_type<op::Broadcast>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::Sqrt>(f), 0);
+}
@@ -305,6 +305,58 @@ TEST(DISABLED_coordinate, dilation)
     EXPECT_TRUE(it == ct.end());
 }
 
+TEST(coordinate, index_iterator)
+{
+    Shape source_shape{3, 4, 5};
+    CoordinateTransform ct(source_shape,
+                           Coordinate{0, 1, 0},
+                           Coordinate{4, 12, 11},
+                           Strides{2, 1, 3},
+                           AxisVector{2, 0, 1},
+                           CoordinateDiff{1, 2, 0},
+                           CoordinateDiff{0, 1, 2},
+                           Strides{1, 3, 2});
+
+    CoordinateTransform::IndexIterator index_it(ct);
+    size_t source_points = 0;
+    for (const Coordinate& c : ct)
+    {
+        ASSERT_EQ(index_it.has_source(), ct.has_source_coordinate(c));
+        if (index_it.has_source())
+        {
+            EXPECT_EQ(*index_it, ct.index(c));
+            source_points++;
+        }
+        ++index_it;
+    }
+    EXPECT_GT(source_points, 0);
+    EXPECT_LT(source_points, shape_size(ct.get_target_shape()));
+}
+
+TEST(coordinate, index_iterator_strides)
+{
+    // Walk a 2x3 tensor with its second axis reversed
+    CoordinateTransform::IndexIterator it(Shape{2, 3}, {3, -1}, 2);
+    vector<size_t> indices;
+    for (size_t i = 0; i < 6; i++, ++it)
+    {
+        EXPECT_TRUE(it.has_source());
+        indices.push_back(*it);
+    }
+    EXPECT_EQ(indices, (vector<size_t>{2, 1, 0, 5, 4, 3}));
+}
+
+TEST(coordinate, index_iterator_deleted_axes)
+{
+    CoordinateTransform::IndexIterator it(Shape{2, 3, 2}, AxisSet{1});
+    vector<size_t> indices;
+    for (size_t i = 0; i < 12; i++, ++it)
+    {
+        indices.push_back(*it);
+    }
+    EXPECT_EQ(indices, (vector<size_t>{0, 1, 0, 1, 0, 1, 2, 3, 2, 3, 2, 3}));
+}
+
 TEST(benchmark, coordinate)
 {
     Shape source_shape{128, 3, 2000, 1000};
@@ -105,3 +105,29 @@ TEST(cpio, write)
         }
     }
 }
+
+TEST(cpio, write_aligned)
+{
+    const string test_file = "test2.cpio";
+    string s1 = "odd";
+    string s2 = "aligned data";
+    {
+        cpio::Writer writer(test_file);
+        writer.write("file1.txt", s1.data(), static_cast<uint32_t>(s1.size()));
+        writer.write("file2.txt", s2.data(), static_cast<uint32_t>(s2.size()), 64);
+    }
+    {
+        cpio::Reader reader(test_file);
+        // The padding record is not reported
+        ASSERT_EQ(2, reader.get_file_info().size());
+        const cpio::FileInfo* info = reader.find("file2.txt");
+        ASSERT_NE(info, nullptr);
+        EXPECT_EQ(info->get_offset() % 64, 0);
+        EXPECT_EQ(reader.find("missing.txt"), nullptr);
+
+        string content(info->get_size(), 0);
+        reader.read(info->get_name(), &content[0], content.size());
+        EXPECT_EQ(content, s2);
+    }
+    file_util::remove_file(test_file);
+}
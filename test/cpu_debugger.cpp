@@ -348,3 +348,37 @@ TEST(tracer, conditional_tracepoint)
         dbg.call({result}, {a, b});
     }
 }
+
+TEST(tracer, refused_while_other_calls_run)
+{
+    Shape shape{};
+    auto A = make_shared<op::Parameter>(element::i32, shape);
+    auto B = make_shared<op::Parameter>(element::i32, shape);
+
+    auto add = make_shared<op::Add>(A, B);
+
+    auto f = make_shared<Function>(add, ParameterVector{A, B});
+
+    shared_ptr<runtime::Backend> backend = runtime::Backend::create("CPU");
+
+    // Room for the debugger's context and one for a concurrent call
+    setenv("NGRAPH_CPU_CONCURRENCY", "2", 1);
+    auto cf =
+        std::dynamic_pointer_cast<ngraph::runtime::cpu::CPU_Backend>(backend)->get_call_frame(f);
+    unsetenv("NGRAPH_CPU_CONCURRENCY");
+
+    ngraph::runtime::cpu::CPU_Debugger dbg(*cf);
+    auto tracer = [](void** values, const std::string& name) {};
+
+    // A context taken from the pool stands for a call in progress. It runs the same
+    // functors, so the tracepoint cannot be swapped in or out under it.
+    auto busy = cf->acquire_runtime_context();
+    EXPECT_FALSE(dbg.add_tracepoint(add, tracer));
+    cf->release_runtime_context(busy);
+    EXPECT_TRUE(dbg.add_tracepoint(add, tracer));
+
+    busy = cf->acquire_runtime_context();
+    EXPECT_FALSE(dbg.delete_tracepoint(add));
+    cf->release_runtime_context(busy);
+    EXPECT_TRUE(dbg.delete_tracepoint(add));
+}
@@ -28,12 +28,14 @@
 #include "ngraph/ngraph.hpp"
 #include "ngraph/op/batch_norm.hpp"
 #include "ngraph/op/concat.hpp"
+#include "ngraph/op/experimental/quantized_dot.hpp"
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/max_pool.hpp"
 #include "ngraph/op/negative.hpp"
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/relu.hpp"
 #include "ngraph/op/sigmoid.hpp"
+#include "ngraph/op/softmax.hpp"
 #include "ngraph/op/sum.hpp"
 #include "ngraph/op/tanh.hpp"
 #include "ngraph/pass/algebraic_simplification.hpp"
@@ -47,6 +49,7 @@
 #include "ngraph/pattern/op/skip.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
+#include "ngraph/runtime/cpu/op/attention.hpp"
 #include "ngraph/runtime/cpu/op/batch_dot.hpp"
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
 #include "ngraph/runtime/cpu/op/bounded_relu.hpp"
@@ -54,8 +57,10 @@
 #include "ngraph/runtime/cpu/op/conv_bias.hpp"
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
+#include "ngraph/runtime/cpu/op/gelu.hpp"
 #include "ngraph/runtime/cpu/op/group_conv.hpp"
 #include "ngraph/runtime/cpu/op/group_conv_bias.hpp"
+#include "ngraph/runtime/cpu/op/layer_norm.hpp"
 #include "ngraph/runtime/cpu/op/leaky_relu.hpp"
 #include "ngraph/runtime/cpu/op/loop_kernel.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
@@ -1499,6 +1504,182 @@ TEST(cpu_fusion, backwards_maxpool_with_indices_n4_c1_hw4_2x2_max)
     ASSERT_TRUE(read_vector<float>(output) == expected);
 }
 
+static void check_fused_against_interpreter(const std::shared_ptr<Function>& int_f,
+                                            const std::shared_ptr<Function>& cpu_f)
+{
+    test::Uniform<float> rng(-2.0f, 2.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0), 1.0e-4f, 1.0e-4f));
+}
+
+TEST(cpu_fusion, fuse_layer_norm)
+{
+    auto make_function = [](float epsilon) {
+        Shape shape{2, 3, 4};
+        Shape reduced_shape{2, 3};
+        AxisSet last_axis{2};
+        auto input = std::make_shared<op::Parameter>(element::f32, shape);
+        auto gamma = std::make_shared<op::Parameter>(element::f32, Shape{4});
+        auto beta = std::make_shared<op::Parameter>(element::f32, Shape{4});
+        auto count = op::Constant::create(element::f32, reduced_shape, {4});
+
+        auto mean = std::make_shared<op::Sum>(input, last_axis) / count;
+        auto centered = input - std::make_shared<op::Broadcast>(mean, shape, last_axis);
+        auto variance = std::make_shared<op::Sum>(centered * centered, last_axis) / count;
+        auto eps = op::Constant::create(element::f32, reduced_shape, {epsilon});
+        auto stddev = std::make_shared<op::Sqrt>(variance + eps);
+        auto normalized = centered / std::make_shared<op::Broadcast>(stddev, shape, last_axis);
+        auto out = normalized * std::make_shared<op::Broadcast>(gamma, shape, AxisSet{0, 1}) +
+                   std::make_shared<op::Broadcast>(beta, shape, AxisSet{0, 1});
+        return make_shared<Function>(NodeVector{out}, ParameterVector{input, gamma, beta});
+    };
+
+    auto f = make_function(1e-5f);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(1, count_ops_of_type<op::LayerNorm>(f));
+    EXPECT_EQ(0, count_ops_of_type<op::Sum>(f));
+
+    auto cpu_f = make_function(1e-5f);
+    check_fused_against_interpreter(make_function(1e-5f), cpu_f);
+    EXPECT_EQ(1, count_ops_of_type<op::LayerNorm>(cpu_f));
+}
+
+TEST(cpu_fusion, fuse_gelu)
+{
+    auto make_function = [](float cubic_coefficient) {
+        Shape shape{3, 5};
+        auto input = std::make_shared<op::Parameter>(element::f32, shape);
+        auto constant = [&shape](float value) {
+            return op::Constant::create(element::f32, shape, {value});
+        };
+        auto inner = input + constant(cubic_coefficient) * (input * (input * input));
+        auto tanh = std::make_shared<op::Tanh>(constant(0.7978845608f) * inner);
+        auto out = (constant(0.5f) * input) * (constant(1.0f) + tanh);
+        return make_shared<Function>(NodeVector{out}, ParameterVector{input});
+    };
+
+    auto no_fuse = make_function(0.1f);
+    auto f = make_function(0.044715f);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
+    pass_manager.run_passes(no_fuse);
+    pass_manager.run_passes(f);
+    EXPECT_EQ(0, count_ops_of_type<op::Gelu>(no_fuse));
+    ASSERT_EQ(1, count_ops_of_type<op::Gelu>(f));
+    EXPECT_EQ(0, count_ops_of_type<op::Tanh>(f));
+
+    auto cpu_f = make_function(0.044715f);
+    check_fused_against_interpreter(make_function(0.044715f), cpu_f);
+    EXPECT_EQ(1, count_ops_of_type<op::Gelu>(cpu_f));
+}
+
+TEST(cpu_fusion, fuse_attention)
+{
+    auto make_function = []() {
+        auto query = std::make_shared<op::Parameter>(element::f32, Shape{3, 8});
+        auto key = std::make_shared<op::Parameter>(element::f32, Shape{5, 8});
+        auto value = std::make_shared<op::Parameter>(element::f32, Shape{5, 4});
+        auto key_t = std::make_shared<op::Reshape>(key, AxisVector{1, 0}, Shape{8, 5});
+        auto scores = std::make_shared<op::Dot>(query, key_t);
+        auto scale = op::Constant::create(element::f32, Shape{3, 5}, {0.35355339f});
+        auto weights = std::make_shared<op::Softmax>(scores * scale, AxisSet{1});
+        auto out = std::make_shared<op::Dot>(weights, value);
+        return make_shared<Function>(NodeVector{out}, ParameterVector{query, key, value});
+    };
+
+    auto f = make_function();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(1, count_ops_of_type<op::ScaledDotProductAttention>(f));
+    EXPECT_EQ(0, count_ops_of_type<op::Softmax>(f));
+    EXPECT_EQ(0, count_ops_of_type<op::MatmulBias>(f));
+
+    auto cpu_f = make_function();
+    check_fused_against_interpreter(make_function(), cpu_f);
+    EXPECT_EQ(1, count_ops_of_type<op::ScaledDotProductAttention>(cpu_f));
+}
+
+TEST(cpu_fusion, fuse_batch_attention)
+{
+    auto query = std::make_shared<op::Parameter>(element::f32, Shape{2, 3, 8});
+    auto key = std::make_shared<op::Parameter>(element::f32, Shape{2, 5, 8});
+    auto value = std::make_shared<op::Parameter>(element::f32, Shape{2, 5, 4});
+    auto scores = std::make_shared<op::BatchDot>(query, key, false, true);
+    auto scale = op::Constant::create(element::f32, Shape{2, 3, 5}, {8.0f});
+    auto weights = std::make_shared<op::Softmax>(scores / scale, AxisSet{2});
+    auto out = std::make_shared<op::BatchDot>(weights, value, false, false);
+    auto f = make_shared<Function>(NodeVector{out}, ParameterVector{query, key, value});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(1, count_ops_of_type<op::ScaledDotProductAttention>(f));
+    auto attention = std::static_pointer_cast<op::ScaledDotProductAttention>(
+        f->get_results().at(0)->get_argument(0));
+    EXPECT_DOUBLE_EQ(0.125, attention->get_scale());
+}
+
+TEST(cpu_fusion, layer_norm_gelu_attention_backprop)
+{
+    auto backend = runtime::Backend::create("CPU");
+    test::Uniform<float> rng(-1.0f, 1.0f);
+
+    auto make_layer_norm = []() {
+        auto input = std::make_shared<op::Parameter>(element::f32, Shape{3, 4});
+        auto gamma = std::make_shared<op::Parameter>(element::f32, Shape{4});
+        auto beta = std::make_shared<op::Parameter>(element::f32, Shape{4});
+        auto ln = std::make_shared<op::LayerNorm>(input, gamma, beta, 1e-3);
+        return make_shared<Function>(ln, ParameterVector{input, gamma, beta});
+    };
+    EXPECT_TRUE(autodiff_numeric_compare<float>(
+        backend.get(),
+        make_layer_norm,
+        {rng.initialize(backend->create_tensor(element::f32, Shape{3, 4})),
+         rng.initialize(backend->create_tensor(element::f32, Shape{4})),
+         rng.initialize(backend->create_tensor(element::f32, Shape{4}))},
+        .01f,
+        .01f));
+
+    auto make_gelu = []() {
+        auto input = std::make_shared<op::Parameter>(element::f32, Shape{2, 5});
+        return make_shared<Function>(std::make_shared<op::Gelu>(input), ParameterVector{input});
+    };
+    EXPECT_TRUE(autodiff_numeric_compare<float>(
+        backend.get(),
+        make_gelu,
+        {rng.initialize(backend->create_tensor(element::f32, Shape{2, 5}))},
+        .01f,
+        .01f));
+
+    auto make_attention = []() {
+        auto query = std::make_shared<op::Parameter>(element::f32, Shape{2, 3});
+        auto key = std::make_shared<op::Parameter>(element::f32, Shape{4, 3});
+        auto value = std::make_shared<op::Parameter>(element::f32, Shape{4, 2});
+        auto attention =
+            std::make_shared<op::ScaledDotProductAttention>(query, key, value, 0.5);
+        return make_shared<Function>(attention, ParameterVector{query, key, value});
+    };
+    EXPECT_TRUE(autodiff_numeric_compare<float>(
+        backend.get(),
+        make_attention,
+        {rng.initialize(backend->create_tensor(element::f32, Shape{2, 3})),
+         rng.initialize(backend->create_tensor(element::f32, Shape{4, 3})),
+         rng.initialize(backend->create_tensor(element::f32, Shape{4, 2}))},
+        .01f,
+        .01f));
+}
+
 #if defined(NGRAPH_HALIDE)
 
 TEST(cpu_fusion, loop_kernel_one_input_one_output_halide)
@@ -2560,6 +2741,264 @@ TEST(cpu_fusion, loop_kernel_fusion_one_group)
 
 #endif
 
+TEST(cpu_fusion, loop_kernel_native_int_broadcast)
+{
+    Shape shape{3, 700};
+    auto A = make_shared<op::Parameter>(element::i32, shape);
+    auto B = make_shared<op::Parameter>(element::i32, shape);
+    auto C = op::Constant::create(element::i32, Shape{}, {3});
+    auto broadcast_c = make_shared<op::Broadcast>(C, shape, AxisSet{0, 1});
+    auto sub_ab = make_shared<op::Subtract>(A, B);
+    auto mul = make_shared<op::Multiply>(sub_ab, broadcast_c);
+    auto relu = make_shared<op::Relu>(mul);
+    auto neg = make_shared<op::Negative>(sub_ab);
+    auto lk =
+        make_shared<runtime::cpu::op::LoopKernel>(NodeVector{broadcast_c, sub_ab, mul, relu, neg},
+                                                  NodeVector{relu, neg},
+                                                  NodeVector{A, B, C});
+    auto goe0 = make_shared<op::GetOutputElement>(lk, 0);
+    auto goe1 = make_shared<op::GetOutputElement>(lk, 1);
+    auto f = make_shared<Function>(NodeVector{goe0, goe1}, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto a = backend->create_tensor(element::i32, shape);
+    auto b = backend->create_tensor(element::i32, shape);
+    auto result0 = backend->create_tensor(element::i32, shape);
+    auto result1 = backend->create_tensor(element::i32, shape);
+
+    vector<int> data_a(shape_size(shape));
+    vector<int> data_b(shape_size(shape));
+    vector<int> expected0;
+    vector<int> expected1;
+    for (size_t i = 0; i < data_a.size(); i++)
+    {
+        data_a[i] = static_cast<int>(i % 13);
+        data_b[i] = static_cast<int>(i % 7);
+        expected0.push_back(max(0, (data_a[i] - data_b[i]) * 3));
+        expected1.push_back(data_b[i] - data_a[i]);
+    }
+    copy_data(a, data_a);
+    copy_data(b, data_b);
+
+    backend->call_with_validate(backend->compile(f), {result0, result1}, {a, b});
+    EXPECT_EQ(read_vector<int>(result0), expected0);
+    EXPECT_EQ(read_vector<int>(result1), expected1);
+}
+
+TEST(cpu_fusion, loop_kernel_fusion_native)
+{
+    auto make_function = []() -> std::shared_ptr<Function> {
+        Shape shape{16, 33};
+        auto a = make_shared<op::Parameter>(element::f64, shape);
+        auto b = make_shared<op::Parameter>(element::f64, shape);
+        auto c = make_shared<op::Parameter>(element::f64, Shape{});
+        auto add_ab = a + b;
+        auto abs_add = make_shared<op::Abs>(add_ab);
+        auto div_c = abs_add / make_shared<op::Broadcast>(c, shape, AxisSet{0, 1});
+        auto b_t = make_shared<op::Reshape>(b, AxisVector{1, 0}, Shape{33, 16});
+        auto dot = make_shared<op::Dot>(div_c, b_t);
+        auto neg = make_shared<op::Negative>(div_c);
+        auto max_ab = make_shared<op::Maximum>(neg, a);
+        return make_shared<Function>(NodeVector{max_ab, dot}, ParameterVector{a, b, c});
+    };
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPULoopKernelFusion>(2);
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+    pass_manager.run_passes(cpu_f);
+    ASSERT_GT(count_ops_of_type<runtime::cpu::op::LoopKernel>(cpu_f), 0);
+
+    test::Uniform<double> rng(1.0, 10.0);
+    vector<vector<double>> args;
+    for (shared_ptr<op::Parameter> param : cpu_f->get_parameters())
+    {
+        vector<double> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i)));
+    }
+}
+
+TEST(cpu_fusion, loop_kernel_fusion_row_broadcast)
+{
+    auto make_function = []() -> std::shared_ptr<Function> {
+        // Rows of 700 don't line up with the loop kernel's blocks
+        Shape shape{6, 700};
+        auto x = make_shared<op::Parameter>(element::f32, shape);
+        auto bias = make_shared<op::Parameter>(element::f32, Shape{700});
+        auto scale = make_shared<op::Parameter>(element::f32, Shape{6});
+        auto shift = make_shared<op::Parameter>(element::f32, Shape{2, 4});
+        auto biased = x + make_shared<op::Broadcast>(bias, shape, AxisSet{0});
+        auto scaled = biased * make_shared<op::Broadcast>(scale, shape, AxisSet{1});
+        auto relu = make_shared<op::Relu>(scaled);
+        // Broadcasting along an inner axis is left out of the loop
+        auto inner = make_shared<op::Negative>(make_shared<op::Abs>(
+            make_shared<op::Broadcast>(shift, Shape{2, 3, 4}, AxisSet{1})));
+        return make_shared<Function>(NodeVector{relu, inner},
+                                     ParameterVector{x, bias, scale, shift});
+    };
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPULoopKernelFusion>(2);
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+    pass_manager.run_passes(cpu_f);
+    EXPECT_EQ(count_ops_of_type<runtime::cpu::op::LoopKernel>(cpu_f), 2);
+    EXPECT_EQ(count_ops_of_type<op::Broadcast>(cpu_f), 1);
+
+    test::Uniform<float> rng(-10.0f, 10.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : cpu_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i)));
+    }
+}
+
+TEST(cpu_fusion, loop_kernel_fusion_residual)
+{
+    auto make_function = []() -> std::shared_ptr<Function> {
+        Shape shape{8, 8};
+        auto x = make_shared<op::Parameter>(element::f32, shape);
+        auto w = make_shared<op::Parameter>(element::f32, shape);
+        auto a = make_shared<op::Negative>(make_shared<op::Abs>(x));
+        auto dot = make_shared<op::Dot>(a, w);
+        // z depends on a both directly and through dot, so it can't join a's group
+        auto z = a + dot;
+        auto relu = make_shared<op::Relu>(z);
+        return make_shared<Function>(NodeVector{relu}, ParameterVector{x, w});
+    };
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPULoopKernelFusion>(2);
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+    pass_manager.run_passes(cpu_f);
+    EXPECT_EQ(count_ops_of_type<runtime::cpu::op::LoopKernel>(cpu_f), 2);
+    EXPECT_EQ(count_ops_of_type<op::Dot>(cpu_f), 1);
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : cpu_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0)));
+}
+
+TEST(cpu_fusion, loop_kernel_fusion_crossed_groups)
+{
+    // Each group feeds the other through a Dot, so fusing both a2 and b2 into the groups of
+    // a1 and b1 would make the two loop kernels depend on each other
+    Shape shape{4, 4};
+    auto p = make_shared<op::Parameter>(element::f32, shape);
+    auto q = make_shared<op::Parameter>(element::f32, shape);
+    auto a1 = make_shared<op::Negative>(make_shared<op::Abs>(p));
+    auto b1 = make_shared<op::Negative>(make_shared<op::Abs>(q));
+    auto dot_a = make_shared<op::Dot>(a1, q);
+    auto dot_b = make_shared<op::Dot>(b1, p);
+    auto b2 = b1 + dot_a;
+    auto a2 = a1 + dot_b;
+    auto f = make_shared<Function>(NodeVector{a2, b2}, ParameterVector{p, q});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPULoopKernelFusion>(2);
+    pass_manager.run_passes(f);
+    // Would throw on a cyclic graph
+    EXPECT_EQ(f->get_ordered_ops().size(), f->get_ops().size());
+    EXPECT_EQ(count_ops_of_type<runtime::cpu::op::LoopKernel>(f), 2);
+    EXPECT_EQ(count_ops_of_type<op::Add>(f), 1);
+}
+
+TEST(cpu_fusion, loop_kernel_fusion_enabled_in_backend)
+{
+    auto make_function = [](const element::Type& type) -> std::shared_ptr<Function> {
+        Shape shape{5, 300};
+        auto a = make_shared<op::Parameter>(type, shape);
+        auto b = make_shared<op::Parameter>(type, shape);
+        auto c = make_shared<op::Parameter>(type, Shape{});
+        auto k = op::Constant::create(type, Shape{}, {2});
+        auto scaled = a * make_shared<op::Broadcast>(c, shape, AxisSet{0, 1}) - b;
+        auto divisor =
+            make_shared<op::Abs>(b) + make_shared<op::Broadcast>(k, shape, AxisSet{0, 1});
+        auto relu = make_shared<op::Relu>(scaled / divisor);
+        auto max = make_shared<op::Maximum>(relu, make_shared<op::Negative>(a));
+        return make_shared<Function>(NodeVector{max}, ParameterVector{a, b, c});
+    };
+
+    // The pass is off by default, turn it on for the backend's pass manager
+    const char* pass_enables = getenv("NGRAPH_PASS_ENABLES");
+    string saved_pass_enables = pass_enables ? pass_enables : "";
+    setenv("NGRAPH_PASS_ENABLES", "CPULoopKernelFusion:1", 1);
+
+    {
+        auto cpu_f = make_function(element::f32);
+        auto int_f = make_function(element::f32);
+        test::Uniform<float> rng(-10.0f, 10.0f);
+        vector<vector<float>> args;
+        for (shared_ptr<op::Parameter> param : cpu_f->get_parameters())
+        {
+            vector<float> tensor_val(shape_size(param->get_shape()));
+            rng.initialize(tensor_val);
+            args.push_back(tensor_val);
+        }
+        auto int_results = execute(int_f, args, "INTERPRETER");
+        auto cpu_results = execute(cpu_f, args, "CPU");
+        EXPECT_GT(count_ops_of_type<runtime::cpu::op::LoopKernel>(cpu_f), 0);
+        EXPECT_EQ(count_ops_of_type<op::Multiply>(cpu_f), 0);
+        EXPECT_EQ(count_ops_of_type<op::Divide>(cpu_f), 0);
+        EXPECT_EQ(count_ops_of_type<op::Broadcast>(cpu_f), 0);
+        EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0)));
+    }
+
+    {
+        // Integer division stays out of the fused loop so that it can check for zero
+        auto cpu_f = make_function(element::i32);
+        auto int_f = make_function(element::i32);
+        vector<vector<int>> args;
+        for (shared_ptr<op::Parameter> param : cpu_f->get_parameters())
+        {
+            vector<int> tensor_val(shape_size(param->get_shape()));
+            for (size_t i = 0; i < tensor_val.size(); i++)
+            {
+                tensor_val[i] = static_cast<int>((i * 7 + args.size() * 3) % 23) - 11;
+            }
+            args.push_back(tensor_val);
+        }
+        auto int_results = execute(int_f, args, "INTERPRETER");
+        auto cpu_results = execute(cpu_f, args, "CPU");
+        EXPECT_GT(count_ops_of_type<runtime::cpu::op::LoopKernel>(cpu_f), 0);
+        EXPECT_EQ(count_ops_of_type<op::Divide>(cpu_f), 1);
+        EXPECT_EQ(cpu_results.at(0), int_results.at(0));
+    }
+
+    if (pass_enables)
+    {
+        setenv("NGRAPH_PASS_ENABLES", saved_pass_enables.c_str(), 1);
+    }
+    else
+    {
+        unsetenv("NGRAPH_PASS_ENABLES");
+    }
+}
+
 TEST(cpu_fusion, sigmoid_multiply_fusion)
 {
     pass::Manager pass_manager;
@@ -3425,3 +3864,74 @@ TEST(cpu_fusion, rnn_input_fusion_inter_vs_cpu)
         EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
     }
 }
+
+TEST(cpu_fusion, fuse_quantized_dot)
+{
+    auto make_function = [](bool requantize) {
+        auto data = std::make_shared<op::Parameter>(element::u8, Shape{3, 4});
+        auto weights = std::make_shared<op::Parameter>(element::i8, Shape{4, 2});
+        auto dq_data = std::make_shared<op::Dequantize>(
+            data,
+            op::Constant::create(element::f32, Shape{}, {0.5f}),
+            op::Constant::create(element::u8, Shape{}, {0}),
+            element::f32,
+            AxisSet{});
+        auto dq_weights = std::make_shared<op::Dequantize>(
+            weights,
+            op::Constant::create(element::f32, Shape{}, {0.25f}),
+            op::Constant::create(element::i8, Shape{}, {0}),
+            element::f32,
+            AxisSet{});
+        std::shared_ptr<Node> out = std::make_shared<op::Dot>(dq_data, dq_weights);
+        if (requantize)
+        {
+            out = std::make_shared<op::Quantize>(
+                out,
+                op::Constant::create(element::f32, Shape{}, {2.0f}),
+                op::Constant::create(element::i8, Shape{}, {0}),
+                element::i8,
+                AxisSet{},
+                op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN);
+        }
+        return make_shared<Function>(NodeVector{out}, ParameterVector{data, weights});
+    };
+
+    for (bool requantize : {false, true})
+    {
+        auto fused = make_function(requantize);
+        pass::Manager pass_manager;
+        pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
+        pass_manager.run_passes(fused);
+        EXPECT_EQ(1, count_ops_of_type<op::QuantizedDot>(fused));
+        EXPECT_EQ(0, count_ops_of_type<op::Dot>(fused));
+        EXPECT_EQ(0, count_ops_of_type<op::Quantize>(fused));
+
+        auto int_f = make_function(requantize);
+        auto cpu_f = make_function(requantize);
+        vector<uint8_t> data_val{0, 1, 2, 3, 40, 50, 60, 70, 200, 210, 255, 7};
+        vector<int8_t> weights_val{-128, 127, 3, -4, 5, 6, -70, 8};
+
+        auto int_backend = runtime::Backend::create("INTERPRETER");
+        auto cpu_backend = runtime::Backend::create("CPU");
+        auto out_type = int_f->get_output_element_type(0);
+        auto run = [&](runtime::Backend* backend, const shared_ptr<Function>& f) {
+            auto data = backend->create_tensor(element::u8, Shape{3, 4});
+            auto weights = backend->create_tensor(element::i8, Shape{4, 2});
+            copy_data(data, data_val);
+            copy_data(weights, weights_val);
+            auto result = backend->create_tensor(out_type, Shape{3, 2});
+            backend->call_with_validate(backend->compile(f), {result}, {data, weights});
+            return result;
+        };
+        auto int_result = run(int_backend.get(), int_f);
+        auto cpu_result = run(cpu_backend.get(), cpu_f);
+        if (requantize)
+        {
+            EXPECT_EQ(read_vector<int8_t>(int_result), read_vector<int8_t>(cpu_result));
+        }
+        else
+        {
+            EXPECT_EQ(read_vector<float>(int_result), read_vector<float>(cpu_result));
+        }
+    }
+}
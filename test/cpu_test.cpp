@@ -15,13 +15,23 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <chrono>
+#include <condition_variable>
 #include <cstdio>
+#include <fstream>
 #include <iostream>
 #include <list>
 #include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
 
 #include "gtest/gtest.h"
 #include "ngraph/autodiff/adjoints.hpp"
+#if !defined(NGRAPH_DEX_ONLY)
+#include "ngraph/codegen/compiler.hpp"
+#include "ngraph/codegen/execution_engine.hpp"
+#endif
 #include "ngraph/file_util.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
@@ -31,6 +41,10 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
+#include "ngraph/runtime/cpu/cpu_backend.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/cpu_schedule.hpp"
+#include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
@@ -218,6 +232,80 @@ TEST(cpu_test, mkldnn_layouts)
     EXPECT_EQ(vector<float>{expected_result}, rv);
 }
 
+TEST(cpu_test, mkldnn_layout_native_read)
+{
+    Shape shape_a{1, 16, 2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape_a);
+    Shape shape_b{32, 16, 1, 1};
+    auto B = make_shared<op::Parameter>(element::f32, shape_b);
+    Shape shape_r{1, 32, 2, 2};
+    auto conv1 = make_shared<op::Convolution>(A,
+                                              B,
+                                              Strides{1, 1},
+                                              Strides{1, 1},
+                                              CoordinateDiff{0, 0},
+                                              CoordinateDiff{0, 0},
+                                              Strides{1, 1});
+    // The result keeps the blocked layout of the convolution
+    auto f = make_shared<Function>(conv1, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+
+    vector<float> input(64, 1.0f);
+    vector<float> weights(128, 0.0f);
+    weights.resize(512, 1.0f);
+    vector<float> expected_result(32, 0.0f);
+    expected_result.resize(128, 16.0f);
+
+    auto a = backend->create_tensor(element::f32, shape_a, input.data());
+    auto b = backend->create_tensor(element::f32, shape_b, weights.data());
+    auto result = backend->create_tensor(element::f32, shape_r);
+    auto handle = backend->compile(f);
+
+    for (size_t i = 0; i < 2; i++)
+    {
+        backend->call_with_validate(handle, {result}, {a, b});
+
+        EXPECT_EQ(expected_result, read_vector<float>(result));
+
+        // Repeated reads reuse the same reorder primitive
+        size_t hits = runtime::cpu::CPUTensorView::get_reorder_cache_hits();
+        size_t misses = runtime::cpu::CPUTensorView::get_reorder_cache_misses();
+        EXPECT_EQ(expected_result, read_vector<float>(result));
+        EXPECT_EQ(runtime::cpu::CPUTensorView::get_reorder_cache_hits(), hits + 1);
+        EXPECT_EQ(runtime::cpu::CPUTensorView::get_reorder_cache_misses(), misses);
+
+        // Partial reads, even from several threads, convert the layout only once
+        vector<vector<float>> slices(4, vector<float>(32));
+        vector<thread> readers;
+        for (size_t t = 0; t < slices.size(); t++)
+        {
+            readers.push_back(thread([&result, &slices, t]() {
+                result->read(slices[t].data(), t * 32 * sizeof(float), 32 * sizeof(float));
+            }));
+        }
+        for (auto& reader : readers)
+        {
+            reader.join();
+        }
+        vector<float> partial_result;
+        for (auto& slice : slices)
+        {
+            partial_result.insert(partial_result.end(), slice.begin(), slice.end());
+        }
+        EXPECT_EQ(expected_result, partial_result);
+        EXPECT_EQ(runtime::cpu::CPUTensorView::get_reorder_cache_hits() +
+                      runtime::cpu::CPUTensorView::get_reorder_cache_misses(),
+                  hits + misses + 2);
+
+        auto cpu_result = static_pointer_cast<runtime::cpu::CPUTensorView>(result);
+        auto native = static_cast<const float*>(cpu_result->get_native_data_ptr());
+        EXPECT_EQ(expected_result, vector<float>(native, native + expected_result.size()));
+        EXPECT_EQ(native, cpu_result->get_native_data_ptr());
+        EXPECT_EQ(expected_result, read_vector<float>(result));
+    }
+}
+
 TEST(cpu_test, reshape_layout_optimizations1)
 {
     // Squeeze outermost dimension
@@ -665,3 +753,336 @@ TEST(cpu_test, convolution_large_padding)
     auto cpu_f = make_function();
     compare_backends(int_f, cpu_f, "INTERPRETER", "CPU", 1e-4, 1e-4);
 }
+
+TEST(cpu_test, concurrent_calls)
+{
+    Shape shape{16, 16};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto sum = make_shared<op::Sum>((A + B) * C, AxisSet{1});
+    auto f = make_shared<Function>(make_shared<op::Negative>(sum), ParameterVector{A, B, C});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto handle = backend->compile(f);
+
+    const size_t num_threads = 8;
+    const size_t num_iterations = 50;
+    vector<thread> threads;
+    vector<size_t> failures(num_threads, 0);
+    for (size_t t = 0; t < num_threads; t++)
+    {
+        threads.emplace_back([&, t]() {
+            auto a = backend->create_tensor(element::f32, shape);
+            auto b = backend->create_tensor(element::f32, shape);
+            auto c = backend->create_tensor(element::f32, shape);
+            auto result = backend->create_tensor(element::f32, Shape{16});
+
+            float value = static_cast<float>(t + 1);
+            copy_data(a, vector<float>(shape_size(shape), value));
+            copy_data(b, vector<float>(shape_size(shape), 1.0f));
+            copy_data(c, vector<float>(shape_size(shape), 2.0f));
+            vector<float> expected(16, -2.0f * (value + 1.0f) * 16);
+
+            for (size_t i = 0; i < num_iterations; i++)
+            {
+                backend->call(handle, {result}, {a, b, c});
+                if (read_vector<float>(result) != expected)
+                {
+                    failures[t]++;
+                }
+            }
+        });
+    }
+    for (auto& th : threads)
+    {
+        th.join();
+    }
+
+    for (size_t t = 0; t < num_threads; t++)
+    {
+        EXPECT_EQ(failures[t], 0) << "thread " << t << " produced wrong results";
+    }
+}
+
+TEST(cpu_test, inter_op_schedule)
+{
+    // Two independent chains joined by a final kernel
+    vector<vector<size_t>> dependencies{{}, {0}, {1}, {}, {3}, {4}, {2, 5}};
+    vector<size_t> costs(dependencies.size(), 10);
+    runtime::cpu::CPUSchedule schedule(dependencies, costs, 4);
+
+    ASSERT_EQ(schedule.get_num_streams(), 2);
+    size_t scheduled = 0;
+    for (size_t stream = 0; stream < schedule.get_num_streams(); stream++)
+    {
+        EXPECT_EQ(schedule.get_stream(stream).size() % 3, stream == 0 ? 1 : 0);
+        scheduled += schedule.get_stream(stream).size();
+    }
+    EXPECT_EQ(scheduled, dependencies.size());
+    EXPECT_EQ(schedule.get_waits(6).size(), 1);
+    EXPECT_EQ(schedule.get_kernel_stream(0), schedule.get_kernel_stream(2));
+
+    mutex order_mutex;
+    vector<size_t> order;
+    vector<thread> workers;
+    auto spawn = [&workers](size_t, function<void()> f) { workers.emplace_back(f); };
+    schedule.execute(
+        [&](size_t kernel, size_t) {
+            lock_guard<mutex> lock(order_mutex);
+            order.push_back(kernel);
+        },
+        spawn);
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    ASSERT_EQ(order.size(), dependencies.size());
+    for (size_t kernel = 0; kernel < dependencies.size(); kernel++)
+    {
+        auto position = find(order.begin(), order.end(), kernel);
+        ASSERT_NE(position, order.end());
+        for (size_t dependency : dependencies[kernel])
+        {
+            EXPECT_LT(find(order.begin(), order.end(), dependency), position);
+        }
+    }
+
+    workers.clear();
+    EXPECT_THROW(schedule.execute(
+                     [](size_t kernel, size_t) {
+                         if (kernel == 4)
+                         {
+                             throw ngraph_error("kernel failed");
+                         }
+                     },
+                     spawn),
+                 ngraph_error);
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+TEST(cpu_test, inter_op_executor_blocked_task)
+{
+    mutex task_mutex;
+    condition_variable task_cv;
+    bool second_started = false;
+    bool first_done = false;
+    runtime::cpu::executor::CPUExecutor executor(2, chrono::milliseconds(50));
+
+    // The first task can only finish once the second one runs on another worker
+    executor.schedule([&]() {
+        unique_lock<mutex> lock(task_mutex);
+        task_cv.wait(lock, [&]() { return second_started; });
+        first_done = true;
+        task_cv.notify_all();
+    });
+    executor.schedule([&]() {
+        lock_guard<mutex> lock(task_mutex);
+        second_started = true;
+        task_cv.notify_all();
+    });
+    {
+        unique_lock<mutex> lock(task_mutex);
+        EXPECT_TRUE(task_cv.wait_for(lock, chrono::seconds(10), [&]() { return first_done; }));
+        // Let the executor shut down even if the second task never started
+        second_started = true;
+        task_cv.notify_all();
+    }
+
+    // Idle workers exit after the timeout
+    auto deadline = chrono::steady_clock::now() + chrono::seconds(10);
+    while (executor.get_num_inter_op_workers() > 0 && chrono::steady_clock::now() < deadline)
+    {
+        this_thread::sleep_for(chrono::milliseconds(10));
+    }
+    EXPECT_EQ(executor.get_num_inter_op_workers(), 0);
+}
+
+TEST(cpu_test, inter_op_concurrent_calls)
+{
+    // Two independent branches, so the function is spread over both thread pools
+    auto run_concurrent_calls = []() {
+        // Read once by the global executor, so this only works in a fresh process
+        setenv("NGRAPH_INTER_OP_PARALLELISM", "2", 1);
+
+        Shape shape{4, 4};
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        auto C = make_shared<op::Parameter>(element::f32, shape);
+        auto D = make_shared<op::Parameter>(element::f32, shape);
+        auto left = make_shared<op::Negative>(make_shared<op::Dot>(A, B));
+        auto right = make_shared<op::Negative>(make_shared<op::Dot>(C, D));
+        auto f = make_shared<Function>(left + right, ParameterVector{A, B, C, D});
+
+        auto backend = runtime::Backend::create("CPU");
+        auto handle = backend->compile(f);
+
+        const size_t num_threads = 8;
+        const size_t num_iterations = 50;
+        vector<thread> threads;
+        vector<size_t> failures(num_threads, 0);
+        for (size_t t = 0; t < num_threads; t++)
+        {
+            threads.emplace_back([&, t]() {
+                auto a = backend->create_tensor(element::f32, shape);
+                auto b = backend->create_tensor(element::f32, shape);
+                auto c = backend->create_tensor(element::f32, shape);
+                auto d = backend->create_tensor(element::f32, shape);
+                auto result = backend->create_tensor(element::f32, shape);
+
+                float value = static_cast<float>(t + 1);
+                copy_data(a, vector<float>(shape_size(shape), value));
+                copy_data(b, vector<float>(shape_size(shape), 1.0f));
+                copy_data(c, vector<float>(shape_size(shape), 1.0f));
+                copy_data(d, vector<float>(shape_size(shape), 2.0f));
+                vector<float> expected(shape_size(shape), -4.0f * value - 8.0f);
+
+                for (size_t i = 0; i < num_iterations; i++)
+                {
+                    backend->call(handle, {result}, {a, b, c, d});
+                    if (read_vector<float>(result) != expected)
+                    {
+                        failures[t]++;
+                    }
+                }
+            });
+        }
+        for (auto& th : threads)
+        {
+            th.join();
+        }
+
+        auto& executor = runtime::cpu::executor::GetCPUExecutor();
+        bool used_streams =
+            executor.get_num_thread_pools() == 2 && executor.get_num_inter_op_workers() > 0;
+        bool correct = all_of(failures.begin(), failures.end(), [](size_t n) { return n == 0; });
+        return used_streams && correct ? 0 : 1;
+    };
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wused-but-marked-unused"
+#pragma clang diagnostic ignored "-Wcovered-switch-default"
+
+    ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+    EXPECT_EXIT(exit(run_concurrent_calls()), ::testing::ExitedWithCode(0), "");
+
+#pragma clang diagnostic pop
+}
+
+TEST(cpu_test, cacheable_subgraph_kept_across_calls)
+{
+    Shape shape{4, 4};
+    auto W = make_shared<op::Parameter>(element::f32, shape, true);
+    auto X = make_shared<op::Parameter>(element::f32, shape);
+    auto weights = make_shared<op::Reshape>(W * W, AxisVector{1, 0}, shape);
+    auto f = make_shared<Function>(weights + X, ParameterVector{W, X});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto cpu_backend = static_cast<runtime::cpu::CPU_Backend*>(backend.get());
+    auto handle = backend->compile(f);
+    ASSERT_GT(f->get_cache_pool_size(), 0);
+
+    auto w = backend->create_tensor(element::f32, shape);
+    auto x = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(w, vector<float>(shape_size(shape), 2.0f));
+    copy_data(x, vector<float>(shape_size(shape), 1.0f));
+    backend->call(handle, {result}, {w, x});
+    EXPECT_EQ(read_vector<float>(result), vector<float>(shape_size(shape), 5.0f));
+
+    // New weights that are not flagged stale keep using the cached preprocessing
+    copy_data(w, vector<float>(shape_size(shape), 3.0f));
+    w->set_stale(false);
+    copy_data(x, vector<float>(shape_size(shape), 2.0f));
+    backend->call(handle, {result}, {w, x});
+    EXPECT_EQ(read_vector<float>(result), vector<float>(shape_size(shape), 6.0f));
+
+    cpu_backend->invalidate_cache(f);
+    backend->call(handle, {result}, {w, x});
+    EXPECT_EQ(read_vector<float>(result), vector<float>(shape_size(shape), 11.0f));
+}
+
+#if !defined(NGRAPH_DEX_ONLY)
+TEST(cpu_test, codegen_cache)
+{
+    string cache_dir =
+        file_util::path_join(file_util::get_temp_directory_path(), "ngraph_codegen_cache_test");
+    file_util::remove_directory(cache_dir);
+    setenv("NGRAPH_CODEGEN_CACHE_DIR", cache_dir.c_str(), 1);
+
+    auto list_entries = [&cache_dir]() {
+        set<string> entries;
+        file_util::iterate_files(cache_dir, [&entries](const string& file, bool is_dir) {
+            if (!is_dir && file_util::get_file_ext(file) == ".bc")
+            {
+                entries.insert(file);
+            }
+        });
+        return entries;
+    };
+
+    const string source = "extern \"C\" int codegen_cache_test() { return 42; }\n";
+    {
+        codegen::Compiler compiler;
+        ASSERT_EQ(compiler.get_cache_directory(), cache_dir);
+        EXPECT_TRUE(compiler.compile(source) != nullptr);
+        EXPECT_EQ(compiler.get_cache_hits(), 0);
+        EXPECT_EQ(compiler.get_cache_misses(), 1);
+    }
+    set<string> entries = list_entries();
+    ASSERT_EQ(entries.size(), 1);
+    string original_entry = *entries.begin();
+
+    {
+        // A new compiler, as in a new process, loads the module from disk
+        codegen::Compiler compiler;
+        codegen::ExecutionEngine execution_engine;
+        auto module = compiler.compile(source);
+        ASSERT_TRUE(module != nullptr);
+        EXPECT_EQ(compiler.get_cache_hits(), 1);
+        EXPECT_EQ(compiler.get_cache_misses(), 0);
+
+        execution_engine.add_module(module);
+        execution_engine.finalize();
+        auto function = execution_engine.find_function<int()>("codegen_cache_test");
+        ASSERT_TRUE(function);
+        EXPECT_EQ(function(), 42);
+    }
+
+    {
+        // Any change to the source is a new entry
+        codegen::Compiler compiler;
+        EXPECT_TRUE(compiler.compile(source + "// changed\n") != nullptr);
+        EXPECT_EQ(compiler.get_cache_hits(), 0);
+        EXPECT_EQ(compiler.get_cache_misses(), 1);
+    }
+    entries = list_entries();
+    ASSERT_EQ(entries.size(), 2);
+    entries.erase(original_entry);
+    string changed_entry = *entries.begin();
+
+    {
+        // An entry holding another source, as after a hash collision, is a miss and rewritten
+        ofstream(changed_entry, ios::binary | ios::trunc)
+            << file_util::read_file_to_string(original_entry);
+        codegen::Compiler compiler;
+        EXPECT_TRUE(compiler.compile(source + "// changed\n") != nullptr);
+        EXPECT_EQ(compiler.get_cache_hits(), 0);
+        EXPECT_EQ(compiler.get_cache_misses(), 1);
+    }
+    {
+        codegen::Compiler compiler;
+        EXPECT_TRUE(compiler.compile(source + "// changed\n") != nullptr);
+        EXPECT_EQ(compiler.get_cache_hits(), 1);
+        EXPECT_EQ(compiler.get_cache_misses(), 0);
+    }
+    EXPECT_EQ(list_entries().size(), 2);
+
+    unsetenv("NGRAPH_CODEGEN_CACHE_DIR");
+    file_util::remove_directory(cache_dir);
+}
+#endif
@@ -986,6 +986,24 @@ TEST(onnx, model_shape)
     EXPECT_TRUE(test::all_close(expected_output.front(), outputs.front()));
 }
 
+TEST(onnx, model_gather)
+{
+    auto function =
+        onnx_import::import_onnx_model(file_util::path_join(SERIALIZED_ZOO, "onnx/gather.onnx"));
+
+    // The indices {{0, 2}} are an initializer; the model gathers along axis 1
+    Inputs inputs;
+    inputs.emplace_back(
+        test::NDArray<float, 2>({{1.0f, 1.2f, 1.9f}, {2.3f, 3.4f, 3.9f}, {4.5f, 5.7f, 5.9f}})
+            .get_vector());
+
+    Outputs expected_output{
+        test::NDArray<float, 3>({{{1.0f, 1.9f}}, {{2.3f, 3.9f}}, {{4.5f, 5.9f}}}).get_vector()};
+
+    Outputs outputs{execute(function, inputs, "INTERPRETER")};
+    EXPECT_TRUE(test::all_close_f(expected_output.front(), outputs.front()));
+}
+
 TEST(onnx, model_elu)
 {
     auto function =
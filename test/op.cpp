@@ -22,6 +22,7 @@
 #include "gtest/gtest.h"
 
 #include "ngraph/ngraph.hpp"
+#include "ngraph/op/util/reducer.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -41,3 +42,51 @@ TEST(op, is_parameter)
     ASSERT_NE(nullptr, t0);
     EXPECT_FALSE(t0->is_parameter());
 }
+
+TEST(op, reducer_kind)
+{
+    auto make_reducer = [](const element::Type& type,
+                           function<shared_ptr<Node>(shared_ptr<Node>, shared_ptr<Node>)> body) {
+        auto x = make_shared<op::Parameter>(type, Shape{});
+        auto y = make_shared<op::Parameter>(type, Shape{});
+        return make_shared<Function>(body(x, y), ParameterVector{x, y});
+    };
+
+    EXPECT_EQ(op::util::ReducerKind::Add,
+              op::util::get_reducer_kind(make_reducer(
+                  element::f32, [](shared_ptr<Node> x, shared_ptr<Node> y) { return x + y; })));
+    EXPECT_EQ(op::util::ReducerKind::Maximum,
+              op::util::get_reducer_kind(make_reducer(
+                  element::i32, [](shared_ptr<Node> x, shared_ptr<Node> y) {
+                      return make_shared<op::Maximum>(y, x);
+                  })));
+    EXPECT_EQ(op::util::ReducerKind::Or,
+              op::util::get_reducer_kind(make_reducer(
+                  element::boolean, [](shared_ptr<Node> x, shared_ptr<Node> y) {
+                      return make_shared<op::Or>(x, y);
+                  })));
+    EXPECT_EQ(op::util::ReducerKind::Multiply,
+              op::util::get_reducer_kind(make_reducer(
+                  element::f32, [](shared_ptr<Node> x, shared_ptr<Node> y) {
+                      auto product = make_shared<op::Convert>(x, element::f64) *
+                                     make_shared<op::Convert>(y, element::f64);
+                      return make_shared<op::Convert>(product, element::f32);
+                  })));
+
+    // Narrowing, using one parameter twice and extra ops are not recognised
+    EXPECT_EQ(op::util::ReducerKind::Unknown,
+              op::util::get_reducer_kind(make_reducer(
+                  element::f64, [](shared_ptr<Node> x, shared_ptr<Node> y) {
+                      auto sum = make_shared<op::Convert>(x, element::f32) +
+                                 make_shared<op::Convert>(y, element::f32);
+                      return make_shared<op::Convert>(sum, element::f64);
+                  })));
+    EXPECT_EQ(op::util::ReducerKind::Unknown,
+              op::util::get_reducer_kind(make_reducer(
+                  element::f32, [](shared_ptr<Node> x, shared_ptr<Node> y) { return x + x; })));
+    EXPECT_EQ(op::util::ReducerKind::Unknown,
+              op::util::get_reducer_kind(make_reducer(
+                  element::f32, [](shared_ptr<Node> x, shared_ptr<Node> y) {
+                      return make_shared<op::Negative>(x + y);
+                  })));
+}
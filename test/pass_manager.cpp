@@ -14,16 +14,22 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <fstream>
 #include <memory>
+#include <set>
 #include <sstream>
 #include <string>
 #include <vector>
 
 #include "gtest/gtest.h"
 
+#include "ngraph/file_util.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/reshape_elimination.hpp"
+#include "ngraph/pass/validate_graph.hpp"
+#include "nlohmann/json.hpp"
 #include "util/test_tools.hpp"
 
 using namespace ngraph;
@@ -59,3 +65,77 @@ TEST(pass_manager, module_add_function)
                                        make_shared<op::FunctionCall>(f, NodeVector{X, Y, Z}),
                                    ParameterVector{X, Y, Z});
 }
+
+TEST(pass_manager, profile)
+{
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto identity = make_shared<op::Reshape>(A, AxisVector{0, 1}, shape);
+    auto f = make_shared<Function>(make_shared<op::Abs>(identity), ParameterVector{A});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ValidateGraph>();
+    pass_manager.register_pass<pass::ReshapeElimination>();
+    pass_manager.set_pass_profiling(true);
+    pass_manager.run_passes(f);
+
+    auto& profile = pass_manager.get_pass_profile();
+    ASSERT_EQ(profile.size(), 2);
+    EXPECT_EQ(profile[0].nodes_before, profile[0].nodes_after);
+    EXPECT_EQ(profile[0].nodes_allocated, 0);
+    EXPECT_TRUE(profile[0].matchers.empty());
+    EXPECT_EQ(profile[1].nodes_before, profile[1].nodes_after + 1);
+    EXPECT_LE(profile[0].start + profile[0].duration, profile[1].start);
+
+    size_t attempts = 0;
+    size_t rewrites = 0;
+    for (auto& stats : profile[1].matchers)
+    {
+        attempts += stats.attempts;
+        rewrites += stats.rewrites;
+    }
+    EXPECT_GT(attempts, 0);
+    EXPECT_EQ(rewrites, 1);
+
+    stringstream ss;
+    pass::write_pass_profile_json(ss, profile);
+    auto json = nlohmann::json::parse(ss.str());
+    ASSERT_EQ(json.size(), 2);
+    EXPECT_EQ(json[1]["nodes_after"].get<size_t>(), profile[1].nodes_after);
+    EXPECT_EQ(json[1]["matchers"].size(), profile[1].matchers.size());
+}
+
+TEST(pass_manager, profile_timeline_collects_runs)
+{
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto identity = make_shared<op::Reshape>(A, AxisVector{0, 1}, shape);
+    auto f = make_shared<Function>(make_shared<op::Abs>(identity), ParameterVector{A});
+    auto g = make_shared<Function>(make_shared<op::Negative>(A), ParameterVector{A});
+
+    string file_name = file_util::tmp_filename(".json");
+    setenv("NGRAPH_PROFILE_PASS_TIMELINE", file_name.c_str(), 1);
+    for (auto function : {f, g, f})
+    {
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::ValidateGraph>();
+        pass_manager.register_pass<pass::ReshapeElimination>();
+        pass_manager.run_passes(function);
+    }
+    unsetenv("NGRAPH_PROFILE_PASS_TIMELINE");
+
+    // Every run is in the file, each on its own row
+    ifstream in(file_name);
+    auto json = nlohmann::json::parse(in);
+    set<size_t> runs;
+    size_t pass_events = 0;
+    for (auto& event : json["traceEvents"])
+    {
+        runs.insert(event["tid"].get<size_t>());
+        pass_events += event["cat"] == "Pass";
+    }
+    EXPECT_EQ(runs, (set<size_t>{0, 1, 2}));
+    EXPECT_EQ(pass_events, 6);
+    in.close();
+    file_util::remove_file(file_name);
+}
@@ -236,3 +236,46 @@ TEST(memory_layout, constant)
     size_t temporary_pool_size = f->get_temporary_pool_size();
     EXPECT_EQ(4, temporary_pool_size);
 }
+
+TEST(memory_interval_packer, pack)
+{
+    pass::MemoryIntervalPacker packer;
+    size_t a = packer.add(8, 0, 1);
+    size_t b = packer.add(4, 1, 2);
+    size_t c = packer.add(8, 2, 3);
+    size_t d = packer.add(4, 3, 3);
+    packer.pack();
+
+    EXPECT_EQ(0, packer.get_offset(a));
+    EXPECT_EQ(8, packer.get_offset(b));
+    EXPECT_EQ(0, packer.get_offset(c));
+    EXPECT_EQ(8, packer.get_offset(d));
+    EXPECT_EQ(12, packer.max_allocated());
+    EXPECT_EQ(12, packer.lower_bound());
+}
+
+TEST(memory_interval_packer, fill_gap)
+{
+    pass::MemoryIntervalPacker packer{8};
+    packer.add(8, 0, 4);
+    size_t short_lived = packer.add(8, 0, 1);
+    packer.add(8, 0, 4);
+    size_t late = packer.add(4, 2, 4);
+    packer.pack();
+
+    EXPECT_EQ(8, packer.get_offset(short_lived));
+    EXPECT_EQ(8, packer.get_offset(late));
+    EXPECT_EQ(24, packer.max_allocated());
+    EXPECT_EQ(24, packer.lower_bound());
+}
+
+TEST(memory_layout, interval_packing)
+{
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryLayout>(1, false, true);
+
+    auto graph = make_test_graph();
+    pass_manager.run_passes(graph);
+    EXPECT_EQ(12, graph->get_temporary_pool_size());
+}
@@ -390,6 +390,147 @@ TEST(pattern, graph_rewrite)
     }
 }
 
+class TestWorkListGraphRewrite : public ngraph::pass::GraphRewrite
+{
+public:
+    void construct_abs_negative()
+    {
+        // abs(-a) = abs(a)
+        auto a = std::make_shared<pattern::op::Label>(element::i32, Shape{});
+        auto pattern = std::make_shared<op::Abs>(std::make_shared<op::Negative>(a));
+
+        ngraph::pattern::graph_rewrite_callback callback = [this, a](pattern::Matcher& m) {
+            auto pattern_map = m.get_pattern_map();
+            ngraph::replace_node(m.get_match_root(), std::make_shared<op::Abs>(pattern_map[a]));
+            // request another pass with the same matcher
+            this->construct_abs_negative();
+            return true;
+        };
+
+        this->add_matcher(make_shared<pattern::Matcher>(pattern, callback, "abs_negative"));
+    }
+
+    TestWorkListGraphRewrite()
+        : GraphRewrite()
+    {
+        construct_abs_negative();
+    }
+};
+
+TEST(pattern, graph_rewrite_work_list)
+{
+    Shape shape{};
+    auto a = make_shared<op::Parameter>(element::i32, shape);
+    auto b = make_shared<op::Parameter>(element::i32, shape);
+    auto abs_negative = make_shared<op::Abs>(make_shared<op::Negative>(a));
+    shared_ptr<Node> chain = b;
+    for (size_t i = 0; i < 10; i++)
+    {
+        chain = make_shared<op::Abs>(chain);
+    }
+    auto f = make_shared<Function>(NodeVector{abs_negative, chain}, ParameterVector{a, b});
+
+    auto rewrite = make_shared<TestWorkListGraphRewrite>();
+    rewrite->run_on_function(f);
+
+    auto abs = f->get_results().at(0)->get_argument(0);
+    ASSERT_TRUE(std::dynamic_pointer_cast<op::Abs>(abs));
+    ASSERT_EQ(abs->get_argument(0), a);
+    ASSERT_EQ(count_ops_of_type<op::Negative>(f), 0);
+
+    // Only Abs nodes are tried, and the second pass only revisits the new Abs
+    auto& stats = rewrite->get_matcher_stats();
+    ASSERT_EQ(stats.size(), 1);
+    EXPECT_EQ(stats.at(0).name, "abs_negative");
+    EXPECT_EQ(stats.at(0).attempts, 12);
+    EXPECT_EQ(stats.at(0).matches, 1);
+    EXPECT_EQ(stats.at(0).rewrites, 1);
+}
+
+class TestNamedGraphRewrite : public ngraph::pass::GraphRewrite
+{
+public:
+    void construct_unary_pair(const std::string& name,
+                              const std::shared_ptr<Node>& pattern,
+                              const std::shared_ptr<pattern::op::Label>& a,
+                              bool keep_outer)
+    {
+        ngraph::pattern::graph_rewrite_callback callback = [this, a, keep_outer, name](
+            pattern::Matcher& m) {
+            auto pattern_map = m.get_pattern_map();
+            auto root = m.get_match_root();
+            ngraph::replace_node(root,
+                                 keep_outer ? root->copy_with_new_args({pattern_map[a]})
+                                            : pattern_map[a]);
+            if (name == "negative_negative")
+            {
+                // registers a matcher with a new name while the run is under way
+                this->construct_abs_abs("abs_abs_late");
+            }
+            return true;
+        };
+
+        this->add_matcher(make_shared<pattern::Matcher>(pattern, callback, name));
+    }
+
+    void construct_abs_abs(const std::string& name)
+    {
+        auto a = std::make_shared<pattern::op::Label>(element::i32, Shape{});
+        construct_unary_pair(
+            name, std::make_shared<op::Abs>(std::make_shared<op::Abs>(a)), a, true);
+    }
+
+    TestNamedGraphRewrite()
+        : GraphRewrite()
+    {
+        auto a = std::make_shared<pattern::op::Label>(element::i32, Shape{});
+        construct_unary_pair(
+            "negative_negative",
+            std::make_shared<op::Negative>(std::make_shared<op::Negative>(a)),
+            a,
+            false);
+        auto b = std::make_shared<pattern::op::Label>(element::i32, Shape{});
+        construct_unary_pair(
+            "abs_negative", std::make_shared<op::Abs>(std::make_shared<op::Negative>(b)), b, true);
+        construct_abs_abs("abs_abs");
+    }
+};
+
+TEST(pattern, graph_rewrite_matcher_stats)
+{
+    Shape shape{};
+    auto a = make_shared<op::Parameter>(element::i32, shape);
+    auto b = make_shared<op::Parameter>(element::i32, shape);
+    auto c = make_shared<op::Parameter>(element::i32, shape);
+    auto negative_negative = make_shared<op::Negative>(make_shared<op::Negative>(a));
+    auto abs_negative = make_shared<op::Abs>(make_shared<op::Negative>(b));
+    auto abs_abs = make_shared<op::Abs>(make_shared<op::Abs>(c));
+    auto f = make_shared<Function>(NodeVector{negative_negative, abs_negative, abs_abs},
+                                   ParameterVector{a, b, c});
+
+    auto rewrite = make_shared<TestNamedGraphRewrite>();
+    rewrite->run_on_function(f);
+
+    EXPECT_EQ(f->get_results().at(0)->get_argument(0), a);
+    EXPECT_EQ(count_ops_of_type<op::Negative>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::Abs>(f), 2);
+
+    // statistics are kept per name, in registration order
+    auto& stats = rewrite->get_matcher_stats();
+    ASSERT_EQ(stats.size(), 4);
+    EXPECT_EQ(stats.at(0).name, "negative_negative");
+    EXPECT_EQ(stats.at(1).name, "abs_negative");
+    EXPECT_EQ(stats.at(2).name, "abs_abs");
+    EXPECT_EQ(stats.at(3).name, "abs_abs_late");
+    for (size_t i = 0; i < 3; i++)
+    {
+        EXPECT_GT(stats.at(i).attempts, 0);
+        EXPECT_EQ(stats.at(i).matches, 1);
+        EXPECT_EQ(stats.at(i).rewrites, 1);
+    }
+    EXPECT_EQ(stats.at(3).rewrites, 0);
+}
+
 std::ostream& operator<<(std::ostream& os, const ngraph::NodeVector& nv)
 {
     std::vector<std::string> names;
@@ -19,6 +19,7 @@
 
 #include "gtest/gtest.h"
 
+#include "ngraph/cpio.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/serializer.hpp"
@@ -157,6 +158,39 @@ TEST(serialize, constant)
     EXPECT_TRUE(found);
 }
 
+TEST(serialize, constant_aligned_in_place)
+{
+    const string tmp_file = "serialize_constant_aligned.cpio";
+    auto A = op::Constant::create(element::i8, Shape{3}, {1, 2, 3});
+    auto B = op::Constant::create(element::f32, Shape{5}, {1, 2, 3, 4, 5});
+    auto f = make_shared<Function>(NodeVector{A, B}, ParameterVector{});
+    serialize(tmp_file, f);
+    {
+        cpio::Reader reader(tmp_file);
+        for (const string& name : {A->get_name(), B->get_name()})
+        {
+            const cpio::FileInfo* info = reader.find(name);
+            ASSERT_NE(info, nullptr);
+            EXPECT_EQ(info->get_offset() % 64, 0);
+        }
+    }
+
+    auto g = deserialize(tmp_file);
+    ASSERT_NE(g, nullptr);
+    file_util::remove_file(tmp_file);
+    auto g_A = dynamic_pointer_cast<op::Constant>(g->get_results().at(0)->get_argument(0));
+    auto g_B = dynamic_pointer_cast<op::Constant>(g->get_results().at(1)->get_argument(0));
+    ASSERT_NE(g_A, nullptr);
+    ASSERT_NE(g_B, nullptr);
+    EXPECT_EQ((vector<int8_t>{1, 2, 3}), g_A->get_vector<int8_t>());
+    EXPECT_EQ((vector<float>{1, 2, 3, 4, 5}), g_B->get_vector<float>());
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(g_B->get_data_ptr()) % 64, 0);
+
+    // Copies share the loaded data
+    auto copy = dynamic_pointer_cast<op::Constant>(g_B->copy_with_new_args(NodeVector{}));
+    EXPECT_EQ(copy->get_data_ptr(), g_B->get_data_ptr());
+}
+
 TEST(benchmark, serialize)
 {
     stopwatch timer;
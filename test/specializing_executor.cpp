@@ -0,0 +1,212 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/specializing_executor.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Runs on INTERPRETER, but holds back compiling Functions of `gated_rows` rows until opened
+class GatedBackend : public runtime::Backend
+{
+public:
+    GatedBackend(size_t gated_rows)
+        : m_backend(runtime::Backend::create("INTERPRETER"))
+        , m_gated_rows(gated_rows)
+        , m_gate(m_open.get_future().share())
+    {
+    }
+
+    shared_ptr<runtime::Tensor> create_tensor(const element::Type& element_type,
+                                              const Shape& shape) override
+    {
+        return m_backend->create_tensor(element_type, shape);
+    }
+
+    shared_ptr<runtime::Tensor> create_tensor(const element::Type& element_type,
+                                              const Shape& shape,
+                                              void* memory_pointer) override
+    {
+        return m_backend->create_tensor(element_type, shape, memory_pointer);
+    }
+
+    runtime::Handle compile(shared_ptr<Function> func) override
+    {
+        if (func->get_parameters().at(0)->get_shape().at(0) == m_gated_rows)
+        {
+            m_gated_compiles++;
+            m_gate.wait();
+        }
+        return m_backend->compile(func);
+    }
+
+    bool call(shared_ptr<Function> func,
+              const vector<shared_ptr<runtime::Tensor>>& outputs,
+              const vector<shared_ptr<runtime::Tensor>>& inputs) override
+    {
+        return m_backend->call(func, outputs, inputs);
+    }
+
+    void remove_compiled_function(shared_ptr<Function> func) override
+    {
+        m_backend->remove_compiled_function(func);
+    }
+
+    void open() { m_open.set_value(); }
+    size_t get_gated_compiles() { return m_gated_compiles; }
+private:
+    shared_ptr<runtime::Backend> m_backend;
+    size_t m_gated_rows;
+    promise<void> m_open;
+    shared_future<void> m_gate;
+    atomic<size_t> m_gated_compiles{0};
+};
+
+TEST(specializing_executor, compiles_once_per_shape)
+{
+    auto A = make_shared<op::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 2});
+    auto B = make_shared<op::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 2});
+    auto f = make_shared<Function>(NodeVector{A * B + A}, ParameterVector{A, B});
+
+    shared_ptr<runtime::Backend> backend = runtime::Backend::create("INTERPRETER");
+    runtime::SpecializingExecutor executor(backend, f, 2);
+
+    auto run = [&](size_t rows) {
+        Shape shape{rows, 2};
+        EXPECT_EQ(executor.get_output_shapes({shape, shape}), vector<Shape>{shape});
+        auto a = backend->create_tensor(element::f32, shape);
+        auto b = backend->create_tensor(element::f32, shape);
+        auto result = backend->create_tensor(element::f32, shape);
+        vector<float> values(shape_size(shape));
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            values[i] = static_cast<float>(i);
+        }
+        copy_data(a, values);
+        copy_data(b, vector<float>(values.size(), 2.0f));
+        executor.call({result}, {a, b});
+
+        vector<float> expected;
+        for (float x : values)
+        {
+            expected.push_back(3 * x);
+        }
+        EXPECT_EQ(expected, read_vector<float>(result));
+    };
+
+    run(3);
+    run(3);
+    EXPECT_EQ(executor.get_compile_count(), 1);
+    run(5);
+    run(1);
+    EXPECT_EQ(executor.get_compile_count(), 3);
+    EXPECT_EQ(executor.get_specialization_count(), 2);
+    // The shape of 3 rows was the least recently used one and has been evicted
+    run(3);
+    EXPECT_EQ(executor.get_compile_count(), 4);
+    run(1);
+    EXPECT_EQ(executor.get_compile_count(), 4);
+}
+
+TEST(specializing_executor, buckets)
+{
+    auto A = make_shared<op::Parameter>(element::f32, PartialShape{2, Dimension::dynamic()});
+    auto f = make_shared<Function>(NodeVector{-A}, ParameterVector{A});
+
+    shared_ptr<runtime::Backend> backend = runtime::Backend::create("INTERPRETER");
+    runtime::SpecializingExecutor executor(backend, f, 4, {4, 8});
+
+    for (size_t length = 1; length <= 8; length++)
+    {
+        Shape shape{2, length};
+        auto a = backend->create_tensor(element::f32, shape);
+        auto result = backend->create_tensor(element::f32, shape);
+        vector<float> values(shape_size(shape));
+        vector<float> expected(shape_size(shape));
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            values[i] = static_cast<float>(i + 1);
+            expected[i] = -values[i];
+        }
+        copy_data(a, values);
+        executor.call({result}, {a});
+        EXPECT_EQ(expected, read_vector<float>(result));
+    }
+    EXPECT_EQ(executor.get_compile_count(), 2);
+}
+
+TEST(specializing_executor, rejects_incompatible_shapes)
+{
+    auto A = make_shared<op::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 2});
+    auto f = make_shared<Function>(NodeVector{-A}, ParameterVector{A});
+
+    shared_ptr<runtime::Backend> backend = runtime::Backend::create("INTERPRETER");
+    runtime::SpecializingExecutor executor(backend, f);
+
+    auto a = backend->create_tensor(element::f32, Shape{3, 3});
+    auto result = backend->create_tensor(element::f32, Shape{3, 3});
+    EXPECT_THROW(executor.call({result}, {a}), ngraph_error);
+    EXPECT_EQ(executor.get_compile_count(), 0);
+}
+
+TEST(specializing_executor, compiles_outside_the_lock)
+{
+    auto A = make_shared<op::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 2});
+    auto f = make_shared<Function>(NodeVector{-A}, ParameterVector{A});
+
+    auto backend = make_shared<GatedBackend>(7);
+    runtime::SpecializingExecutor executor(backend, f);
+
+    auto run = [&](size_t rows) {
+        Shape shape{rows, 2};
+        auto a = backend->create_tensor(element::f32, shape);
+        auto result = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>(shape_size(shape), 1.0f));
+        executor.call({result}, {a});
+        return read_vector<float>(result) == vector<float>(shape_size(shape), -1.0f);
+    };
+
+    EXPECT_TRUE(run(3));
+
+    // Two calls need the same new specialisation; only one of them compiles it
+    auto first = async(launch::async, run, 7);
+    while (backend->get_gated_compiles() == 0)
+    {
+        this_thread::yield();
+    }
+    auto second = async(launch::async, run, 7);
+
+    // A cached specialisation still runs while the other one is being compiled
+    auto cached = async(launch::async, run, 3);
+    EXPECT_EQ(cached.wait_for(chrono::seconds(30)), future_status::ready);
+
+    backend->open();
+    EXPECT_TRUE(first.get());
+    EXPECT_TRUE(second.get());
+    EXPECT_TRUE(cached.get());
+    EXPECT_EQ(backend->get_gated_compiles(), 1);
+    EXPECT_EQ(executor.get_compile_count(), 2);
+}
@@ -2444,6 +2444,66 @@ TEST(type_prop, embedding_lookup_shape_arg1_dynamic_embedding_length)
     ASSERT_TRUE(embed->get_output_partial_shape(0).same_scheme(expected));
 }
 
+TEST(type_prop, gather_static_shapes)
+{
+    auto data = make_shared<op::Parameter>(element::f32, Shape{3, 4, 5});
+    auto indices = make_shared<op::Parameter>(element::i64, Shape{2, 6});
+    auto gather0 = make_shared<op::Gather>(data, indices);
+    ASSERT_EQ(gather0->get_element_type(), element::f32);
+    ASSERT_EQ(gather0->get_shape(), (Shape{2, 6, 4, 5}));
+    auto gather1 = make_shared<op::Gather>(data, indices, 1);
+    ASSERT_EQ(gather1->get_shape(), (Shape{3, 2, 6, 5}));
+    auto gather2 = make_shared<op::Gather>(data, indices, 2);
+    ASSERT_EQ(gather2->get_shape(), (Shape{3, 4, 2, 6}));
+}
+
+TEST(type_prop, gather_dynamic_dims)
+{
+    auto data = make_shared<op::Parameter>(element::f32, PartialShape{3, Dimension::dynamic()});
+    auto indices = make_shared<op::Parameter>(element::i32, PartialShape{Dimension::dynamic()});
+    auto gather = make_shared<op::Gather>(data, indices);
+    PartialShape expected{Dimension::dynamic(), Dimension::dynamic()};
+    ASSERT_TRUE(gather->get_output_partial_shape(0).same_scheme(expected));
+}
+
+TEST(type_prop, gather_axis_oob)
+{
+    auto data = make_shared<op::Parameter>(element::f32, Shape{3, 4});
+    auto indices = make_shared<op::Parameter>(element::i64, Shape{2});
+    try
+    {
+        auto gather = make_shared<op::Gather>(data, indices, 2);
+        FAIL() << "Gather axis out of bounds not detected";
+    }
+    catch (const NodeValidationError& error)
+    {
+        EXPECT_HAS_SUBSTRING(error.what(), "Gather axis 2 is out of bounds");
+    }
+    catch (...)
+    {
+        FAIL() << "Deduced type check failed for unexpected reason";
+    }
+}
+
+TEST(type_prop, gather_float_indices)
+{
+    auto data = make_shared<op::Parameter>(element::f32, Shape{3, 4});
+    auto indices = make_shared<op::Parameter>(element::f32, Shape{2});
+    try
+    {
+        auto gather = make_shared<op::Gather>(data, indices);
+        FAIL() << "Float indices not detected";
+    }
+    catch (const NodeValidationError& error)
+    {
+        EXPECT_HAS_SUBSTRING(error.what(), "Indices element type must be i32 or i64");
+    }
+    catch (...)
+    {
+        FAIL() << "Deduced type check failed for unexpected reason";
+    }
+}
+
 TEST(type_prop, comparison_good)
 {
     auto tv0_2_4_param_0 = make_shared<op::Parameter>(element::f32, Shape{2, 4});
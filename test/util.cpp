@@ -14,7 +14,10 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <fstream>
+#include <list>
+#include <set>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -412,6 +415,115 @@ TEST(graph_util, test_subgraph_topological_sort_control_dependencies)
     ASSERT_EQ(expected, sorted);
 }
 
+static void check_ordered_ops(const shared_ptr<Function>& f)
+{
+    auto ordered = f->get_ordered_ops();
+    auto ops = f->get_ops();
+    EXPECT_EQ(set<shared_ptr<Node>>(ordered.begin(), ordered.end()),
+              set<shared_ptr<Node>>(ops.begin(), ops.end()));
+    set<shared_ptr<Node>> seen;
+    for (auto& node : ordered)
+    {
+        for (auto& arg : node->get_arguments())
+        {
+            EXPECT_EQ(seen.count(arg), 1) << arg->get_name() << " is used before it is computed";
+        }
+        for (auto& cdep : node->get_control_dependencies())
+        {
+            EXPECT_EQ(seen.count(cdep), 1) << cdep->get_name() << " comes too late";
+        }
+        seen.insert(node);
+    }
+}
+
+TEST(graph_util, cached_ordered_ops)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto add = A + B;
+    auto f = make_shared<Function>(add * C, ParameterVector{A, B, C});
+
+    auto ordered = f->get_ordered_ops();
+    const list<shared_ptr<Node>>& nodes = ordered;
+    check_ordered_ops(f);
+
+    // an unchanged graph shares the cached order, also when other graphs are built
+    auto other = make_shared<Function>(make_shared<op::Negative>(A), ParameterVector{A});
+    EXPECT_EQ(&nodes, &static_cast<const list<shared_ptr<Node>>&>(f->get_ordered_ops()));
+
+    // the graph version is process-wide, so editing any graph re-sorts
+    auto other_abs = make_shared<op::Abs>(A);
+    ngraph::replace_node(other->get_result()->get_argument(0), other_abs);
+    EXPECT_NE(&nodes, &static_cast<const list<shared_ptr<Node>>&>(f->get_ordered_ops()));
+
+    // edits behind the function's back invalidate the order, but not orders handed out
+    auto sub = make_shared<op::Subtract>(A, make_shared<op::Negative>(B));
+    ngraph::replace_node(add, sub);
+    EXPECT_EQ(count(ordered.begin(), ordered.end(), add), 1);
+    ordered = f->get_ordered_ops();
+    EXPECT_EQ(count(ordered.begin(), ordered.end(), add), 0);
+    EXPECT_EQ(count(ordered.begin(), ordered.end(), sub), 1);
+    check_ordered_ops(f);
+}
+
+TEST(graph_util, replace_node_repairs_ordered_ops)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto add = A + B;
+    auto mul = add * C;
+    auto abs = make_shared<op::Abs>(mul);
+    auto f = make_shared<Function>(NodeVector{abs, make_shared<op::Negative>(mul)},
+                                   ParameterVector{A, B, C});
+    check_ordered_ops(f);
+
+    auto sub = make_shared<op::Subtract>(make_shared<op::Negative>(C), A);
+    f->replace_node(mul, sub);
+    auto ordered = f->get_ordered_ops();
+    EXPECT_EQ(count(ordered.begin(), ordered.end(), add), 0);
+    EXPECT_EQ(count(ordered.begin(), ordered.end(), mul), 0);
+    check_ordered_ops(f);
+
+    // the replaced node stays in the function as a control dependency
+    auto neg = sub->get_argument(0);
+    abs->add_control_dependency(neg);
+    check_ordered_ops(f);
+    f->replace_node(neg, make_shared<op::Exp>(C));
+    ordered = f->get_ordered_ops();
+    EXPECT_EQ(count(ordered.begin(), ordered.end(), neg), 1);
+    check_ordered_ops(f);
+}
+
+TEST(graph_util, replace_node_while_iterating_ordered_ops)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Abs>(make_shared<op::Negative>(A + B)),
+                                   ParameterVector{A, B});
+
+    weak_ptr<Node> replaced;
+    size_t visited = 0;
+    for (auto node : f->get_ordered_ops())
+    {
+        if (node->description() == "Negative")
+        {
+            replaced = node;
+            f->replace_node(node, make_shared<op::Exp>(node->get_argument(0)));
+        }
+        visited++;
+    }
+    EXPECT_EQ(visited, 6);
+    check_ordered_ops(f);
+
+    // the cache lets go of nodes that were replaced
+    EXPECT_TRUE(replaced.expired());
+}
+
 TEST(pass, visualize_tree)
 {
     Shape shape{2, 2};